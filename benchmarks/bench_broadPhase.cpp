@@ -0,0 +1,169 @@
+// Broad-phase scaling benchmark.
+//
+// Scatters N box colliders over a world whose area grows with N (constant
+// density, roughly what a level looks like), then times:
+//   - broad-phase only (update + findPairs) for each broad-phase
+//     (static proxies, so SAP and the AABB tree are measured at full
+//     frame-to-frame coherence)
+//   - a full PhysicsManager::update tick with the default broad-phase, with
+//     moving bodies on one thread and on every hardware thread, and once with
+//     every body asleep
+//
+// Usage: bench_broadPhase [maxColliders]
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "engine/core/ecs/EntityManager.h"
+#include "engine/core/ecs/components/Collider.h"
+#include "engine/core/ecs/components/RigidBody.h"
+#include "engine/core/ecs/components/Transform.h"
+#include "engine/physics/PhysicsManager.h"
+#include "engine/physics/broadphase/AABBTreeBroadPhase.h"
+#include "engine/physics/broadphase/BruteForceBroadPhase.h"
+#include "engine/physics/broadphase/SpatialHashBroadPhase.h"
+#include "engine/physics/broadphase/SweepAndPruneBroadPhase.h"
+
+namespace
+{
+    constexpr float MIN_SIZE = 8.0f;
+    constexpr float MAX_SIZE = 32.0f;
+    constexpr float AREA_PER_COLLIDER = 48.0f * 48.0f;
+    constexpr size_t BRUTE_FORCE_LIMIT = 10000; // Beyond this the O(n²) loop takes minutes
+
+    std::vector<BroadPhaseProxy> makeProxies(size_t count, uint32_t seed)
+    {
+        float worldSize = std::sqrt(static_cast<float>(count) * AREA_PER_COLLIDER);
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(0.0f, worldSize);
+        std::uniform_real_distribution<float> size(MIN_SIZE, MAX_SIZE);
+
+        std::vector<BroadPhaseProxy> proxies;
+        proxies.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            glm::vec2 center{position(rng), position(rng)};
+            glm::vec2 half{size(rng) * 0.5f, size(rng) * 0.5f};
+            proxies.push_back({static_cast<EntityID>(i), {center - half, center + half}});
+        }
+        return proxies;
+    }
+
+    /** Run @p fn @p iterations times and return the average in milliseconds. */
+    double timeMs(int iterations, const std::function<void()> &fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            fn();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+    }
+
+    int iterationsFor(size_t count)
+    {
+        return count <= 1000 ? 50 : (count <= 10000 ? 10 : 3);
+    }
+
+    void benchBroadPhase(const char *name, IBroadPhase &broadPhase, const std::vector<BroadPhaseProxy> &proxies)
+    {
+        std::vector<CollisionPair> pairs;
+        double ms = timeMs(iterationsFor(proxies.size()), [&]()
+                           {
+            pairs.clear();
+            broadPhase.update(proxies);
+            broadPhase.findPairs(pairs); });
+
+        std::printf("  %-14s %8zu colliders  %10.3f ms  %8zu pairs\n", name, proxies.size(), ms, pairs.size());
+    }
+
+    void benchPhysicsTick(size_t count, bool resting, size_t threads)
+    {
+        EntityManager em;
+        PhysicsManager pm(&em);
+        pm.setThreadCount(threads);
+
+        for (const BroadPhaseProxy &proxy : makeProxies(count, 1234))
+        {
+            EntityID e = em.createEntity();
+            ECS::Transform t;
+            t.position = (proxy.aabb.min + proxy.aabb.max) * 0.5f;
+            em.addComponent(e, t);
+
+            ECS::Collider c;
+            c.type = ECS::ColliderType::Box;
+            c.size = proxy.aabb.max - proxy.aabb.min;
+            em.addComponent(e, c);
+
+            // One in twenty colliders is a rigid body, the rest are level geometry
+            if (e % 20 == 0)
+            {
+                em.addComponent(e, ECS::RigidBody{resting ? glm::vec2{0.0f, 0.0f} : glm::vec2{10.0f, -5.0f}});
+            }
+        }
+
+        // Warm-up builds the static tree and lets resting bodies fall asleep
+        for (float slept = 0.0f; slept <= PhysicsManager::DEFAULT_TIME_TO_SLEEP; slept += 1.0f / 60.0f)
+        {
+            pm.update(1.0f / 60.0f);
+        }
+
+        double ms = timeMs(iterationsFor(count), [&]()
+                           { pm.update(1.0f / 60.0f); });
+        std::printf("  %-14s %8zu colliders  %10.3f ms  %3zu threads\n", resting ? "resting tick" : "physics tick", count, ms, pm.getThreadCount());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t maxColliders = (argc > 1) ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 50000;
+    const size_t counts[] = {100, 500, 1000, 5000, 10000, 25000, 50000};
+
+    std::printf("Broad-phase (update + findPairs)\n");
+    for (size_t count : counts)
+    {
+        if (count > maxColliders)
+            break;
+
+        auto proxies = makeProxies(count, 42);
+
+        if (count <= BRUTE_FORCE_LIMIT)
+        {
+            BruteForceBroadPhase bruteForce;
+            benchBroadPhase("brute force", bruteForce, proxies);
+        }
+
+        SpatialHashBroadPhase spatialHash;
+        benchBroadPhase("spatial hash", spatialHash, proxies);
+
+        // Timed after a warm-up tick: SAP's steady state is the coherent re-sort, not the initial build
+        SweepAndPruneBroadPhase sweepAndPrune;
+        sweepAndPrune.update(proxies);
+        benchBroadPhase("sweep & prune", sweepAndPrune, proxies);
+
+        // Same for the tree: after the first insert, static proxies are never touched again
+        AABBTreeBroadPhase aabbTree;
+        aabbTree.update(proxies);
+        benchBroadPhase("aabb tree", aabbTree, proxies);
+    }
+
+    std::printf("\nFull PhysicsManager::update (default broad-phase)\n");
+    for (size_t count : counts)
+    {
+        if (count > maxColliders)
+            break;
+        benchPhysicsTick(count, false, 1);
+        benchPhysicsTick(count, false, 0);
+        benchPhysicsTick(count, true, 0);
+    }
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+// Scalar backend benchmark: float against 16.16 and 32.32 fixed point.
+//
+// Runs the same scene through Math.h and the Basic* components instantiated
+// on each scalar: N circles bouncing in a walled, metre-scale arena. The
+// narrow-phase squares distances, so with 16.16 (range ±32768) no two points
+// that get tested may be more than ~128 units apart. Each tick integrates
+// every body, resolves it against the walls, then resolves a fixed list of
+// neighbour pairs with an impulse and a position correction. The pair list
+// is built once from the starting layout so every backend does the same
+// narrow-phase work; the broad-phase is the float engine's and is measured by
+// bench_broadPhase.
+//
+// Usage: bench_fixedPoint [bodies] [ticks]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "engine/core/ecs/components/RigidBody.h"
+#include "engine/core/ecs/components/Transform.h"
+#include "engine/physics/FixedPoint.h"
+#include "engine/physics/Math.h"
+
+namespace
+{
+    constexpr float ARENA_SIZE = 100.0f; // Metres
+    constexpr float MIN_RADIUS = 0.15f;
+    constexpr float MAX_RADIUS = 0.3f;
+    constexpr float MAX_SPEED = 6.0f;
+    constexpr int NEIGHBOURS = 8; // Candidate pairs per body
+
+    struct SceneSpec
+    {
+        std::vector<glm::vec2> positions;
+        std::vector<glm::vec2> velocities;
+        std::vector<float> radii;
+        std::vector<std::pair<size_t, size_t>> pairs;
+    };
+
+    SceneSpec makeScene(size_t count, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(1.0f, ARENA_SIZE - 1.0f);
+        std::uniform_real_distribution<float> speed(-MAX_SPEED, MAX_SPEED);
+        std::uniform_real_distribution<float> radius(MIN_RADIUS, MAX_RADIUS);
+
+        SceneSpec spec;
+        for (size_t i = 0; i < count; ++i)
+        {
+            spec.positions.push_back({position(rng), position(rng)});
+            spec.velocities.push_back({speed(rng), speed(rng)});
+            spec.radii.push_back(radius(rng));
+        }
+
+        // Fixed candidate pairs: each body against the next few in the list
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (size_t j = i + 1; j < count && j <= i + NEIGHBOURS; ++j)
+            {
+                spec.pairs.emplace_back(i, j);
+            }
+        }
+        return spec;
+    }
+
+    template <typename Scalar>
+    class Scene
+    {
+    public:
+        using Vec = Math::Vec2<Scalar>;
+
+        explicit Scene(const SceneSpec &spec)
+            : mPairs(spec.pairs)
+        {
+            for (size_t i = 0; i < spec.positions.size(); ++i)
+            {
+                ECS::BasicTransform<Scalar> transform;
+                transform.position = Vec(Scalar(spec.positions[i].x), Scalar(spec.positions[i].y));
+                mTransforms.push_back(transform);
+
+                ECS::BasicRigidBody<Scalar> body;
+                body.velocity = Vec(Scalar(spec.velocities[i].x), Scalar(spec.velocities[i].y));
+                body.restitution = Scalar(0.8f);
+                mBodies.push_back(body);
+
+                mRadii.push_back(Scalar(spec.radii[i]));
+            }
+
+            Scalar size(ARENA_SIZE);
+            Scalar thickness(10);
+            mWalls[0] = {Vec(-thickness, -thickness), Vec(size + thickness, Scalar(0))};
+            mWalls[1] = {Vec(-thickness, size), Vec(size + thickness, size + thickness)};
+            mWalls[2] = {Vec(-thickness, Scalar(0)), Vec(Scalar(0), size)};
+            mWalls[3] = {Vec(size, Scalar(0)), Vec(size + thickness, size)};
+        }
+
+        void step(Scalar dt)
+        {
+            for (size_t i = 0; i < mBodies.size(); ++i)
+            {
+                mTransforms[i].position += mBodies[i].velocity * dt;
+                for (const Math::BasicAABB<Scalar> &wall : mWalls)
+                {
+                    auto result = Math::resolveAABBCircleCollision(wall, mTransforms[i].position, mRadii[i]);
+                    if (result.isColliding)
+                        respond(i, result);
+                }
+            }
+
+            for (const auto &pair : mPairs)
+            {
+                auto result = Math::resolveCircleCollision(mTransforms[pair.first].position, mRadii[pair.first],
+                                                           mTransforms[pair.second].position, mRadii[pair.second]);
+                if (result.isColliding)
+                    respond(pair.first, pair.second, result);
+            }
+        }
+
+        /** @brief Sum of every coordinate, so the work cannot be optimized away and backends can be compared. */
+        double checksum() const
+        {
+            double sum = 0.0;
+            for (const ECS::BasicTransform<Scalar> &transform : mTransforms)
+            {
+                sum += static_cast<double>(transform.position.x) + static_cast<double>(transform.position.y);
+            }
+            return sum;
+        }
+
+    private:
+        /** @brief Bounce body @p i off a static wall. */
+        void respond(size_t i, const Math::BasicCollisionResult<Scalar> &result)
+        {
+            ECS::BasicRigidBody<Scalar> &body = mBodies[i];
+            mTransforms[i].position += result.normal * result.penetration;
+
+            Scalar normalVelocity = Math::dot(body.velocity, result.normal);
+            if (normalVelocity < Scalar(0))
+                body.velocity -= result.normal * ((Scalar(1) + body.restitution) * normalVelocity);
+        }
+
+        /** @brief Equal-mass impulse and half-and-half position correction between bodies @p a and @p b. */
+        void respond(size_t a, size_t b, const Math::BasicCollisionResult<Scalar> &result)
+        {
+            const Scalar half = Scalar(1) / Scalar(2);
+            Vec push = result.normal * (result.penetration * half);
+            mTransforms[a].position += push;
+            mTransforms[b].position -= push;
+
+            Scalar normalVelocity = Math::dot(mBodies[a].velocity - mBodies[b].velocity, result.normal);
+            if (normalVelocity >= Scalar(0))
+                return;
+
+            Scalar restitution = std::min(mBodies[a].restitution, mBodies[b].restitution);
+            Vec impulse = result.normal * ((Scalar(1) + restitution) * normalVelocity * half);
+            mBodies[a].velocity -= impulse;
+            mBodies[b].velocity += impulse;
+        }
+
+        std::vector<ECS::BasicTransform<Scalar>> mTransforms;
+        std::vector<ECS::BasicRigidBody<Scalar>> mBodies;
+        std::vector<Scalar> mRadii;
+        std::vector<std::pair<size_t, size_t>> mPairs;
+        Math::BasicAABB<Scalar> mWalls[4];
+    };
+
+    template <typename Scalar>
+    void benchScene(const char *name, const SceneSpec &spec, int ticks)
+    {
+        Scene<Scalar> scene(spec);
+        Scalar dt = Scalar(1) / Scalar(60);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < ticks; ++tick)
+        {
+            scene.step(dt);
+        }
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count() / ticks;
+
+        std::printf("  %-10s %8zu bodies  %10.3f ms/tick  %12.2f checksum\n", name, spec.positions.size(), ms, scene.checksum());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t bodies = (argc > 1) ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 10000;
+    int ticks = (argc > 2) ? std::atoi(argv[2]) : 300;
+
+    SceneSpec spec = makeScene(bodies, 42);
+    std::printf("Integrate + resolve (%zu candidate pairs, %d ticks)\n", spec.pairs.size(), ticks);
+
+    benchScene<float>("float", spec, ticks);
+    benchScene<Fixed16_16>("16.16", spec, ticks);
+#ifdef __SIZEOF_INT128__
+    benchScene<Fixed32_32>("32.32", spec, ticks);
+#endif
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+// Tile map collision benchmark.
+//
+// Builds square tile maps of growing size, each a walled level with random
+// platforms and scattered single blocks (so the merge cannot collapse it to a
+// few rectangles), then drops the same bodies into the same 64x64-tile corner
+// of every map and times a full PhysicsManager::update tick. The tick should
+// not grow with the map: bodies only walk the tiles under their bounds.
+// Map build time is reported separately; it is linear in the tile count and
+// paid once at load.
+//
+// Usage: bench_tileMap [bodies] [ticks]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "engine/core/ecs/EntityManager.h"
+#include "engine/core/ecs/components/Collider.h"
+#include "engine/core/ecs/components/RigidBody.h"
+#include "engine/core/ecs/components/TileMapCollider.h"
+#include "engine/core/ecs/components/Transform.h"
+#include "engine/physics/PhysicsManager.h"
+#include "engine/physics/TileMap.h"
+
+namespace
+{
+    constexpr float TILE_SIZE = 16.0f;
+    constexpr int PLAY_AREA = 64; // Tiles on a side of the corner the bodies fall into
+
+    std::vector<uint8_t> makeLevel(int size, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> tile(1, size - 2);
+        std::uniform_int_distribution<int> length(3, 12);
+        std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+
+        std::vector<uint8_t> solid(static_cast<size_t>(size) * size, 0);
+        auto set = [&](int x, int y)
+        {
+            solid[static_cast<size_t>(y) * size + x] = 1;
+        };
+
+        for (int i = 0; i < size; ++i)
+        {
+            set(i, 0);
+            set(i, size - 1);
+            set(0, i);
+            set(size - 1, i);
+        }
+
+        // One platform per 64 tiles, one loose block per 32
+        for (size_t p = 0; p < solid.size() / 64; ++p)
+        {
+            int x = tile(rng), y = tile(rng), w = length(rng);
+            for (int i = 0; i < w && x + i < size - 1; ++i)
+                set(x + i, y);
+        }
+        for (size_t i = 0; i < solid.size(); ++i)
+        {
+            if (chance(rng) < 1.0f / 32.0f)
+                solid[i] = 1;
+        }
+        return solid;
+    }
+
+    void benchMap(int size, size_t bodies, int ticks)
+    {
+        EntityManager em;
+        PhysicsManager pm(&em);
+        pm.setGravity({0.0f, 980.0f});
+
+        std::vector<uint8_t> solid = makeLevel(size, 42);
+        size_t solidCount = 0;
+        for (uint8_t s : solid)
+            solidCount += s;
+
+        EntityID level = em.createEntity();
+        em.addComponent(level, ECS::Transform{{0.0f, 0.0f}});
+        ECS::TileMapCollider map;
+        map.tileSize = TILE_SIZE;
+
+        auto buildStart = std::chrono::steady_clock::now();
+        TileMap::build(map, size, size, solid);
+        auto buildEnd = std::chrono::steady_clock::now();
+        size_t rectCount = map.rects.size();
+        em.addComponent(level, map);
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> position(2.0f * TILE_SIZE, (PLAY_AREA - 2) * TILE_SIZE);
+        for (size_t i = 0; i < bodies; ++i)
+        {
+            EntityID e = em.createEntity();
+            em.addComponent(e, ECS::Transform{{position(rng), position(rng)}});
+            ECS::Collider collider;
+            collider.size = {10.0f, 10.0f};
+            em.addComponent(e, collider);
+            em.addComponent(e, ECS::RigidBody{});
+        }
+
+        pm.update(1.0f / 60.0f); // Warm up the trees
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < ticks; ++tick)
+        {
+            pm.update(1.0f / 60.0f);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double buildMs = std::chrono::duration<double, std::milli>(buildEnd - buildStart).count();
+        double tickMs = std::chrono::duration<double, std::milli>(end - start).count() / ticks;
+        std::printf("  %5dx%-5d %10zu solid %9zu rects  build %9.2f ms  %8.3f ms/tick  %6zu contacts\n",
+                    size, size, solidCount, rectCount, buildMs, tickMs, pm.getContacts().size());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t bodies = (argc > 1) ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 1000;
+    int ticks = (argc > 2) ? std::atoi(argv[2]) : 120;
+
+    std::printf("Tile map collision (%zu bodies in a %dx%d-tile corner, %d ticks)\n", bodies, PLAY_AREA, PLAY_AREA, ticks);
+    for (int size : {100, 300, 1000})
+    {
+        benchMap(size, bodies, ticks);
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "JobPool.h"
+
+#include <algorithm>
+
+namespace
+{
+    size_t sliceBegin(size_t slice, size_t slices, size_t count)
+    {
+        return slice * count / slices;
+    }
+}
+
+JobPool::JobPool(size_t threadCount)
+    : mThreadCount(threadCount)
+{
+    if (mThreadCount == 0)
+        mThreadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+JobPool::~JobPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWorkReady.notify_all();
+
+    for (std::thread &worker : mWorkers)
+    {
+        worker.join();
+    }
+}
+
+void JobPool::startWorkers()
+{
+    mWorkers.reserve(mThreadCount - 1);
+    for (size_t thread = 1; thread < mThreadCount; ++thread)
+    {
+        mWorkers.emplace_back(&JobPool::workerLoop, this, thread);
+    }
+}
+
+void JobPool::parallelFor(size_t count, size_t minPerThread, const Job &job)
+{
+    if (count == 0)
+        return;
+
+    size_t slices = std::min(mThreadCount, count / std::max<size_t>(1, minPerThread));
+    if (slices <= 1)
+    {
+        job(0, count, 0);
+        return;
+    }
+
+    if (mWorkers.empty())
+        startWorkers();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJob = &job;
+        mCount = count;
+        mSlices = slices;
+        mPending = slices - 1;
+        ++mGeneration;
+    }
+    mWorkReady.notify_all();
+
+    // The caller runs the first slice while the workers take the rest
+    job(0, sliceBegin(1, slices, count), 0);
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mWorkDone.wait(lock, [this]
+                   { return mPending == 0; });
+    mJob = nullptr;
+}
+
+void JobPool::workerLoop(size_t thread)
+{
+    size_t seenGeneration = 0;
+
+    for (;;)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWorkReady.wait(lock, [&]
+                        { return mStopping || mGeneration != seenGeneration; });
+        if (mStopping)
+            return;
+
+        seenGeneration = mGeneration;
+        if (thread >= mSlices)
+            continue; // Job too small to need this thread
+
+        const Job &job = *mJob;
+        size_t begin = sliceBegin(thread, mSlices, mCount);
+        size_t end = sliceBegin(thread + 1, mSlices, mCount);
+        lock.unlock();
+
+        job(begin, end, thread);
+
+        lock.lock();
+        if (--mPending == 0)
+            mWorkDone.notify_one();
+    }
+}
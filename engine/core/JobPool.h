@@ -0,0 +1,63 @@
+#ifndef JOBPOOL_H
+#define JOBPOOL_H
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class JobPool
+ * @brief Fixed set of worker threads that split a range of indices between them.
+ *
+ * The calling thread takes part in every job as thread 0, so a pool of one thread
+ * runs everything inline and never starts a worker. Workers are started on the
+ * first job that is large enough to be split.
+ */
+class JobPool
+{
+public:
+    /** @brief Signature of a job slice: [begin, end) of the range and the index of the thread running it. */
+    using Job = std::function<void(size_t begin, size_t end, size_t thread)>;
+
+    /** @param threadCount Threads taking part in each job, including the caller. 0 uses every hardware thread. */
+    explicit JobPool(size_t threadCount = 0);
+    ~JobPool();
+
+    /* Delete copy constructor and assignment operator */
+    JobPool(const JobPool &) = delete;
+    JobPool &operator=(const JobPool &) = delete;
+
+    /** @brief Threads taking part in each job, including the caller. */
+    size_t getThreadCount() const { return mThreadCount; }
+
+    /**
+     * @brief Split [0, count) into at most getThreadCount() contiguous slices and run @p job on each.
+     *
+     * Slice i covers a lower range than slice i + 1 and runs on thread i. No slice is smaller than
+     * @p minPerThread, so small ranges run inline. Returns once every slice has finished.
+     */
+    void parallelFor(size_t count, size_t minPerThread, const Job &job);
+
+private:
+    void startWorkers();
+    void workerLoop(size_t thread);
+
+    size_t mThreadCount;                ///< Threads taking part in each job, including the caller
+    std::vector<std::thread> mWorkers;  ///< Threads 1..mThreadCount-1, started on the first split job
+    std::mutex mMutex;                  ///< Guards every member below
+    std::condition_variable mWorkReady; ///< Signalled when a new job is posted or on shutdown
+    std::condition_variable mWorkDone;  ///< Signalled when the last worker slice of a job finishes
+    const Job *mJob{nullptr};           ///< Job being run, valid while mPending > 0
+    size_t mCount{0};                   ///< Range of the job being run
+    size_t mSlices{0};                  ///< Number of slices the job is split into
+    size_t mPending{0};                 ///< Worker slices of the current job still running
+    size_t mGeneration{0};              ///< Incremented for every posted job so workers run each one once
+    bool mStopping{false};              ///< Set by the destructor to release the workers
+};
+
+#endif
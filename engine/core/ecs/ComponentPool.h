@@ -5,8 +5,12 @@
 
 #include <vector>
 #include <cassert>
+#include <algorithm>
 #include <limits>
+#include <memory>
+#include <utility>
 #include "ComponentTypeID.h"
+#include "OwningGroup.h"
 
 class IComponentPool
 {
@@ -16,41 +20,90 @@ public:
     virtual bool remove(EntityID entity) = 0;
     virtual size_t size() const = 0;
     virtual const std::vector<EntityID> &entities() const = 0;
+    /** @brief Swap the component of @p entity with the one at dense @p index. */
+    virtual void swapDense(EntityID entity, uint32_t index) = 0;
 };
 
+/**
+ * Sparse set: components packed in a dense array, found through a sparse array indexed by entity index.
+ *
+ * The sparse array is split into fixed-size pages allocated on first use and freed once empty, so a
+ * pool holding a few entities with high indices costs a few pages instead of an array as long as the
+ * highest index. Lookup stays two array reads.
+ */
 template <typename T>
 class ComponentPool : public IComponentPool
 {
 public:
     static constexpr uint32_t INVALID = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t SPARSE_PAGE_BITS = 12;
+    static constexpr uint32_t SPARSE_PAGE_SIZE = 1u << SPARSE_PAGE_BITS; ///< Entries per sparse page (16 KB)
 
     T &add(EntityID entity, const T &component)
     {
+        uint32_t slot = getEntityIndex(entity);
         assert(!has(entity) && "Entity already has this component");
-        ensureSparseSize(entity);
+        assert(findSparse(slot) == INVALID && "Another generation of this entity still has this component");
 
-        mSparse[entity] = static_cast<uint32_t>(mDense.size());
+        acquireSparse(slot) = static_cast<uint32_t>(mDense.size());
         mDense.push_back(component);
         mDenseToEntity.push_back(entity);
+        ++mVersion;
 
+        if (mSignatures)
+        {
+            if (slot >= mSignatures->size())
+            {
+                mSignatures->resize(slot + 1);
+            }
+            (*mSignatures)[slot].set(mTypeID);
+        }
+
+        if (mGroup)
+        {
+            mGroup->onAdd(entity);
+            return get(entity);
+        }
         return mDense.back();
     }
 
+    /** @brief The component of @p entity, which must have one; see tryGet() when it may not. */
     T &get(EntityID entity)
     {
         assert(has(entity) && "Entity does not have this component");
-        return mDense[mSparse[entity]];
+        return mDense[storedIndex(getEntityIndex(entity))];
     }
 
     const T &get(EntityID entity) const
     {
         assert(has(entity) && "Entity does not have this component");
-        return mDense[mSparse[entity]];
+        return mDense[storedIndex(getEntityIndex(entity))];
+    }
+
+    /** @brief The component of @p entity, or nullptr if it has none. */
+    T *tryGet(EntityID entity)
+    {
+        uint32_t index = getDenseIndex(entity);
+        return index != INVALID ? &mDense[index] : nullptr;
+    }
+
+    const T *tryGet(EntityID entity) const
+    {
+        uint32_t index = getDenseIndex(entity);
+        return index != INVALID ? &mDense[index] : nullptr;
     }
 
+    /** @brief False for a deleted entity even when a newer entity reuses its index. */
     bool has(EntityID entity) const override
     {
-        return entity < mSparse.size() && mSparse[entity] != INVALID;
+        return getDenseIndex(entity) != INVALID;
+    }
+
+    /** @brief Position of @p entity's component in getDense() and getDenseToEntity(), or INVALID if it has none. */
+    uint32_t getDenseIndex(EntityID entity) const
+    {
+        uint32_t index = findSparse(getEntityIndex(entity));
+        return index != INVALID && mDenseToEntity[index] == entity ? index : INVALID;
     }
 
     size_t size() const override { return mDense.size(); }
@@ -63,19 +116,31 @@ public:
             return false;
         }
 
-        uint32_t index = mSparse[entity];
+        if (mGroup)
+        {
+            mGroup->onRemove(entity);
+        }
+
+        uint32_t index = storedIndex(getEntityIndex(entity));
         uint32_t lastIndex = static_cast<uint32_t>(mDense.size() - 1);
         EntityID lastEntity = mDenseToEntity[lastIndex];
 
         // Move the last component to the removed spot
         mDense[index] = std::move(mDense[lastIndex]);
         mDenseToEntity[index] = lastEntity;
-        mSparse[lastEntity] = index;
+        uint32_t lastSlot = getEntityIndex(lastEntity);
+        storedIndex(lastSlot) = index;
 
         // Remove the last component
         mDense.pop_back();
         mDenseToEntity.pop_back();
-        mSparse[entity] = INVALID;
+        releaseSparse(getEntityIndex(entity));
+        ++mVersion;
+
+        if (mSignatures)
+        {
+            (*mSignatures)[getEntityIndex(entity)].reset(mTypeID);
+        }
 
         return true;
     }
@@ -85,11 +150,56 @@ public:
      */
     const std::vector<EntityID> &getDenseToEntity() const { return mDenseToEntity; }
     const std::vector<T> &getDense() const { return mDense; }
-    const std::vector<uint32_t> &getSparse() const { return mSparse; }
 
     std::vector<EntityID> &getDenseToEntity() { return mDenseToEntity; }
     std::vector<T> &getDense() { return mDense; }
-    std::vector<uint32_t> &getSparse() { return mSparse; }
+
+    /**
+     * @brief Keep bit @p typeID of each entity's signature in @p signatures (indexed by entity index)
+     * in step with add() and remove(). Set by the EntityManager that owns the pool.
+     */
+    void trackSignatures(std::vector<ComponentSignature> *signatures, ComponentTypeID typeID)
+    {
+        mSignatures = signatures;
+        mTypeID = typeID;
+    }
+
+    void swapDense(EntityID entity, uint32_t index) override
+    {
+        assert(has(entity) && "Entity does not have this component");
+        uint32_t from = storedIndex(getEntityIndex(entity));
+        if (from == index)
+        {
+            return;
+        }
+
+        EntityID other = mDenseToEntity[index];
+        std::swap(mDense[from], mDense[index]);
+        std::swap(mDenseToEntity[from], mDenseToEntity[index]);
+        uint32_t slot = getEntityIndex(entity);
+        uint32_t otherSlot = getEntityIndex(other);
+        storedIndex(slot) = index;
+        storedIndex(otherSlot) = from;
+        ++mVersion;
+    }
+
+    /** @brief The owning group this pool belongs to, if any. Set by the EntityManager that owns the pool. */
+    void setGroup(OwningGroup *group) { mGroup = group; }
+    const OwningGroup *getGroup() const { return mGroup; }
+
+    /** @brief Number of sparse pages currently allocated. */
+    size_t getSparsePageCount() const { return mSparsePageCount; }
+
+    /** @brief Bytes held by the sparse pages and the page table. */
+    size_t getSparseMemory() const
+    {
+        return mSparsePageCount * SPARSE_PAGE_SIZE * sizeof(uint32_t) + mSparsePages.capacity() * sizeof(SparsePage);
+    }
+
+    /**
+     * @brief Incremented by every add(), remove() and swapDense(). Dense indices cached while it is unchanged are still valid.
+     */
+    uint64_t getVersion() const { return mVersion; }
 
     /** Range-based for loop support — iterates over EntityIDs */
     auto begin() const { return mDenseToEntity.begin(); }
@@ -98,17 +208,67 @@ public:
     auto end() { return mDenseToEntity.end(); }
 
 private:
-    void ensureSparseSize(EntityID entity)
+    static constexpr uint32_t SPARSE_PAGE_MASK = SPARSE_PAGE_SIZE - 1;
+
+    struct SparsePage
+    {
+        std::unique_ptr<uint32_t[]> entries; ///< SPARSE_PAGE_SIZE dense indices (or INVALID), null until first used
+        uint32_t count{0};                   ///< Entries that are not INVALID; the page is freed when this drops to 0
+    };
+
+    /** @brief Dense index stored for entity index @p slot, or INVALID when its page is not allocated. */
+    uint32_t findSparse(uint32_t slot) const
+    {
+        uint32_t page = slot >> SPARSE_PAGE_BITS;
+        if (page >= mSparsePages.size() || !mSparsePages[page].entries)
+            return INVALID;
+        return mSparsePages[page].entries[slot & SPARSE_PAGE_MASK];
+    }
+
+    /** @brief Dense index stored for entity index @p slot, whose page must be allocated. */
+    uint32_t &storedIndex(uint32_t slot) { return mSparsePages[slot >> SPARSE_PAGE_BITS].entries[slot & SPARSE_PAGE_MASK]; }
+    uint32_t storedIndex(uint32_t slot) const { return mSparsePages[slot >> SPARSE_PAGE_BITS].entries[slot & SPARSE_PAGE_MASK]; }
+
+    /** @brief Entry for an unused @p slot, allocating its page if needed. */
+    uint32_t &acquireSparse(uint32_t slot)
+    {
+        uint32_t page = slot >> SPARSE_PAGE_BITS;
+        if (page >= mSparsePages.size())
+        {
+            mSparsePages.resize(page + 1);
+        }
+
+        SparsePage &sparsePage = mSparsePages[page];
+        if (!sparsePage.entries)
+        {
+            sparsePage.entries = std::make_unique<uint32_t[]>(SPARSE_PAGE_SIZE);
+            std::fill_n(sparsePage.entries.get(), SPARSE_PAGE_SIZE, INVALID);
+            ++mSparsePageCount;
+        }
+        ++sparsePage.count;
+        return sparsePage.entries[slot & SPARSE_PAGE_MASK];
+    }
+
+    /** @brief Clear the entry of a used @p slot, freeing its page once the page is empty. */
+    void releaseSparse(uint32_t slot)
     {
-        if (entity >= mSparse.size())
+        SparsePage &sparsePage = mSparsePages[slot >> SPARSE_PAGE_BITS];
+        sparsePage.entries[slot & SPARSE_PAGE_MASK] = INVALID;
+        if (--sparsePage.count == 0)
         {
-            mSparse.resize(entity + 1, INVALID);
+            sparsePage.entries.reset();
+            --mSparsePageCount;
         }
     }
 
-    std::vector<uint32_t> mSparse;        ///< EntityID -> index into mDense (or INVALID)
+    std::vector<SparsePage> mSparsePages; ///< Entity index / SPARSE_PAGE_SIZE -> page of indices into mDense
+    size_t mSparsePageCount{0};           ///< Pages in mSparsePages with entries allocated
     std::vector<T> mDense;                ///< Contiguous component data
     std::vector<EntityID> mDenseToEntity; ///< Dense index -> EntityID
+    uint64_t mVersion{0};                 ///< Count of structural changes, see getVersion()
+    std::vector<ComponentSignature> *mSignatures{nullptr}; ///< Owner's signatures, see trackSignatures()
+    ComponentTypeID mTypeID{0};           ///< This pool's bit in mSignatures
+    OwningGroup *mGroup{nullptr};         ///< Group keeping this pool's members packed, see setGroup()
 };
 
 #endif
@@ -3,14 +3,43 @@
 
 #pragma once
 
+#include <bitset>
+#include <cassert>
 #include <cstdint>
 
-using EntityID = uint32_t;
+using EntityID = uint64_t;
 using ComponentTypeID = uint32_t;
 
+/*
+ * An EntityID packs a 32-bit slot index in its low half and the slot's 32-bit generation in its high half.
+ * Deleting an entity bumps the generation of its slot before the slot is reused, so handles kept
+ * to the deleted entity no longer match anything. Per-entity arrays are indexed by getEntityIndex().
+ *
+ * An EntityManager hands out at most ENTITY_INDEX_MASK indices (2^32 - 1); the last one is reserved
+ * to mark free slots. EntityManager::createEntity() throws past that rather than alias a live index.
+ */
+constexpr uint32_t ENTITY_INDEX_BITS = 32;
+constexpr uint32_t ENTITY_INDEX_MASK = UINT32_MAX;
+constexpr uint32_t ENTITY_GENERATION_MASK = UINT32_MAX;
+
+constexpr uint32_t getEntityIndex(EntityID entity) { return static_cast<uint32_t>(entity & ENTITY_INDEX_MASK); }
+constexpr uint32_t getEntityGeneration(EntityID entity) { return static_cast<uint32_t>(entity >> ENTITY_INDEX_BITS); }
+
+constexpr EntityID makeEntityID(uint32_t index, uint32_t generation)
+{
+    return (static_cast<EntityID>(generation) << ENTITY_INDEX_BITS) | index;
+}
+
+/** @brief Component types an EntityManager can tell apart; one bit each in a ComponentSignature. */
+constexpr size_t MAX_COMPONENT_TYPES = 64;
+
+/** @brief Bit getComponentTypeID<T>() is set for every component type T an entity has. */
+using ComponentSignature = std::bitset<MAX_COMPONENT_TYPES>;
+
 inline ComponentTypeID getNextComponentTypeID()
 {
     static ComponentTypeID lastID = 0;
+    assert(lastID < MAX_COMPONENT_TYPES && "Too many component types; raise MAX_COMPONENT_TYPES");
     return lastID++;
 }
 
@@ -1,19 +1,49 @@
 #include "EntityManager.h"
 
+#include <stdexcept>
+#include <string>
+
 EntityID EntityManager::createEntity()
 {
-    return mNextEntityID++;
+    if (mFreeIndices.size() > MIN_FREE_INDICES)
+    {
+        uint32_t slot = mFreeIndices.front();
+        mFreeIndices.pop_front();
+        mEntities[slot] = makeEntityID(slot, getEntityGeneration(mEntities[slot]));
+        return mEntities[slot];
+    }
+
+    // makeEntityID() masks the index, so one more would alias entity 0 in every build mode
+    if (mEntities.size() >= ENTITY_INDEX_MASK)
+    {
+        throw std::length_error("EntityManager: all " + std::to_string(ENTITY_INDEX_MASK) + " entity indices are in use");
+    }
+    EntityID entity = makeEntityID(static_cast<uint32_t>(mEntities.size()), 0);
+    mEntities.push_back(entity);
+    return entity;
 }
 
 bool EntityManager::deleteEntity(EntityID entity)
 {
-    // Mark the entity as deleted by removing its components from all pools
-    for (auto &pool : mPools)
+    if (!isAlive(entity))
     {
-        if (pool)
+        return false;
+    }
+
+    // Only the pools named by the signature hold a component of it; each removal clears its own bit
+    uint32_t slot = getEntityIndex(entity);
+    ComponentSignature signature = slot < mSignatures.size() ? mSignatures[slot] : ComponentSignature{};
+    for (ComponentTypeID id = 0; signature.any(); ++id)
+    {
+        if (signature.test(id))
         {
-            pool->remove(entity); // This will remove the component if it exists
+            mPools[id]->remove(entity);
+            signature.reset(id);
         }
     }
+
+    // Keep the next generation under an index no handle has, so nothing matches the slot while it is free
+    mEntities[slot] = makeEntityID(FREE_INDEX, getEntityGeneration(entity) + 1);
+    mFreeIndices.push_back(slot);
     return true;
-}
\ No newline at end of file
+}
@@ -4,12 +4,15 @@
 #pragma once
 
 #include <vector>
+#include <deque>
 #include <memory>
-#include <array>
+#include <type_traits>
 #include <cassert>
 #include "ComponentTypeID.h"
 #include "ComponentPool.h"
 #include "View.h"
+#include "OwningGroup.h"
+#include "Group.h"
 
 class EntityManager
 {
@@ -21,9 +24,29 @@ public:
     EntityManager(const EntityManager &) = delete;
     EntityManager &operator=(const EntityManager &) = delete;
 
+    /**
+     * @brief Create an entity, reusing the index of a deleted one once enough are waiting.
+     * Until then indices are handed out in order, so the first entities are 0, 1, 2, ...
+     * @throws std::length_error If all ENTITY_INDEX_MASK indices are taken, by live entities or ones waiting for reuse.
+     */
     EntityID createEntity();
+
+    /**
+     * @brief Remove every component of @p entity and retire its handle.
+     * @return False if @p entity was already deleted or never created.
+     */
     bool deleteEntity(EntityID entity);
 
+    /** @brief True from createEntity() until deleteEntity(); false for that handle after, until its generation wraps around. */
+    bool isAlive(EntityID entity) const
+    {
+        uint32_t slot = getEntityIndex(entity);
+        return slot < mEntities.size() && mEntities[slot] == entity;
+    }
+
+    /** @brief Number of entities alive. */
+    size_t getEntityCount() const { return mEntities.size() - mFreeIndices.size(); }
+
     template <typename T>
     T &addComponent(EntityID entity, const T &component)
     {
@@ -52,10 +75,29 @@ public:
         return static_cast<const ComponentPool<T> *>(mPools[id].get())->has(entity);
     }
 
+    /** @brief One mask test against the entity's signature. False for deleted entities. */
     template <typename T, typename... Args>
     bool hasAllComponents(EntityID entity) const
     {
-        return (hasComponent<T>(entity) && ...);
+        ComponentSignature mask = makeSignature<T, Args...>();
+        return (getSignature(entity) & mask) == mask;
+    }
+
+    /** @brief Bit getComponentTypeID<T>() is set for each component type T of @p entity; empty for deleted entities. */
+    ComponentSignature getSignature(EntityID entity) const
+    {
+        uint32_t slot = getEntityIndex(entity);
+        if (!isAlive(entity) || slot >= mSignatures.size())
+            return {};
+        return mSignatures[slot];
+    }
+
+    template <typename... Components>
+    static ComponentSignature makeSignature()
+    {
+        ComponentSignature signature;
+        (signature.set(getComponentTypeID<Components>()), ...);
+        return signature;
     }
 
     template <typename T>
@@ -70,48 +112,63 @@ public:
         return getPool<T>();
     }
 
+    /** @brief Entities with every one of @p Components; see View. Const component types give const references. */
     template <typename... Components>
-    View<Components...> view() const
+    View<Components...> view()
     {
-        const std::vector<EntityID> *smallest = nullptr;
-        size_t smallestSize = SIZE_MAX;
-        (findSmallestPool<Components>(smallest, smallestSize), ...);
+        return View<Components...>({findPool<std::remove_const_t<Components>>()...}, mSignatures);
+    }
 
-        std::array<const IComponentPool *, sizeof...(Components)> pools = {
-            getPoolPtr<Components>()...
-        };
+    template <typename... Components>
+    View<const Components...> view() const
+    {
+        return View<const Components...>({findPool<std::remove_const_t<Components>>()...}, mSignatures);
+    }
+
+    /**
+     * @brief The owning group of @p Owned, registered on first use; see OwningGroup.
+     *
+     * From then on the entities with all of @p Owned stay packed, in the same order, at the front
+     * of each of their pools. A component type can be owned by one group only, so asking for a group
+     * sharing a type with another one asserts.
+     */
+    template <typename... Owned>
+    Group<Owned...> group()
+    {
+        static_assert(sizeof...(Owned) > 1, "A group owns at least two component types");
+        ComponentSignature mask = makeSignature<Owned...>();
+        typename Group<Owned...>::Pools pools{&getOrCreatePool<Owned>()...};
+
+        const OwningGroup *existing = std::get<0>(pools)->getGroup();
+        assert(((std::get<ComponentPool<Owned> *>(pools)->getGroup() == existing) && ...) &&
+               (!existing || existing->getMask() == mask) && "Component type already owned by another group");
 
-        return View<Components...>(*smallest, pools);
+        if (!existing)
+        {
+            mGroups.push_back(std::make_unique<OwningGroup>(std::vector<IComponentPool *>{std::get<ComponentPool<Owned> *>(pools)...}, mSignatures, mask));
+            (std::get<ComponentPool<Owned> *>(pools)->setGroup(mGroups.back().get()), ...);
+            existing = mGroups.back().get();
+        }
+        return Group<Owned...>(*existing, pools);
     }
 
 private:
     template <typename T>
-    const IComponentPool *getPoolPtr() const
+    ComponentPool<T> *findPool()
     {
         ComponentTypeID id = getComponentTypeID<T>();
         if (id >= mPools.size() || !mPools[id])
             return nullptr;
-        return mPools[id].get();
+        return static_cast<ComponentPool<T> *>(mPools[id].get());
     }
 
     template <typename T>
-    void findSmallestPool(const std::vector<EntityID> *&smallest, size_t &smallestSize) const
+    const ComponentPool<T> *findPool() const
     {
         ComponentTypeID id = getComponentTypeID<T>();
-        if (id < mPools.size() && mPools[id])
-        {
-            size_t s = mPools[id]->size();
-            if (s < smallestSize)
-            {
-                smallestSize = s;
-                smallest = &mPools[id]->entities();
-            }
-        }
-        else
-        {
-            smallestSize = 0;
-            smallest = &mEmptyEntities;
-        }
+        if (id >= mPools.size() || !mPools[id])
+            return nullptr;
+        return static_cast<const ComponentPool<T> *>(mPools[id].get());
     }
 
     template <typename T>
@@ -124,7 +181,9 @@ private:
         }
         if (!mPools[id])
         {
-            mPools[id] = std::make_unique<ComponentPool<T>>();
+            auto pool = std::make_unique<ComponentPool<T>>();
+            pool->trackSignatures(&mSignatures, id);
+            mPools[id] = std::move(pool);
         }
         return *static_cast<ComponentPool<T> *>(mPools[id].get());
     }
@@ -137,9 +196,21 @@ private:
         return *static_cast<const ComponentPool<T> *>(mPools[id].get());
     }
 
-    EntityID mNextEntityID = 0;
+    /**
+     * Deleted indices wait in a FIFO queue and are only reused once this many are waiting, so each
+     * index is recycled at most once per MIN_FREE_INDICES deletions. Generations then take far longer
+     * to wrap around than a stale handle is likely to be kept, while arrays indexed by entity stay
+     * bounded by the peak entity count plus this many.
+     */
+    static constexpr size_t MIN_FREE_INDICES = 1024;
+    static constexpr uint32_t FREE_INDEX = ENTITY_INDEX_MASK; ///< Never given to an entity; marks free slots in mEntities
+
+
+    std::vector<EntityID> mEntities;     ///< Index -> handle of the entity using it (generation included)
+    std::deque<uint32_t> mFreeIndices;   ///< Indices of deleted entities, oldest first
+    std::vector<ComponentSignature> mSignatures; ///< Index -> component types of the entity using it, kept by the pools
     std::vector<std::unique_ptr<IComponentPool>> mPools;
-    std::vector<EntityID> mEmptyEntities;
+    std::vector<std::unique_ptr<OwningGroup>> mGroups;   ///< Registered by group(), pointed to by the pools they own
 };
 
 #endif
@@ -0,0 +1,78 @@
+#ifndef GROUP_H
+#define GROUP_H
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+#include "ComponentPool.h"
+#include "OwningGroup.h"
+
+/**
+ * @brief The entities of an OwningGroup, read straight from the packed front of its pools.
+ *
+ * Entity i of the group is at dense index i of every pool in @p Owned, so nothing is looked up or
+ * tested while iterating. Iterating the group yields EntityIDs; each() yields
+ * (entity, Owned &...) tuples; data() gives the raw arrays for passes over parallel arrays.
+ *
+ * Holds pointers into the EntityManager: adding or removing any of @p Owned while iterating
+ * invalidates the group's order.
+ */
+template <typename... Owned>
+class Group
+{
+public:
+    using Pools = std::tuple<ComponentPool<Owned> *...>;
+    using Tuple = std::tuple<EntityID, Owned &...>;
+
+    Group(const OwningGroup &group, Pools pools) : mGroup(&group), mPools(pools) {}
+
+    /** @brief Number of entities with every one of @p Owned. */
+    size_t size() const { return mGroup->size(); }
+    bool empty() const { return size() == 0; }
+
+    const EntityID *begin() const { return std::get<0>(mPools)->getDenseToEntity().data(); }
+    const EntityID *end() const { return begin() + size(); }
+
+    /** @brief The first size() entries are the group's components of type @p T, in group order. */
+    template <typename T>
+    T *data() const { return std::get<ComponentPool<T> *>(mPools)->getDense().data(); }
+
+    /** @brief The group's entities with their components, for `for (auto [entity, a, b] : group.each())`. */
+    class EachRange
+    {
+    public:
+        struct Iterator
+        {
+            const Group *group;
+            size_t index;
+
+            Iterator &operator++()
+            {
+                ++index;
+                return *this;
+            }
+
+            Tuple operator*() const { return Tuple(group->begin()[index], group->template data<Owned>()[index]...); }
+            bool operator!=(const Iterator &other) const { return index != other.index; }
+            bool operator==(const Iterator &other) const { return index == other.index; }
+        };
+
+        explicit EachRange(const Group &group) : mGroup(group) {}
+
+        Iterator begin() const { return {&mGroup, 0}; }
+        Iterator end() const { return {&mGroup, mGroup.size()}; }
+
+    private:
+        Group mGroup; ///< A copy, so ranges over a temporary group stay valid in range-for
+    };
+
+    EachRange each() const { return EachRange(*this); }
+
+private:
+    const OwningGroup *mGroup;
+    Pools mPools;
+};
+
+#endif
@@ -0,0 +1,48 @@
+#include "OwningGroup.h"
+#include <utility>
+#include "ComponentPool.h"
+
+OwningGroup::OwningGroup(std::vector<IComponentPool *> pools, const std::vector<ComponentSignature> &signatures, ComponentSignature mask)
+    : mPools(std::move(pools)), mSignatures(&signatures), mMask(mask)
+{
+    const IComponentPool *smallest = mPools.front();
+    for (const IComponentPool *pool : mPools)
+    {
+        if (pool->size() < smallest->size())
+            smallest = pool;
+    }
+
+    // Members swapped to the front of the walked pool only trade places with entries already walked
+    for (size_t i = 0; i < smallest->size(); ++i)
+    {
+        EntityID entity = smallest->entities()[i];
+        if (isComplete(entity))
+            moveTo(entity, static_cast<uint32_t>(mSize++));
+    }
+}
+
+void OwningGroup::onAdd(EntityID entity)
+{
+    // The entity lacked the added component until now, so a complete set is a new member
+    if (isComplete(entity))
+        moveTo(entity, static_cast<uint32_t>(mSize++));
+}
+
+void OwningGroup::onRemove(EntityID entity)
+{
+    if (isComplete(entity))
+        moveTo(entity, static_cast<uint32_t>(--mSize));
+}
+
+bool OwningGroup::isComplete(EntityID entity) const
+{
+    return ((*mSignatures)[getEntityIndex(entity)] & mMask) == mMask;
+}
+
+void OwningGroup::moveTo(EntityID entity, uint32_t index)
+{
+    for (IComponentPool *pool : mPools)
+    {
+        pool->swapDense(entity, index);
+    }
+}
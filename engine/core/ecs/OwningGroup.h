@@ -0,0 +1,58 @@
+#ifndef OWNINGGROUP_H
+#define OWNINGGROUP_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ComponentTypeID.h"
+
+class IComponentPool;
+
+/**
+ * @brief Keeps the entities that have every component of a set packed at the front of each of its pools.
+ *
+ * The first size() dense entries of every owned pool belong to the same entities, in the same order,
+ * so iterating them is a linear scan over parallel arrays. The pools call onAdd() and onRemove() as
+ * their components come and go, and each add or remove that completes or breaks the set swaps the
+ * entity across the boundary in every owned pool. A pool belongs to at most one group.
+ */
+class OwningGroup
+{
+public:
+    /**
+     * @brief Own @p pools, packing the entities that already have all of them.
+     * @param signatures The EntityManager's signatures, which the pools keep in step
+     * @param mask Bits of every owned component type
+     */
+    OwningGroup(std::vector<IComponentPool *> pools, const std::vector<ComponentSignature> &signatures, ComponentSignature mask);
+
+    /* Pools hold pointers to their group */
+    OwningGroup(const OwningGroup &) = delete;
+    OwningGroup &operator=(const OwningGroup &) = delete;
+
+    /** @brief Called by an owned pool after adding a component to @p entity and setting its signature bit. */
+    void onAdd(EntityID entity);
+
+    /** @brief Called by an owned pool before removing the component of @p entity, while its signature bit is still set. */
+    void onRemove(EntityID entity);
+
+    /** @brief Number of entities packed at the front of every owned pool. */
+    size_t size() const { return mSize; }
+
+    ComponentSignature getMask() const { return mMask; }
+
+private:
+    bool isComplete(EntityID entity) const;
+
+    /** @brief Swap @p entity with the one at dense @p index in every owned pool. */
+    void moveTo(EntityID entity, uint32_t index);
+
+    std::vector<IComponentPool *> mPools;
+    const std::vector<ComponentSignature> *mSignatures;
+    ComponentSignature mMask;
+    size_t mSize{0}; ///< Entities with every owned component, packed at dense indices [0, mSize)
+};
+
+#endif
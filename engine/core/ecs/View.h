@@ -3,67 +3,155 @@
 
 #pragma once
 
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
-#include <array>
 #include "ComponentPool.h"
 
+/** @brief The pool a view reads @p Component from; read-only when @p Component is const. */
+template <typename Component>
+using ViewPool = std::conditional_t<std::is_const_v<Component>,
+                                    const ComponentPool<std::remove_const_t<Component>>,
+                                    ComponentPool<Component>>;
+
+/**
+ * @brief The entities that have every one of @p Components.
+ *
+ * Walks the entities of the smallest of the pools and keeps those whose signature has the bit of
+ * every component, so matching an entity costs one mask test and no virtual calls. Iterating the
+ * view yields EntityIDs; each() yields (entity, Components &...) tuples read straight from the
+ * typed pools. A const component type gives a const reference.
+ *
+ * Holds pointers into the EntityManager: adding or removing any of @p Components while iterating
+ * invalidates the view.
+ */
 template <typename... Components>
 class View
 {
 public:
-    View(const std::vector<EntityID> &smallest,
-         std::array<const IComponentPool *, sizeof...(Components)> pools)
-        : mSmallest(smallest), mPools(pools) {}
+    using Pools = std::tuple<ViewPool<Components> *...>;
+    using Tuple = std::tuple<EntityID, Components &...>;
+
+    /** @param pools Null for a component no entity has had yet, which leaves the view empty */
+    View(Pools pools, const std::vector<ComponentSignature> &signatures)
+        : mPools(pools), mSignatures(&signatures)
+    {
+        (mMask.set(getComponentTypeID<std::remove_const_t<Components>>()), ...);
+        chooseCandidates(std::index_sequence_for<Components...>{});
+    }
 
     struct Iterator
     {
-        std::array<const IComponentPool *, sizeof...(Components)> pools;
-        typename std::vector<EntityID>::const_iterator it;
-        typename std::vector<EntityID>::const_iterator end;
+        const View *view;
+        size_t index;
 
         Iterator &operator++()
         {
-            ++it;
+            ++index;
             skipNonMatching();
             return *this;
         }
 
-        EntityID operator*() const { return *it; }
-        bool operator!=(const Iterator &other) const { return it != other.it; }
+        EntityID operator*() const { return (*view->mCandidates)[index]; }
+        bool operator!=(const Iterator &other) const { return index != other.index; }
+        bool operator==(const Iterator &other) const { return index == other.index; }
 
         void skipNonMatching()
         {
-            while (it != end && !hasAll(*it))
-                ++it;
+            while (index < view->mCandidates->size() && !view->matches((*view->mCandidates)[index]))
+                ++index;
         }
+    };
 
-    private:
-        bool hasAll(EntityID entity) const
+    Iterator begin() const
+    {
+        Iterator it{this, 0};
+        it.skipNonMatching();
+        return it;
+    }
+
+    Iterator end() const { return {this, mCandidates->size()}; }
+
+    /** @brief The view's entities with their components, for `for (auto [entity, a, b] : view.each())`. */
+    class EachRange
+    {
+    public:
+        struct Iterator
         {
-            for (const IComponentPool *pool : pools)
+            typename View::Iterator it;
+
+            Iterator &operator++()
             {
-                if (!pool || !pool->has(entity))
-                    return false;
+                ++it;
+                return *this;
             }
-            return true;
-        }
+
+            Tuple operator*() const { return it.view->components(it.index, std::index_sequence_for<Components...>{}); }
+            bool operator!=(const Iterator &other) const { return it != other.it; }
+            bool operator==(const Iterator &other) const { return it == other.it; }
+        };
+
+        explicit EachRange(const View &view) : mView(view) {}
+
+        Iterator begin() const { return {mView.begin()}; }
+        Iterator end() const { return {mView.end()}; }
+
+    private:
+        View mView; ///< A copy, so ranges over a temporary view stay valid in range-for
     };
 
-    Iterator begin() const
+    EachRange each() const { return EachRange(*this); }
+
+private:
+    template <size_t... I>
+    void chooseCandidates(std::index_sequence<I...>)
     {
-        Iterator it{mPools, mSmallest.begin(), mSmallest.end()};
-        it.skipNonMatching();
-        return it;
+        static const std::vector<EntityID> NONE;
+        mCandidates = &NONE;
+        if (((std::get<I>(mPools) == nullptr) || ...))
+            return;
+
+        size_t smallest = SIZE_MAX;
+        auto consider = [&](size_t pool, const std::vector<EntityID> &entities)
+        {
+            if (entities.size() < smallest)
+            {
+                smallest = entities.size();
+                mCandidates = &entities;
+                mDriver = pool;
+            }
+        };
+        (consider(I, std::get<I>(mPools)->getDenseToEntity()), ...);
     }
 
-    Iterator end() const
+    bool matches(EntityID entity) const
     {
-        return {mPools, mSmallest.end(), mSmallest.end()};
+        // Candidates come from a pool, so the entity is alive and its slot has a signature
+        return ((*mSignatures)[getEntityIndex(entity)] & mMask) == mMask;
     }
 
-private:
-    const std::vector<EntityID> &mSmallest;
-    std::array<const IComponentPool *, sizeof...(Components)> mPools;
+    template <size_t I>
+    auto &component(size_t index, EntityID entity) const
+    {
+        // The pool being walked already knows the dense index; only the others need a sparse lookup
+        auto *pool = std::get<I>(mPools);
+        return I == mDriver ? pool->getDense()[index] : pool->get(entity);
+    }
+
+    template <size_t... I>
+    Tuple components(size_t index, std::index_sequence<I...>) const
+    {
+        EntityID entity = (*mCandidates)[index];
+        return Tuple(entity, component<I>(index, entity)...);
+    }
+
+    Pools mPools;
+    const std::vector<ComponentSignature> *mSignatures;
+    const std::vector<EntityID> *mCandidates = nullptr; ///< Entities of the smallest pool
+    size_t mDriver = 0;                                 ///< Index in mPools of the smallest pool
+    ComponentSignature mMask;                           ///< Bits of every one of Components
 };
 
 #endif
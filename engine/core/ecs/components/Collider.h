@@ -1,13 +1,15 @@
 #pragma once
 
+#include <cstdint>
 #include <glm/glm.hpp>
 
 namespace ECS
 {
     enum class ColliderType
     {
-        Box,
-        Circle
+        Box,    /**< Axis-aligned box, or an oriented one while the Transform is rotated */
+        Circle,
+        Polygon /**< Convex polygon held by a PolygonShape on the same entity, rotated and scaled with the Transform */
     };
 
     struct Collider
@@ -23,5 +25,15 @@ namespace ECS
         // Common properties
         glm::vec2 offset{0.0f, 0.0f}; /**< Offset from Transform position */
         bool isTrigger{false};        /**< True if collision doesn't block movement */
+
+        // Collision filtering
+        uint32_t category{0x0001};    /**< Layer bits this collider belongs to */
+        uint32_t mask{0xFFFFFFFF};    /**< Layer bits this collider collides with */
     };
+
+    /** @brief Two colliders interact only if each one's category is in the other's mask. */
+    inline bool canCollide(const Collider &a, const Collider &b)
+    {
+        return (a.category & b.mask) != 0 && (b.category & a.mask) != 0;
+    }
 }
\ No newline at end of file
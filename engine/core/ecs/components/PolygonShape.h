@@ -0,0 +1,16 @@
+#pragma once
+
+#include "../../../physics/Polygon.h"
+
+namespace ECS
+{
+    /**
+     * Local-space hull of a ColliderType::Polygon collider, kept apart from Collider so the box and
+     * circle colliders that make up most of the collider pool do not carry it. A polygon collider
+     * without one is treated as a box of its Collider::size.
+     */
+    struct PolygonShape
+    {
+        Math::Polygon polygon; /**< Vertices around the shape centre, with their edge normals. Build it with Math::makePolygon() */
+    };
+}
@@ -4,10 +4,30 @@
 
 namespace ECS
 {
-    struct RigidBody
+    enum class BodyType
     {
-        glm::vec2 velocity{0.0f, 0.0f}; /**< The velocity of the entity in 2D space */
-        float mass{1.0f};               /**< The mass of the entity */
-        float restitution{0.5f};        // 0.0 = no bounce, 1.0 = perfect bounce
+        Static,    /**< Never moves; collides with kinematic and dynamic bodies only */
+        Kinematic, /**< Moved by its velocity only; pushes dynamic bodies but is never pushed */
+        Dynamic    /**< Moved by its velocity and by collision response */
     };
-}
\ No newline at end of file
+
+    /**
+     * @brief RigidBody over any scalar Math.h accepts; the engine uses the float RigidBody below.
+     */
+    template <typename Scalar>
+    struct BasicRigidBody
+    {
+        glm::vec<2, Scalar, glm::defaultp> velocity{Scalar(0), Scalar(0)}; /**< The velocity of the entity in 2D space */
+        Scalar mass{1};                                                     /**< The mass of the entity */
+        Scalar restitution{Scalar(0.5f)};                                   // 0.0 = no bounce, 1.0 = perfect bounce
+        BodyType type{BodyType::Dynamic};                                   /**< How the body takes part in the simulation. Colliders without a RigidBody are static */
+        bool awake{true};                                                   /**< False while the physics step has put the body to sleep. Use PhysicsManager::wakeBody() after changing a sleeping body from code */
+        Scalar sleepTime{0};                                                /**< Seconds the body has spent below the sleep velocity threshold */
+        bool continuous{false};                                             /**< Sweep the body along its velocity against static and sleeping colliders so it cannot tunnel through them. Dynamic bodies only */
+        glm::vec<2, Scalar, glm::defaultp> force{Scalar(0), Scalar(0)};    /**< Force accumulated for the next PhysicsManager::update(), which applies it over every substep and then clears it. Dynamic bodies only */
+        Scalar gravityScale{1};                                             /**< Multiplier of the world gravity for this body. Dynamic bodies only */
+        Scalar linearDamping{0};                                            /**< Velocity is divided by (1 + dt * linearDamping) every step. Dynamic bodies only */
+    };
+
+    using RigidBody = BasicRigidBody<float>;
+}
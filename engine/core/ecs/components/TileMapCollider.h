@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Collider.h"
+
+namespace ECS
+{
+    /** @brief Solid tiles merged into one rectangle: columns [x, x + width) of rows [y, y + height). */
+    struct TileRect
+    {
+        int x{0};
+        int y{0};
+        int width{0};
+        int height{0};
+    };
+
+    /**
+     * Static collision for a grid of square tiles, on one entity instead of one box Collider per tile.
+     * Fill it with TileMap::build() (physics/TileMap.h). The Transform position is the world position of
+     * the min corner of tile (0, 0); columns run along +x and rows along +y. Rotation and scale are ignored.
+     */
+    struct TileMapCollider
+    {
+        static constexpr uint32_t NO_RECT = UINT32_MAX;
+
+        int columns{0};                 /**< Tiles per row */
+        int rows{0};                    /**< Number of rows */
+        float tileSize{1.0f};           /**< World size of one tile */
+        std::vector<TileRect> rects;    /**< Solid tiles, merged into rectangles when the map is built */
+        std::vector<uint32_t> tileRect; /**< Row-major tile -> index into rects, or NO_RECT for an empty tile */
+
+        // Collision filtering, as on Collider
+        uint32_t category{0x0001};      /**< Layer bits the tiles belong to */
+        uint32_t mask{0xFFFFFFFF};      /**< Layer bits the tiles collide with */
+    };
+
+    /** @brief A collider and a tile map interact only if each one's category is in the other's mask. */
+    inline bool canCollide(const Collider &collider, const TileMapCollider &map)
+    {
+        return (collider.category & map.mask) != 0 && (map.category & collider.mask) != 0;
+    }
+}
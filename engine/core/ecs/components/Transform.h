@@ -4,10 +4,16 @@
 
 namespace ECS
 {
-    struct Transform
+    /**
+     * @brief Transform over any scalar Math.h accepts; the engine uses the float Transform below.
+     */
+    template <typename Scalar>
+    struct BasicTransform
     {
-        glm::vec2 position{0.0f, 0.0f}; /**< The position of the entity in 2D space */
-        float rotation{0.0f};           /**< The rotation of the entity in degrees */
-        glm::vec2 scale{1.0f, 1.0f};    /**< The scale of the entity in 2D space */
+        glm::vec<2, Scalar, glm::defaultp> position{Scalar(0), Scalar(0)}; /**< The position of the entity in 2D space */
+        Scalar rotation{0};                                                 /**< The rotation of the entity in degrees */
+        glm::vec<2, Scalar, glm::defaultp> scale{Scalar(1), Scalar(1)};    /**< The scale of the entity in 2D space */
     };
+
+    using Transform = BasicTransform<float>;
 }
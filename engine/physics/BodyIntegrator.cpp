@@ -0,0 +1,121 @@
+#include "BodyIntegrator.h"
+#include "MathBatch.h"
+#include "../core/ecs/EntityManager.h"
+#include "../core/ecs/components/Transform.h"
+
+void BodyIntegrator::clear()
+{
+    mKinematic.clear();
+    mDynamic.clear();
+    mVelocityOnly.clear();
+    refreshTransformIndex();
+}
+
+void BodyIntegrator::refreshTransformIndex()
+{
+    const auto &bodies = mEntityManager->getComponentPool<ECS::RigidBody>();
+    const auto &transforms = mEntityManager->getComponentPool<ECS::Transform>();
+    if (bodies.getVersion() == mBodyVersion && transforms.getVersion() == mTransformVersion)
+        return;
+
+    // Bodies packed by an owning group with Transform are at the same dense index in both pools
+    const OwningGroup *group = bodies.getGroup();
+    size_t grouped = (group && group == transforms.getGroup()) ? group->size() : 0;
+
+    const auto &entities = bodies.getDenseToEntity();
+    mTransformIndex.resize(entities.size());
+    for (size_t i = 0; i < grouped; ++i)
+    {
+        mTransformIndex[i] = static_cast<uint32_t>(i);
+    }
+    for (size_t i = grouped; i < entities.size(); ++i)
+    {
+        mTransformIndex[i] = transforms.has(entities[i]) ? transforms.getDenseIndex(entities[i]) : ComponentPool<ECS::Transform>::INVALID;
+    }
+
+    mBodyVersion = bodies.getVersion();
+    mTransformVersion = transforms.getVersion();
+}
+
+void BodyIntegrator::add(uint32_t bodyIndex, ECS::BodyType type, bool velocityOnly)
+{
+    if (mTransformIndex[bodyIndex] == ComponentPool<ECS::Transform>::INVALID)
+        return;
+
+    if (type == ECS::BodyType::Kinematic)
+        mKinematic.push_back(bodyIndex);
+    else if (type == ECS::BodyType::Dynamic)
+        (velocityOnly ? mVelocityOnly : mDynamic).push_back(bodyIndex);
+}
+
+void BodyIntegrator::integrate(float dt)
+{
+    auto &bodies = mEntityManager->getComponentPool<ECS::RigidBody>().getDense();
+    auto &transforms = mEntityManager->getComponentPool<ECS::Transform>().getDense();
+
+    mBodies.clear();
+    mBodies.insert(mBodies.end(), mKinematic.begin(), mKinematic.end());
+    mBodies.insert(mBodies.end(), mDynamic.begin(), mDynamic.end());
+    mBodies.insert(mBodies.end(), mVelocityOnly.begin(), mVelocityOnly.end());
+
+    size_t count = mBodies.size();
+    if (count == 0)
+        return;
+
+    mTransforms.resize(count);
+    for (std::vector<float> *array : {&mPositionX, &mPositionY, &mVelocityX, &mVelocityY,
+                                      &mForceX, &mForceY, &mInverseMass, &mGravityScale, &mLinearDamping})
+    {
+        array->resize(count);
+    }
+
+    // Gather. Kinematic bodies only need their position and velocity
+    for (size_t i = 0; i < count; ++i)
+    {
+        const ECS::RigidBody &body = bodies[mBodies[i]];
+        mTransforms[i] = mTransformIndex[mBodies[i]];
+        const ECS::Transform &transform = transforms[mTransforms[i]];
+
+        mPositionX[i] = transform.position.x;
+        mPositionY[i] = transform.position.y;
+        mVelocityX[i] = body.velocity.x;
+        mVelocityY[i] = body.velocity.y;
+        if (i < mKinematic.size())
+            continue;
+
+        mForceX[i] = body.force.x;
+        mForceY[i] = body.force.y;
+        mInverseMass[i] = 1.0f / body.mass;
+        mGravityScale[i] = body.gravityScale;
+        mLinearDamping[i] = body.linearDamping;
+    }
+
+    Math::BodySoA soa{mPositionX.data(), mPositionY.data(), mVelocityX.data(), mVelocityY.data(),
+                      mForceX.data(), mForceY.data(), mInverseMass.data(), mGravityScale.data(), mLinearDamping.data()};
+
+    size_t first = mKinematic.size();
+    Math::BodySoA dynamic{soa.positionX + first, soa.positionY + first, soa.velocityX + first, soa.velocityY + first,
+                          soa.forceX + first, soa.forceY + first, soa.inverseMass + first, soa.gravityScale + first, soa.linearDamping + first};
+    Math::integrateVelocitiesBatch(dynamic, count - first, mGravity, dt);
+
+    size_t moved = mKinematic.size() + mDynamic.size();
+    Math::integratePositionsBatch(soa, moved, dt);
+
+    // Scatter
+    for (size_t i = 0; i < moved; ++i)
+    {
+        transforms[mTransforms[i]].position = glm::vec2(mPositionX[i], mPositionY[i]);
+    }
+    for (size_t i = first; i < count; ++i)
+    {
+        bodies[mBodies[i]].velocity = glm::vec2(mVelocityX[i], mVelocityY[i]);
+    }
+}
+
+void BodyIntegrator::clearForces()
+{
+    for (ECS::RigidBody &body : mEntityManager->getComponentPool<ECS::RigidBody>().getDense())
+    {
+        body.force = glm::vec2(0.0f, 0.0f);
+    }
+}
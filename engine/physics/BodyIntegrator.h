@@ -0,0 +1,76 @@
+#ifndef BODYINTEGRATOR_H
+#define BODYINTEGRATOR_H
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "../core/ecs/ComponentTypeID.h"
+#include "../core/ecs/components/RigidBody.h"
+
+class EntityManager;
+
+/**
+ * @class BodyIntegrator
+ * @brief Integrates the bodies queued for a physics step as one structure-of-arrays pass.
+ *
+ * Bodies are queued by RigidBody dense index. Each one is paired with its Transform through a
+ * table of Transform dense indices, rebuilt only when either pool gains or loses a component,
+ * so a step does no per-body sparse lookups. When both pools belong to the same owning group
+ * (PhysicsManager registers one), the grouped bodies map to their own index, so gathering and
+ * scattering walk the two dense arrays in step. Queued bodies are copied into parallel arrays,
+ * run through Math::integrateVelocitiesBatch and Math::integratePositionsBatch, and copied back.
+ */
+class BodyIntegrator
+{
+public:
+    BodyIntegrator(EntityManager *entityManager) : mEntityManager(entityManager) {};
+
+    /* Delete copy constructor and assignment operator */
+    BodyIntegrator(const BodyIntegrator &) = delete;
+    BodyIntegrator &operator=(const BodyIntegrator &) = delete;
+
+    /** @brief Acceleration applied to every dynamic body, scaled by its gravityScale. Defaults to none. */
+    void setGravity(const glm::vec2 &gravity) { mGravity = gravity; }
+    const glm::vec2 &getGravity() const { return mGravity; }
+
+    /** @brief Drop the bodies queued for the last step. */
+    void clear();
+
+    /**
+     * @brief Queue the body at RigidBody dense index @p bodyIndex for the next integrate().
+     * Kinematic bodies only move; dynamic bodies are accelerated, damped and moved, unless
+     * @p velocityOnly, which leaves moving them to the caller (continuous bodies).
+     * Bodies without a Transform are ignored.
+     */
+    void add(uint32_t bodyIndex, ECS::BodyType type, bool velocityOnly = false);
+
+    /** @brief Advance every queued body by @p dt and write the results back to the components. */
+    void integrate(float dt);
+
+    /** @brief Reset the accumulated force of every RigidBody. */
+    void clearForces();
+
+private:
+    /** @brief Rebuild mTransformIndex if the RigidBody or Transform pool changed since it was built. */
+    void refreshTransformIndex();
+
+    EntityManager *mEntityManager;          ///< Pointer to the EntityManager whose pools are integrated
+    glm::vec2 mGravity{0.0f, 0.0f};         ///< World gravity, see setGravity()
+    std::vector<uint32_t> mTransformIndex;  ///< RigidBody dense index -> Transform dense index (or INVALID)
+    uint64_t mBodyVersion{UINT64_MAX};      ///< RigidBody pool version mTransformIndex was built for
+    uint64_t mTransformVersion{UINT64_MAX}; ///< Transform pool version mTransformIndex was built for
+
+    std::vector<uint32_t> mKinematic;       ///< Queued kinematic bodies, as RigidBody dense indices
+    std::vector<uint32_t> mDynamic;         ///< Queued dynamic bodies that are moved here
+    std::vector<uint32_t> mVelocityOnly;    ///< Queued dynamic bodies whose velocity only is integrated
+
+    // Per-step parallel arrays, ordered kinematic, dynamic, velocity-only
+    std::vector<uint32_t> mBodies;
+    std::vector<uint32_t> mTransforms;
+    std::vector<float> mPositionX, mPositionY, mVelocityX, mVelocityY;
+    std::vector<float> mForceX, mForceY, mInverseMass, mGravityScale, mLinearDamping;
+};
+
+#endif
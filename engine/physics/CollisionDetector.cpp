@@ -1,13 +1,17 @@
 #include "CollisionDetector.h"
+
+#include <cmath>
+
 #include "../core/ecs/EntityManager.h"
 #include "../core/ecs/components/Collider.h"
+#include "../core/ecs/components/PolygonShape.h"
 #include "../core/ecs/components/Transform.h"
 
 CollisionDetector::~CollisionDetector()
 {
 }
 
-Math::AABB CollisionDetector::getColliderAABB(EntityID entity, ECS::Collider collider)
+Math::AABB CollisionDetector::getColliderAABB(EntityID entity, const ECS::Collider &collider) const
 {
     Math::AABB aabb;
 
@@ -15,35 +19,180 @@ Math::AABB CollisionDetector::getColliderAABB(EntityID entity, ECS::Collider col
     const auto &transform = mEntityManager->getComponent<ECS::Transform>(entity);
     glm::vec2 center = transform.position + collider.offset;
 
-    glm::vec2 halfSize = (collider.size * transform.scale) * 0.5f;
+    // Oriented shapes are bounded by their world polygon
+    ShapeFrame frame{Math::makeRotation(transform.rotation), transform.scale};
+    if (isOriented(collider, frame))
+    {
+        Math::Polygon polygon;
+        placePolygon(collider, findLocalPolygon(entity, collider), center, frame, polygon);
+        return Math::polygonAABB(polygon);
+    }
+
+    // Circles are bounded by their radius, boxes by their scaled size
+    glm::vec2 halfSize = (collider.type == ECS::ColliderType::Circle)
+                             ? glm::vec2(collider.radius, collider.radius)
+                             : (collider.size * transform.scale) * 0.5f;
     aabb.min = center - halfSize;
     aabb.max = center + halfSize;
 
     return aabb;
 }
 
-Math::CollisionResult CollisionDetector::checkCollision(EntityID entityA, EntityID entityB)
+bool CollisionDetector::getWorldPolygon(EntityID entity, const ECS::Collider &collider, Math::Polygon &polygon) const
+{
+    const auto &transform = mEntityManager->getComponent<ECS::Transform>(entity);
+    ShapeFrame frame{Math::makeRotation(transform.rotation), transform.scale};
+    if (!isOriented(collider, frame))
+        return false;
+
+    placePolygon(collider, findLocalPolygon(entity, collider), transform.position + collider.offset, frame, polygon);
+    return true;
+}
+
+bool CollisionDetector::isOriented(const ECS::Collider &collider, const ShapeFrame &frame)
+{
+    return collider.type == ECS::ColliderType::Polygon ||
+           (collider.type == ECS::ColliderType::Box && frame.rotation.sine != 0.0f);
+}
+
+const Math::Polygon *CollisionDetector::findLocalPolygon(EntityID entity, const ECS::Collider &collider) const
 {
-    Math::CollisionResult result;
+    if (collider.type != ECS::ColliderType::Polygon || !mEntityManager->hasComponent<ECS::PolygonShape>(entity))
+        return nullptr;
+    return &mEntityManager->getComponent<ECS::PolygonShape>(entity).polygon;
+}
 
+void CollisionDetector::placePolygon(const ECS::Collider &collider, const Math::Polygon *local, const glm::vec2 &center, const ShapeFrame &frame, Math::Polygon &polygon)
+{
+    if (!local)
+    {
+        // Scaling the box up front leaves its axis-aligned normals valid, so the transform only rotates them
+        glm::vec2 size = collider.size * frame.scale;
+        Math::transformPolygon(Math::makeBox(glm::vec2(std::fabs(size.x), std::fabs(size.y)) * 0.5f), center, frame.rotation,
+                               glm::vec2(1.0f, 1.0f), polygon);
+        return;
+    }
+
+    Math::transformPolygon(*local, center, frame.rotation, frame.scale, polygon);
+}
+
+void CollisionDetector::updateWorldAABBs(const ComponentPool<ECS::Collider> &colliders)
+{
+    mColliders = &colliders;
+    mWorldEntities = colliders.getDenseToEntity();
+
+    size_t count = mWorldEntities.size();
+    mWorldAABBs.resize(count);
+    mWorldCenters.resize(count);
+    mWorldFrames.resize(count);
+
+    const auto &dense = colliders.getDense();
+    for (size_t i = 0; i < count; ++i)
+    {
+        EntityID entity = mWorldEntities[i];
+        if (!mEntityManager->hasComponent<ECS::Transform>(entity))
+        {
+            mWorldAABBs[i] = Math::AABB{};
+            mWorldCenters[i] = {0.0f, 0.0f};
+            mWorldFrames[i] = ShapeFrame{};
+            continue;
+        }
+
+        const auto &transform = mEntityManager->getComponent<ECS::Transform>(entity);
+        mWorldAABBs[i] = getColliderAABB(entity, dense[i]);
+        mWorldCenters[i] = transform.position + dense[i].offset;
+        mWorldFrames[i] = ShapeFrame{Math::makeRotation(transform.rotation), transform.scale};
+    }
+}
+
+void CollisionDetector::refreshWorldAABB(EntityID entity)
+{
+    uint32_t index = mColliders->getDenseIndex(entity);
+    const ECS::Collider &collider = mColliders->getDense()[index];
+    const auto &transform = mEntityManager->getComponent<ECS::Transform>(entity);
+    mWorldAABBs[index] = getColliderAABB(entity, collider);
+    mWorldCenters[index] = transform.position + collider.offset;
+    mWorldFrames[index] = ShapeFrame{Math::makeRotation(transform.rotation), transform.scale};
+}
+
+Math::CollisionResult CollisionDetector::checkCollision(EntityID entityA, EntityID entityB) const
+{
     if (!mEntityManager->hasComponent<ECS::Collider>(entityA) || !mEntityManager->hasComponent<ECS::Collider>(entityB))
     {
-        return result;
+        return Math::CollisionResult{};
     }
 
     const auto &colliderA = mEntityManager->getComponent<ECS::Collider>(entityA);
     const auto &colliderB = mEntityManager->getComponent<ECS::Collider>(entityB);
+    const auto &transformA = mEntityManager->getComponent<ECS::Transform>(entityA);
+    const auto &transformB = mEntityManager->getComponent<ECS::Transform>(entityB);
+    ShapeFrame frameA{Math::makeRotation(transformA.rotation), transformA.scale};
+    ShapeFrame frameB{Math::makeRotation(transformB.rotation), transformB.scale};
+
+    return resolve(colliderA, findLocalPolygon(entityA, colliderA), getColliderAABB(entityA, colliderA), transformA.position + colliderA.offset, frameA,
+                   colliderB, findLocalPolygon(entityB, colliderB), getColliderAABB(entityB, colliderB), transformB.position + colliderB.offset, frameB);
+}
+
+Math::CollisionResult CollisionDetector::checkCachedCollision(EntityID entityA, EntityID entityB) const
+{
+    const auto &dense = mColliders->getDense();
+    uint32_t indexA = mColliders->getDenseIndex(entityA);
+    uint32_t indexB = mColliders->getDenseIndex(entityB);
+
+    return resolve(dense[indexA], findLocalPolygon(entityA, dense[indexA]), mWorldAABBs[indexA], mWorldCenters[indexA], mWorldFrames[indexA],
+                   dense[indexB], findLocalPolygon(entityB, dense[indexB]), mWorldAABBs[indexB], mWorldCenters[indexB], mWorldFrames[indexB]);
+}
+
+Math::CollisionResult CollisionDetector::checkCachedCollision(EntityID entity, const Math::AABB &box) const
+{
+    uint32_t index = mColliders->getDenseIndex(entity);
+
+    ECS::Collider boxCollider;
+    boxCollider.type = ECS::ColliderType::Box;
+    boxCollider.size = box.max - box.min;
+
+    const ECS::Collider &collider = mColliders->getDense()[index];
+    return resolve(collider, findLocalPolygon(entity, collider), mWorldAABBs[index], mWorldCenters[index], mWorldFrames[index],
+                   boxCollider, nullptr, box, (box.min + box.max) * 0.5f, ShapeFrame{});
+}
+
+Math::CollisionResult CollisionDetector::resolve(const ECS::Collider &colliderA, const Math::Polygon *localA, const Math::AABB &aabbA, const glm::vec2 &centerA, const ShapeFrame &frameA,
+                                                 const ECS::Collider &colliderB, const Math::Polygon *localB, const Math::AABB &aabbB, const glm::vec2 &centerB, const ShapeFrame &frameB)
+{
+    bool orientedA = isOriented(colliderA, frameA);
+    bool orientedB = isOriented(colliderB, frameB);
+    if (orientedA || orientedB)
+    {
+        // An unrotated box still takes part as a polygon: placePolygon() only needs its size
+        bool circleA = colliderA.type == ECS::ColliderType::Circle;
+        bool circleB = colliderB.type == ECS::ColliderType::Circle;
+        if (!circleA && !circleB)
+        {
+            Math::Polygon polygonA;
+            Math::Polygon polygonB;
+            placePolygon(colliderA, localA, centerA, frameA, polygonA);
+            placePolygon(colliderB, localB, centerB, frameB, polygonB);
+            return Math::collidePolygons(polygonA, polygonB);
+        }
+
+        Math::Polygon polygon;
+        placePolygon(circleA ? colliderB : colliderA, circleA ? localB : localA, circleA ? centerB : centerA, circleA ? frameB : frameA, polygon);
+        Math::CollisionResult result = Math::collidePolygonCircle(polygon, circleA ? centerA : centerB, circleA ? colliderA.radius : colliderB.radius);
+
+        // Same convention as the AABB-circle case below: flip when A is the polygon
+        if (!circleA && result.isColliding)
+        {
+            result.normal = -result.normal;
+        }
+        return result;
+    }
 
     if (colliderA.type == ECS::ColliderType::Box && colliderB.type == ECS::ColliderType::Box)
     {
-        Math::AABB aabbA = getColliderAABB(entityA, colliderA);
-        Math::AABB aabbB = getColliderAABB(entityB, colliderB);
         return Math::resolveAABBCollision(aabbA, aabbB);
     }
     else if (colliderA.type == ECS::ColliderType::Circle && colliderB.type == ECS::ColliderType::Circle)
     {
-        glm::vec2 centerA = mEntityManager->getComponent<ECS::Transform>(entityA).position + colliderA.offset;
-        glm::vec2 centerB = mEntityManager->getComponent<ECS::Transform>(entityB).position + colliderB.offset;
         return Math::resolveCircleCollision(centerA, colliderA.radius, centerB, colliderB.radius);
     }
     else
@@ -51,15 +200,11 @@ Math::CollisionResult CollisionDetector::checkCollision(EntityID entityA, Entity
         // Determine which is box and which is circle
         bool aIsBox = (colliderA.type == ECS::ColliderType::Box);
 
-        EntityID boxEntity = aIsBox ? entityA : entityB;
-        EntityID circleEntity = aIsBox ? entityB : entityA;
-        const auto &boxCollider = aIsBox ? colliderA : colliderB;
-        const auto &circleCollider = aIsBox ? colliderB : colliderA;
-
-        Math::AABB aabb = getColliderAABB(boxEntity, boxCollider);
-        glm::vec2 circleCenter = mEntityManager->getComponent<ECS::Transform>(circleEntity).position + circleCollider.offset;
+        const Math::AABB &aabb = aIsBox ? aabbA : aabbB;
+        const glm::vec2 &circleCenter = aIsBox ? centerB : centerA;
+        float radius = aIsBox ? colliderB.radius : colliderA.radius;
 
-        result = Math::resolveAABBCircleCollision(aabb, circleCenter, circleCollider.radius);
+        Math::CollisionResult result = Math::resolveAABBCircleCollision(aabb, circleCenter, radius);
 
         // resolveAABBCircleCollision returns normal pointing from AABB toward circle.
         // If A is the box, we need to flip so normal pushes A away from B.
@@ -70,4 +215,4 @@ Math::CollisionResult CollisionDetector::checkCollision(EntityID entityA, Entity
 
         return result;
     }
-}
\ No newline at end of file
+}
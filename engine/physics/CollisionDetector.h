@@ -3,29 +3,104 @@
 
 #pragma once
 
+#include <vector>
 #include <glm/glm.hpp>
 #include "../core/ecs/ComponentTypeID.h"
+#include "../core/ecs/ComponentPool.h"
 #include "../core/ecs/components/Collider.h"
 #include "Math.h"
+#include "Polygon.h"
 
 class EntityManager;
 
 class CollisionDetector
 {
 public:
-    CollisionDetector(EntityManager *entityManager) : mEntityManager(entityManager) {};
+    CollisionDetector(const EntityManager *entityManager) : mEntityManager(entityManager) {};
     ~CollisionDetector();
 
     /* Delete copy constructor and assignment operator */
     CollisionDetector(const CollisionDetector &) = delete;
     CollisionDetector &operator=(const CollisionDetector &) = delete;
 
-    Math::AABB getColliderAABB(EntityID entity, ECS::Collider collider);
+    /** @brief World bounds of @p collider on @p entity, computed from its current Transform. */
+    Math::AABB getColliderAABB(EntityID entity, const ECS::Collider &collider) const;
 
-    Math::CollisionResult checkCollision(EntityID entityA, EntityID entityB);
+    /**
+     * @brief World-space polygon of an oriented collider: a polygon, or a box on a rotated Transform.
+     * @return False for circles and unrotated boxes, whose bounds and centre describe them exactly
+     */
+    bool getWorldPolygon(EntityID entity, const ECS::Collider &collider, Math::Polygon &polygon) const;
+
+    /** @brief Narrow-phase test of one pair. Only reads components, so pairs can be tested from several threads at once. */
+    Math::CollisionResult checkCollision(EntityID entityA, EntityID entityB) const;
+
+    /**
+     * @brief Compute the world bounds of every collider in one pass over @p colliders.
+     *
+     * Bounds are stored contiguously in the pool's dense order, so index i belongs to
+     * colliders.getDenseToEntity()[i]. Colliders without a Transform get empty bounds at the origin.
+     * The cache stays valid until a collider is added or removed, or a collider entity moves.
+     */
+    void updateWorldAABBs(const ComponentPool<ECS::Collider> &colliders);
+
+    /** @brief Recompute the cached bounds of one collider after its entity moved. */
+    void refreshWorldAABB(EntityID entity);
+
+    /** @brief Cached bounds of a collider entity. */
+    const Math::AABB &getWorldAABB(EntityID entity) const { return mWorldAABBs[mColliders->getDenseIndex(entity)]; }
+
+    /** @brief Cached shape centre (position + offset) of a collider entity. */
+    const glm::vec2 &getWorldCenter(EntityID entity) const { return mWorldCenters[mColliders->getDenseIndex(entity)]; }
+
+    /** @brief Every cached bound, indexed by dense collider index. */
+    const std::vector<Math::AABB> &getWorldAABBs() const { return mWorldAABBs; }
+
+    /** @brief Entity of each cached bound, as the collider pool was ordered when the cache was built. */
+    const std::vector<EntityID> &getWorldAABBEntities() const { return mWorldEntities; }
+
+    /** @brief Same as checkCollision() but reads the bounds from the cache; both entities must have a collider. */
+    Math::CollisionResult checkCachedCollision(EntityID entityA, EntityID entityB) const;
+
+    /**
+     * @brief Test the cached collider of @p entity against a static box that is not an entity, such as a tile map rectangle.
+     * @return Normal pushing the entity away from the box
+     */
+    Math::CollisionResult checkCachedCollision(EntityID entity, const Math::AABB &box) const;
 
 private:
-    EntityManager *mEntityManager;
+    /** @brief Rotation and scale a collider's shape is placed with, taken from its Transform. */
+    struct ShapeFrame
+    {
+        Math::Rotation rotation;
+        glm::vec2 scale{1.0f, 1.0f};
+    };
+
+    /** @brief Whether a collider needs the polygon tests: always for polygons, for boxes while rotated. */
+    static bool isOriented(const ECS::Collider &collider, const ShapeFrame &frame);
+
+    /** @brief The PolygonShape hull of a polygon collider on @p entity; null for other shapes or if it has none. */
+    const Math::Polygon *findLocalPolygon(EntityID entity, const ECS::Collider &collider) const;
+
+    /**
+     * @brief World polygon of an oriented collider whose shape centre is @p center.
+     * @param local Hull from findLocalPolygon(); boxes, and polygons without one, use the collider size
+     */
+    static void placePolygon(const ECS::Collider &collider, const Math::Polygon *local, const glm::vec2 &center, const ShapeFrame &frame, Math::Polygon &polygon);
+
+    /**
+     * @brief Dispatch on the collider shapes. Unrotated boxes use @p aabb, circles @p center, and any pair
+     * with an oriented collider goes through the SAT tests of Polygon.h.
+     */
+    static Math::CollisionResult resolve(const ECS::Collider &colliderA, const Math::Polygon *localA, const Math::AABB &aabbA, const glm::vec2 &centerA, const ShapeFrame &frameA,
+                                         const ECS::Collider &colliderB, const Math::Polygon *localB, const Math::AABB &aabbB, const glm::vec2 &centerB, const ShapeFrame &frameB);
+
+    const EntityManager *mEntityManager;                    ///< Read-only: the const accessors never create pools
+    const ComponentPool<ECS::Collider> *mColliders{nullptr}; ///< Pool the cache was built from
+    std::vector<Math::AABB> mWorldAABBs;                    ///< Dense collider index -> world bounds, rebuilt by updateWorldAABBs()
+    std::vector<glm::vec2> mWorldCenters;                   ///< Dense collider index -> shape centre
+    std::vector<ShapeFrame> mWorldFrames;                   ///< Dense collider index -> rotation and scale
+    std::vector<EntityID> mWorldEntities;                   ///< Dense collider index -> entity when the cache was built
 };
 
-#endif
\ No newline at end of file
+#endif
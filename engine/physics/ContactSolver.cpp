@@ -0,0 +1,169 @@
+#include "ContactSolver.h"
+#include "../core/ecs/EntityManager.h"
+
+#include <algorithm>
+
+void ContactSolver::setIterations(int velocityIterations, int positionIterations)
+{
+    mVelocityIterations = std::max(1, velocityIterations);
+    mPositionIterations = std::max(1, positionIterations);
+}
+
+void ContactSolver::setWarmStarting(bool enabled)
+{
+    mWarmStarting = enabled;
+    if (!enabled)
+        mCache.clear();
+}
+
+float ContactSolver::getCachedImpulse(const CollisionPair &pair) const
+{
+    auto it = std::lower_bound(mCache.begin(), mCache.end(), pair, [](const std::pair<CollisionPair, float> &entry, const CollisionPair &key)
+                               { return entry.first < key; });
+    return (it != mCache.end() && it->first == pair) ? it->second : 0.0f;
+}
+
+glm::vec2 ContactSolver::velocityOf(const ECS::RigidBody *body)
+{
+    return body ? body->velocity : glm::vec2(0.0f, 0.0f);
+}
+
+void ContactSolver::solve(const std::vector<Contact> &contacts)
+{
+    prepare(contacts);
+
+    if (mWarmStarting)
+        warmStart();
+
+    for (int i = 0; i < mVelocityIterations; ++i)
+    {
+        solveVelocities();
+    }
+
+    for (int i = 0; i < mPositionIterations; ++i)
+    {
+        solvePositions();
+    }
+
+    // Keep this tick's impulses for the contacts that persist into the next one
+    mCache.clear();
+    if (mWarmStarting)
+    {
+        for (const Constraint &constraint : mConstraints)
+        {
+            mCache.emplace_back(constraint.pair, constraint.normalImpulse);
+        }
+    }
+}
+
+void ContactSolver::prepare(const std::vector<Contact> &contacts)
+{
+    auto &bodies = mEntityManager->getComponentPool<ECS::RigidBody>();
+    auto &transforms = mEntityManager->getComponentPool<ECS::Transform>();
+
+    mConstraints.clear();
+    for (const Contact &contact : contacts)
+    {
+        Constraint constraint;
+        constraint.pair = contact.first;
+        constraint.normal = contact.second.normal;
+        constraint.penetration = contact.second.penetration;
+        constraint.transformA = &transforms.get(contact.first.entityA);
+        constraint.transformB = &transforms.get(contact.first.entityB);
+        constraint.startA = constraint.transformA->position;
+        constraint.startB = constraint.transformB->position;
+
+        float restitution = 1.0f;
+        bool anyRestitution = false;
+        auto setup = [&](EntityID entity, ECS::RigidBody *&body, float &inverseMass)
+        {
+            if (!bodies.has(entity))
+                return;
+
+            ECS::RigidBody &rigidBody = bodies.get(entity);
+            restitution = std::min(restitution, rigidBody.restitution);
+            anyRestitution = true;
+
+            if (rigidBody.type == ECS::BodyType::Static)
+                return;
+
+            // Kinematic bodies move the contact with their velocity but are never pushed
+            body = &rigidBody;
+            inverseMass = rigidBody.type == ECS::BodyType::Dynamic ? 1.0f / rigidBody.mass : 0.0f;
+        };
+        setup(contact.first.entityA, constraint.bodyA, constraint.inverseMassA);
+        setup(contact.first.entityB, constraint.bodyB, constraint.inverseMassB);
+
+        float totalInverseMass = constraint.inverseMassA + constraint.inverseMassB;
+        if (totalInverseMass == 0.0f)
+            continue; // Neither side can move
+
+        constraint.normalMass = 1.0f / totalInverseMass;
+
+        float normalVelocity = glm::dot(velocityOf(constraint.bodyA) - velocityOf(constraint.bodyB), constraint.normal);
+        if (anyRestitution && normalVelocity < -RESTITUTION_THRESHOLD)
+            constraint.velocityBias = -restitution * normalVelocity;
+
+        mConstraints.push_back(constraint);
+    }
+}
+
+void ContactSolver::warmStart()
+{
+    // Contacts and cache are both sorted by pair, so one forward walk matches them up
+    auto cached = mCache.begin();
+    for (Constraint &constraint : mConstraints)
+    {
+        while (cached != mCache.end() && cached->first < constraint.pair)
+            ++cached;
+        if (cached == mCache.end() || !(cached->first == constraint.pair))
+            continue;
+
+        // Step past the entry so a pair listed again picks up its next one
+        constraint.normalImpulse = (cached++)->second;
+        glm::vec2 impulse = constraint.normal * constraint.normalImpulse;
+        if (constraint.bodyA)
+            constraint.bodyA->velocity += impulse * constraint.inverseMassA;
+        if (constraint.bodyB)
+            constraint.bodyB->velocity -= impulse * constraint.inverseMassB;
+    }
+}
+
+void ContactSolver::solveVelocities()
+{
+    for (Constraint &constraint : mConstraints)
+    {
+        float normalVelocity = glm::dot(velocityOf(constraint.bodyA) - velocityOf(constraint.bodyB), constraint.normal);
+        float lambda = constraint.normalMass * (constraint.velocityBias - normalVelocity);
+
+        // Clamp the accumulated impulse, not this iteration's, so earlier overshoot can be taken back
+        float accumulated = std::max(constraint.normalImpulse + lambda, 0.0f);
+        lambda = accumulated - constraint.normalImpulse;
+        constraint.normalImpulse = accumulated;
+
+        glm::vec2 impulse = constraint.normal * lambda;
+        if (constraint.bodyA)
+            constraint.bodyA->velocity += impulse * constraint.inverseMassA;
+        if (constraint.bodyB)
+            constraint.bodyB->velocity -= impulse * constraint.inverseMassB;
+    }
+}
+
+void ContactSolver::solvePositions()
+{
+    for (Constraint &constraint : mConstraints)
+    {
+        // Penetration left once the corrections applied so far (by any contact) are accounted for
+        glm::vec2 movedA = constraint.transformA->position - constraint.startA;
+        glm::vec2 movedB = constraint.transformB->position - constraint.startB;
+        float penetration = constraint.penetration - glm::dot(movedA - movedB, constraint.normal);
+
+        float correction = DEFAULT_POSITION_CORRECTION * (penetration - DEFAULT_SLOP);
+        if (correction <= 0.0f)
+            continue;
+
+        glm::vec2 push = constraint.normal * (correction * constraint.normalMass);
+        constraint.transformA->position += push * constraint.inverseMassA;
+        constraint.transformB->position -= push * constraint.inverseMassB;
+    }
+}
@@ -0,0 +1,104 @@
+#ifndef CONTACTSOLVER_H
+#define CONTACTSOLVER_H
+
+#pragma once
+
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+#include "broadphase/IBroadPhase.h"
+#include "Math.h"
+#include "../core/ecs/components/RigidBody.h"
+#include "../core/ecs/components/Transform.h"
+
+class EntityManager;
+
+/** @brief A colliding pair and its narrow-phase result, as handed to the ContactSolver. */
+using Contact = std::pair<CollisionPair, Math::CollisionResult>;
+
+/**
+ * @class ContactSolver
+ * @brief Sequential-impulse solver over every contact of a tick.
+ *
+ * Velocities are solved first: each iteration applies, contact by contact, the normal
+ * impulse that cancels the approach speed (plus restitution), while clamping the impulse
+ * accumulated over the tick to be non-negative so contacts only ever push. Positions are
+ * then corrected over a few iterations, each removing a fraction of the remaining
+ * penetration beyond a small slop.
+ *
+ * The impulse accumulated on each pair is cached for the next tick. A contact that
+ * persists starts from it (warm starting), so a resting stack begins the tick already
+ * close to its solution and converges in a few iterations.
+ *
+ * Bodies without a RigidBody, and static or kinematic bodies, have infinite mass.
+ */
+class ContactSolver
+{
+public:
+    static constexpr int DEFAULT_VELOCITY_ITERATIONS = 8;
+    static constexpr int DEFAULT_POSITION_ITERATIONS = 4;
+    static constexpr float DEFAULT_POSITION_CORRECTION = 0.8f; ///< Fraction of the remaining penetration removed per position iteration
+    static constexpr float DEFAULT_SLOP = 0.005f;               ///< Penetration left uncorrected so resting contacts persist between ticks
+    static constexpr float RESTITUTION_THRESHOLD = 1.0f;        ///< Approach speed below which contacts do not bounce, so resting bodies settle
+
+    ContactSolver(EntityManager *entityManager) : mEntityManager(entityManager) {};
+    ~ContactSolver() = default;
+
+    /* Delete copy constructor and assignment operator */
+    ContactSolver(const ContactSolver &) = delete;
+    ContactSolver &operator=(const ContactSolver &) = delete;
+
+    /** @brief Set the number of velocity and position iterations run by each solve(). Values below 1 are raised to 1. */
+    void setIterations(int velocityIterations, int positionIterations);
+    int getVelocityIterations() const { return mVelocityIterations; }
+    int getPositionIterations() const { return mPositionIterations; }
+
+    /** @brief Enable or disable starting persistent contacts from last tick's impulse. Disabling drops the cache. */
+    void setWarmStarting(bool enabled);
+    bool isWarmStarting() const { return mWarmStarting; }
+
+    /**
+     * @brief Resolve every contact of the tick, updating velocities then positions.
+     * @param contacts Colliding pairs sorted by pair. A pair listed several times (a body against several
+     * rectangles of a tile map) is warm started entry by entry, in the order it is listed
+     */
+    void solve(const std::vector<Contact> &contacts);
+
+    /** @brief Impulse accumulated on @p pair by the last solve() (its first entry, if listed several times), or 0 if the pair was not in contact. */
+    float getCachedImpulse(const CollisionPair &pair) const;
+
+private:
+    struct Constraint
+    {
+        CollisionPair pair;
+        ECS::Transform *transformA{nullptr};
+        ECS::Transform *transformB{nullptr};
+        ECS::RigidBody *bodyA{nullptr}; ///< Null when A does not take velocity (no RigidBody or static)
+        ECS::RigidBody *bodyB{nullptr}; ///< Null when B does not take velocity (no RigidBody or static)
+        glm::vec2 startA{0.0f, 0.0f};   ///< Position of A before position correction
+        glm::vec2 startB{0.0f, 0.0f};   ///< Position of B before position correction
+        glm::vec2 normal{0.0f, 0.0f};   ///< Pushes A away from B
+        float penetration{0.0f};        ///< Depth reported by the narrow-phase
+        float inverseMassA{0.0f};
+        float inverseMassB{0.0f};
+        float normalMass{0.0f};         ///< 1 / (inverseMassA + inverseMassB)
+        float velocityBias{0.0f};       ///< Separation speed restitution asks for
+        float normalImpulse{0.0f};      ///< Impulse accumulated this tick, always >= 0
+    };
+
+    void prepare(const std::vector<Contact> &contacts);
+    void warmStart();
+    void solveVelocities();
+    void solvePositions();
+
+    static glm::vec2 velocityOf(const ECS::RigidBody *body);
+
+    EntityManager *mEntityManager;
+    int mVelocityIterations{DEFAULT_VELOCITY_ITERATIONS};
+    int mPositionIterations{DEFAULT_POSITION_ITERATIONS};
+    bool mWarmStarting{true};
+    std::vector<Constraint> mConstraints;                 ///< Per-tick constraints, reused between ticks
+    std::vector<std::pair<CollisionPair, float>> mCache;  ///< Accumulated impulse per pair from the last solve(), sorted by pair
+};
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef FIXEDPOINT_H
+#define FIXEDPOINT_H
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+ * @class FixedPoint
+ * @brief Signed fixed-point scalar with @p FractionBits fractional bits, stored in @p Raw.
+ *
+ * Every operation is integer arithmetic, so results are bit-identical on every compiler and
+ * CPU, which floats only guarantee with care. Products and quotients are computed in @p Wide;
+ * products round toward negative infinity and quotients toward zero. Sums that do not fit wrap
+ * around instead of being undefined, so an overflow shows up as a wrong value rather than an
+ * optimizer surprise.
+ *
+ * The type is trivial, so it can be used as the scalar of Math.h's templates and of the
+ * BasicTransform / BasicRigidBody components. Those primitives are all it covers: the
+ * PhysicsManager, the broad-phases and the Python bindings run on float, so a fixed-point
+ * world has to be stepped with the Math.h routines directly (see bench_fixedPoint).
+ */
+template <int FractionBits, typename Raw, typename Wide>
+class FixedPoint
+{
+    static_assert(std::is_signed<Raw>::value && sizeof(Wide) >= 2 * sizeof(Raw), "Wide must hold the product of two Raw values");
+    static_assert(FractionBits > 0 && FractionBits < static_cast<int>(sizeof(Raw) * 8) - 1, "Need at least one integer bit and a sign bit");
+
+    using URaw = typename std::make_unsigned<Raw>::type;
+
+public:
+    using RawType = Raw;
+    static constexpr int FRACTION_BITS = FractionBits;
+    static constexpr Raw ONE = Raw(1) << FractionBits;
+
+    FixedPoint() = default;
+    constexpr FixedPoint(int value) : mRaw(static_cast<Raw>(static_cast<Raw>(value) * ONE)) {}
+    constexpr explicit FixedPoint(float value) : mRaw(fromReal(value)) {}
+    constexpr explicit FixedPoint(double value) : mRaw(fromReal(value)) {}
+
+    /** @brief Value whose raw representation is @p raw, i.e. raw / 2^FractionBits. */
+    static constexpr FixedPoint fromRaw(Raw raw) { return FixedPoint(RawTag{}, raw); }
+
+    constexpr Raw raw() const { return mRaw; }
+    constexpr explicit operator float() const { return static_cast<float>(mRaw) / static_cast<float>(ONE); }
+    constexpr explicit operator double() const { return static_cast<double>(mRaw) / static_cast<double>(ONE); }
+
+    /** @brief Smallest positive value. */
+    static constexpr FixedPoint epsilon() { return fromRaw(1); }
+    static constexpr FixedPoint max() { return fromRaw(std::numeric_limits<Raw>::max()); }
+    static constexpr FixedPoint lowest() { return fromRaw(std::numeric_limits<Raw>::min()); }
+
+    friend constexpr FixedPoint operator+(FixedPoint a, FixedPoint b) { return fromRaw(wrap(static_cast<URaw>(a.mRaw) + static_cast<URaw>(b.mRaw))); }
+    friend constexpr FixedPoint operator-(FixedPoint a, FixedPoint b) { return fromRaw(wrap(static_cast<URaw>(a.mRaw) - static_cast<URaw>(b.mRaw))); }
+    friend constexpr FixedPoint operator-(FixedPoint a) { return fromRaw(wrap(URaw(0) - static_cast<URaw>(a.mRaw))); }
+    friend constexpr FixedPoint operator*(FixedPoint a, FixedPoint b)
+    {
+        return fromRaw(static_cast<Raw>((static_cast<Wide>(a.mRaw) * static_cast<Wide>(b.mRaw)) >> FractionBits));
+    }
+    /** @brief Quotient rounded toward zero; @p b must not be zero. */
+    friend constexpr FixedPoint operator/(FixedPoint a, FixedPoint b)
+    {
+        return fromRaw(static_cast<Raw>((static_cast<Wide>(a.mRaw) * static_cast<Wide>(ONE)) / static_cast<Wide>(b.mRaw)));
+    }
+
+    constexpr FixedPoint &operator+=(FixedPoint other) { return *this = *this + other; }
+    constexpr FixedPoint &operator-=(FixedPoint other) { return *this = *this - other; }
+    constexpr FixedPoint &operator*=(FixedPoint other) { return *this = *this * other; }
+    constexpr FixedPoint &operator/=(FixedPoint other) { return *this = *this / other; }
+
+    friend constexpr bool operator==(FixedPoint a, FixedPoint b) { return a.mRaw == b.mRaw; }
+    friend constexpr bool operator!=(FixedPoint a, FixedPoint b) { return a.mRaw != b.mRaw; }
+    friend constexpr bool operator<(FixedPoint a, FixedPoint b) { return a.mRaw < b.mRaw; }
+    friend constexpr bool operator>(FixedPoint a, FixedPoint b) { return a.mRaw > b.mRaw; }
+    friend constexpr bool operator<=(FixedPoint a, FixedPoint b) { return a.mRaw <= b.mRaw; }
+    friend constexpr bool operator>=(FixedPoint a, FixedPoint b) { return a.mRaw >= b.mRaw; }
+
+    /** @brief Square root rounded down; 0 for negative inputs. */
+    friend constexpr FixedPoint sqrt(FixedPoint value)
+    {
+        if (value.mRaw <= 0)
+            return fromRaw(0);
+
+        // sqrt(raw / 2^F) * 2^F == sqrt(raw * 2^F): one integer square root, bit by bit.
+        // raw * 2^F and every intermediate stay below 2^(bits of Wide - 1), so Wide's sign bit is never touched.
+        Wide remainder = static_cast<Wide>(value.mRaw) << FractionBits;
+        Wide root = 0;
+        Wide bit = Wide(1) << (sizeof(Wide) * 8 - 2);
+        while (bit > remainder)
+            bit >>= 2;
+        while (bit != 0)
+        {
+            if (remainder >= root + bit)
+            {
+                remainder -= root + bit;
+                root = (root >> 1) + bit;
+            }
+            else
+            {
+                root >>= 1;
+            }
+            bit >>= 2;
+        }
+        return fromRaw(static_cast<Raw>(root));
+    }
+
+    friend constexpr FixedPoint abs(FixedPoint value) { return value.mRaw < 0 ? -value : value; }
+
+private:
+    struct RawTag
+    {
+    };
+
+    constexpr FixedPoint(RawTag, Raw raw) : mRaw(raw) {}
+
+    template <typename Real>
+    static constexpr Raw fromReal(Real value)
+    {
+        // Round to nearest, halves away from zero
+        Real scaled = value * static_cast<Real>(ONE);
+        return static_cast<Raw>(scaled < 0 ? scaled - Real(0.5) : scaled + Real(0.5));
+    }
+
+    /** @brief Two's-complement reinterpretation, defined for every value unlike signed overflow. */
+    static constexpr Raw wrap(URaw value)
+    {
+        return value <= static_cast<URaw>(std::numeric_limits<Raw>::max())
+                   ? static_cast<Raw>(value)
+                   : static_cast<Raw>(-static_cast<Raw>(URaw(~value)) - 1);
+    }
+
+    Raw mRaw; ///< Value times 2^FractionBits; left uninitialized by default like float
+};
+
+// glm::vec keeps its components in unions, which only accept a trivial scalar
+static_assert(std::is_trivially_default_constructible<FixedPoint<16, int32_t, int64_t>>::value &&
+                  std::is_trivially_copyable<FixedPoint<16, int32_t, int64_t>>::value,
+              "FixedPoint must stay trivial to be the scalar of a glm::vec");
+
+/** @brief 16.16: range ±32768 with a resolution of 1/65536. Suits worlds measured in metres, not pixels. */
+using Fixed16_16 = FixedPoint<16, int32_t, int64_t>;
+
+#ifdef __SIZEOF_INT128__
+/** @brief 32.32: range ±2^31 with a resolution of 2^-32. Needs a 128-bit integer, so GCC and Clang only. */
+using Fixed32_32 = FixedPoint<32, int64_t, __int128>;
+#endif
+
+#endif
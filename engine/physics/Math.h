@@ -3,106 +3,378 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <utility>
 #include <glm/glm.hpp>
 
+/*
+ * Collision math, templated on the scalar type so the same routines run on float (what the
+ * engine uses) or on a FixedPoint type (FixedPoint.h) for simulations that must agree bit for
+ * bit across compilers. Every function deduces the scalar from its AABB or scalar arguments;
+ * the float names AABB and CollisionResult are what the rest of the engine uses.
+ *
+ * Only glm's vector operators are used on the generic paths: glm's functions (dot, length,
+ * normalize, clamp, ...) static_assert on an IEEE float scalar unless the build defines
+ * GLM_FORCE_UNRESTRICTED_GENTYPE, so their equivalents are defined below. The physics systems
+ * themselves (PhysicsManager, broad-phases, solver) are float only.
+ */
 namespace Math
 {
-    struct AABB
+    template <typename Scalar>
+    using Vec2 = glm::vec<2, Scalar, glm::defaultp>;
+
+    template <typename Scalar>
+    struct BasicAABB
     {
-        glm::vec2 min;
-        glm::vec2 max;
+        Vec2<Scalar> min;
+        Vec2<Scalar> max;
     };
 
-    struct CollisionResult
+    template <typename Scalar>
+    struct BasicCollisionResult
     {
         bool isColliding{false};
 
-        glm::vec2 normal{0.0f, 0.0f}; // Direction to push A away from B
-        float penetration{0.0f};      // How deep the overlap is
+        Vec2<Scalar> normal{Scalar(0), Scalar(0)}; // Direction to push A away from B
+        Scalar penetration{0};                     // How deep the overlap is
+
+        int pointCount{0};                    // Contact points found; only the polygon tests (Polygon.h) compute them
+        std::array<Vec2<Scalar>, 2> points{}; // World-space contact points
     };
 
-    inline bool checkAABBCollision(const AABB &aabbA, const AABB &aabbB)
+    using AABB = BasicAABB<float>;
+    using CollisionResult = BasicCollisionResult<float>;
+
+    // Scalar helpers: float keeps the <cmath> functions, other scalars find theirs by ADL
+    inline float sqrtScalar(float value) { return std::sqrt(value); }
+    inline float minScalar(float a, float b) { return std::fmin(a, b); }
+    inline float maxScalar(float a, float b) { return std::fmax(a, b); }
+
+    template <typename Scalar>
+    Scalar sqrtScalar(Scalar value) { return sqrt(value); }
+    template <typename Scalar>
+    Scalar minScalar(Scalar a, Scalar b) { return b < a ? b : a; }
+    template <typename Scalar>
+    Scalar maxScalar(Scalar a, Scalar b) { return a < b ? b : a; }
+
+    /** @brief Same as glm::clamp, for any scalar. */
+    template <typename Scalar>
+    Scalar clamp(Scalar value, Scalar lo, Scalar hi) { return std::min(std::max(value, lo), hi); }
+
+    template <typename Scalar>
+    Scalar dot(const Vec2<Scalar> &a, const Vec2<Scalar> &b) { return a.x * b.x + a.y * b.y; }
+
+    template <typename Scalar>
+    Scalar distance(const Vec2<Scalar> &a, const Vec2<Scalar> &b)
+    {
+        Vec2<Scalar> delta = b - a;
+        return sqrtScalar(dot(delta, delta));
+    }
+
+    template <typename Scalar>
+    bool checkAABBCollision(const BasicAABB<Scalar> &aabbA, const BasicAABB<Scalar> &aabbB)
     {
         // Check if the AABBs overlap on both axes
         return (aabbA.min.x < aabbB.max.x && aabbA.max.x > aabbB.min.x &&
                 aabbA.min.y < aabbB.max.y && aabbA.max.y > aabbB.min.y);
     }
 
-    inline bool checkCircleCollision(const glm::vec2 &centerA, float radiusA, const glm::vec2 &centerB, float radiusB)
+    template <typename Scalar>
+    bool checkAABBOverlap(const BasicAABB<Scalar> &aabbA, const BasicAABB<Scalar> &aabbB)
+    {
+        // Inclusive variant used for broad-phase culling: touching boxes still count,
+        // so narrow-phase tests that accept zero-distance contact are never skipped
+        return (aabbA.min.x <= aabbB.max.x && aabbA.max.x >= aabbB.min.x &&
+                aabbA.min.y <= aabbB.max.y && aabbA.max.y >= aabbB.min.y);
+    }
+
+    template <typename Scalar>
+    BasicAABB<Scalar> combineAABB(const BasicAABB<Scalar> &aabbA, const BasicAABB<Scalar> &aabbB)
+    {
+        return {Vec2<Scalar>(minScalar(aabbA.min.x, aabbB.min.x), minScalar(aabbA.min.y, aabbB.min.y)),
+                Vec2<Scalar>(maxScalar(aabbA.max.x, aabbB.max.x), maxScalar(aabbA.max.y, aabbB.max.y))};
+    }
+
+    template <typename Scalar>
+    bool containsAABB(const BasicAABB<Scalar> &outer, const BasicAABB<Scalar> &inner)
+    {
+        return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y &&
+               inner.max.x <= outer.max.x && inner.max.y <= outer.max.y;
+    }
+
+    template <typename Scalar>
+    Scalar perimeterAABB(const BasicAABB<Scalar> &aabb)
+    {
+        return Scalar(2) * ((aabb.max.x - aabb.min.x) + (aabb.max.y - aabb.min.y));
+    }
+
+    /** @brief Distance from @p point to the closest point of @p aabb; 0 inside it. */
+    template <typename Scalar>
+    Scalar distanceToAABB(const Vec2<Scalar> &point, const BasicAABB<Scalar> &aabb)
+    {
+        Vec2<Scalar> outside(std::max(aabb.min.x - point.x, std::max(point.x - aabb.max.x, Scalar(0))),
+                             std::max(aabb.min.y - point.y, std::max(point.y - aabb.max.y, Scalar(0))));
+        return sqrtScalar(dot(outside, outside));
+    }
+
+    /**
+     * @brief Slab test of the segment origin + t * delta, t in [0, maxFraction], against an AABB.
+     * @param fraction Receives the entry fraction (0 if the origin starts inside the box)
+     * @return True if the segment touches the box
+     */
+    template <typename Scalar>
+    bool raycastAABB(const Vec2<Scalar> &origin, const Vec2<Scalar> &delta, const BasicAABB<Scalar> &aabb,
+                     Scalar maxFraction, Scalar &fraction)
+    {
+        Scalar tMin = Scalar(0);
+        Scalar tMax = maxFraction;
+
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            Scalar o = axis == 0 ? origin.x : origin.y;
+            Scalar d = axis == 0 ? delta.x : delta.y;
+            Scalar lo = axis == 0 ? aabb.min.x : aabb.min.y;
+            Scalar hi = axis == 0 ? aabb.max.x : aabb.max.y;
+
+            if (d == Scalar(0))
+            {
+                // Parallel to this slab: must already be inside it
+                if (o < lo || o > hi)
+                    return false;
+                continue;
+            }
+
+            Scalar inverse = Scalar(1) / d;
+            Scalar t1 = (lo - o) * inverse;
+            Scalar t2 = (hi - o) * inverse;
+            if (t1 > t2)
+                std::swap(t1, t2);
+
+            tMin = maxScalar(tMin, t1);
+            tMax = minScalar(tMax, t2);
+            if (tMin > tMax)
+                return false;
+        }
+
+        fraction = tMin;
+        return true;
+    }
+
+    /**
+     * @brief Test of the segment origin + t * delta, t in [0, maxFraction], against a circle.
+     * @param fraction Receives the entry fraction (0 if the origin starts inside the circle)
+     * @return True if the segment touches the circle
+     */
+    template <typename Scalar>
+    bool raycastCircle(const Vec2<Scalar> &origin, const Vec2<Scalar> &delta, const Vec2<Scalar> &center, Scalar radius,
+                       Scalar maxFraction, Scalar &fraction)
+    {
+        Vec2<Scalar> offset = origin - center;
+        Scalar c = dot(offset, offset) - radius * radius;
+        if (c <= Scalar(0))
+        {
+            fraction = Scalar(0);
+            return true;
+        }
+
+        Scalar b = dot(offset, delta);
+        if (b >= Scalar(0))
+            return false; // Starts outside and points away
+
+        Scalar a = dot(delta, delta);
+        Scalar discriminant = b * b - a * c;
+        if (discriminant < Scalar(0))
+            return false;
+
+        Scalar t = (-b - sqrtScalar(discriminant)) / a;
+        if (t > maxFraction)
+            return false;
+
+        fraction = t;
+        return true;
+    }
+
+    /**
+     * @brief Time of impact of a box moving by @p delta against a resting box.
+     *
+     * Sweeps the center of @p moving against @p target grown by the half-size of @p moving.
+     * Boxes that already overlap at the start are not reported; boxes that only touch are,
+     * at fraction 0, if @p delta moves into them.
+     * @param fraction Receives the fraction of @p delta at first contact
+     * @param normal Receives the face normal of @p target that was hit (points toward the mover)
+     * @return True if the boxes come into contact within [0, 1] of @p delta
+     */
+    template <typename Scalar>
+    bool sweepAABB(const BasicAABB<Scalar> &moving, const Vec2<Scalar> &delta, const BasicAABB<Scalar> &target,
+                   Scalar &fraction, Vec2<Scalar> &normal)
+    {
+        const Scalar half = Scalar(1) / Scalar(2);
+        Vec2<Scalar> halfSize = (moving.max - moving.min) * half;
+        Vec2<Scalar> origin = (moving.min + moving.max) * half;
+        BasicAABB<Scalar> expanded{target.min - halfSize, target.max + halfSize};
+
+        if (origin.x > expanded.min.x && origin.x < expanded.max.x &&
+            origin.y > expanded.min.y && origin.y < expanded.max.y)
+            return false; // Already overlapping: left to the contact solver
+
+        Scalar tMin = Scalar(0);
+        Scalar tMax = Scalar(1);
+        int entryAxis = -1;
+        Scalar entrySign = Scalar(0);
+
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            Scalar o = axis == 0 ? origin.x : origin.y;
+            Scalar d = axis == 0 ? delta.x : delta.y;
+            Scalar lo = axis == 0 ? expanded.min.x : expanded.min.y;
+            Scalar hi = axis == 0 ? expanded.max.x : expanded.max.y;
+
+            if (d == Scalar(0))
+            {
+                if (o <= lo || o >= hi)
+                    return false; // Parallel to this slab and outside it, or only grazing an edge
+                continue;
+            }
+
+            Scalar inverse = Scalar(1) / d;
+            Scalar tEnter = (lo - o) * inverse;
+            Scalar tExit = (hi - o) * inverse;
+            if (tEnter > tExit)
+                std::swap(tEnter, tExit);
+
+            if (tEnter >= tMin)
+            {
+                tMin = tEnter;
+                entryAxis = axis;
+                entrySign = d > Scalar(0) ? Scalar(-1) : Scalar(1);
+            }
+            tMax = minScalar(tMax, tExit);
+            if (tMin >= tMax)
+                return false;
+        }
+
+        if (entryAxis < 0)
+            return false;
+
+        fraction = tMin;
+        normal = entryAxis == 0 ? Vec2<Scalar>(entrySign, Scalar(0)) : Vec2<Scalar>(Scalar(0), entrySign);
+        return true;
+    }
+
+    /**
+     * @brief Time of impact of a circle moving by @p delta against a resting circle.
+     * Circles that already overlap at the start are not reported.
+     * @param fraction Receives the fraction of @p delta at first contact
+     * @param normal Receives the contact normal at impact (points toward the mover)
+     * @return True if the circles come into contact within [0, 1] of @p delta
+     */
+    template <typename Scalar>
+    bool sweepCircle(const Vec2<Scalar> &center, Scalar radius, const Vec2<Scalar> &delta,
+                     const Vec2<Scalar> &targetCenter, Scalar targetRadius,
+                     Scalar &fraction, Vec2<Scalar> &normal)
+    {
+        // Ray from the moving center against a circle of the summed radius
+        Vec2<Scalar> offset = center - targetCenter;
+        Scalar radiusSum = radius + targetRadius;
+        Scalar c = dot(offset, offset) - radiusSum * radiusSum;
+        if (c < Scalar(0))
+            return false; // Already overlapping: left to the contact solver
+
+        Scalar b = dot(offset, delta);
+        if (b >= Scalar(0))
+            return false; // Moving away or tangentially
+
+        Scalar a = dot(delta, delta);
+        Scalar discriminant = b * b - a * c;
+        if (discriminant < Scalar(0))
+            return false;
+
+        Scalar t = (-b - sqrtScalar(discriminant)) / a;
+        if (t > Scalar(1))
+            return false;
+
+        fraction = maxScalar(t, Scalar(0));
+        normal = (offset + delta * fraction) / radiusSum;
+        return true;
+    }
+
+    template <typename Scalar>
+    bool checkCircleCollision(const Vec2<Scalar> &centerA, Scalar radiusA, const Vec2<Scalar> &centerB, Scalar radiusB)
     {
         // Check if the distance between the centers is less than the sum of the radii
-        return glm::distance(centerA, centerB) < (radiusA + radiusB);
+        return distance(centerA, centerB) < (radiusA + radiusB);
     }
 
-    inline bool checkAABBCircleCollision(const AABB &aabb, const glm::vec2 &circleCenter, float circleRadius)
+    template <typename Scalar>
+    bool checkAABBCircleCollision(const BasicAABB<Scalar> &aabb, const Vec2<Scalar> &circleCenter, Scalar circleRadius)
     {
         // Find the closest point on the AABB to the circle center
-        glm::vec2 closestPoint;
-        closestPoint.x = glm::clamp(circleCenter.x, aabb.min.x, aabb.max.x);
-        closestPoint.y = glm::clamp(circleCenter.y, aabb.min.y, aabb.max.y);
-
-        // Calculate the distance between the circle center and the closest point
-        float distance = glm::distance(circleCenter, closestPoint);
+        Vec2<Scalar> closestPoint;
+        closestPoint.x = clamp(circleCenter.x, aabb.min.x, aabb.max.x);
+        closestPoint.y = clamp(circleCenter.y, aabb.min.y, aabb.max.y);
 
-        // If the distance is less than or equal to the circle radius, they are colliding
-        return distance <= circleRadius;
+        // If the distance to the closest point is at most the circle radius, they are colliding
+        return distance(circleCenter, closestPoint) <= circleRadius;
     }
 
-    inline CollisionResult resolveAABBCollision(const AABB &aabbA, const AABB &aabbB)
+    template <typename Scalar>
+    BasicCollisionResult<Scalar> resolveAABBCollision(const BasicAABB<Scalar> &aabbA, const BasicAABB<Scalar> &aabbB)
     {
-        CollisionResult result;
+        BasicCollisionResult<Scalar> result;
 
         // Compute overlap on each axis
-        float overlapX1 = aabbA.max.x - aabbB.min.x; // A pushing right into B's left
-        float overlapX2 = aabbB.max.x - aabbA.min.x; // B pushing right into A's left
-        float overlapY1 = aabbA.max.y - aabbB.min.y; // A pushing down into B's top
-        float overlapY2 = aabbB.max.y - aabbA.min.y; // B pushing down into A's top
+        Scalar overlapX1 = aabbA.max.x - aabbB.min.x; // A pushing right into B's left
+        Scalar overlapX2 = aabbB.max.x - aabbA.min.x; // B pushing right into A's left
+        Scalar overlapY1 = aabbA.max.y - aabbB.min.y; // A pushing down into B's top
+        Scalar overlapY2 = aabbB.max.y - aabbA.min.y; // B pushing down into A's top
 
         // If any overlap is negative or zero, no collision
-        if (overlapX1 <= 0 || overlapX2 <= 0 || overlapY1 <= 0 || overlapY2 <= 0)
+        if (overlapX1 <= Scalar(0) || overlapX2 <= Scalar(0) || overlapY1 <= Scalar(0) || overlapY2 <= Scalar(0))
             return result;
 
         // Find minimum overlap on each axis and its direction
         // signX/signY indicate the direction to push A away from B
-        float overlapX = (overlapX1 < overlapX2) ? overlapX1 : overlapX2;
-        float signX = (overlapX1 < overlapX2) ? -1.0f : 1.0f;
+        Scalar overlapX = (overlapX1 < overlapX2) ? overlapX1 : overlapX2;
+        Scalar signX = (overlapX1 < overlapX2) ? Scalar(-1) : Scalar(1);
 
-        float overlapY = (overlapY1 < overlapY2) ? overlapY1 : overlapY2;
-        float signY = (overlapY1 < overlapY2) ? -1.0f : 1.0f;
+        Scalar overlapY = (overlapY1 < overlapY2) ? overlapY1 : overlapY2;
+        Scalar signY = (overlapY1 < overlapY2) ? Scalar(-1) : Scalar(1);
 
         // Pick the axis with least penetration
         result.isColliding = true;
         if (overlapX < overlapY)
         {
-            result.normal = glm::vec2(signX, 0.0f);
+            result.normal = Vec2<Scalar>(signX, Scalar(0));
             result.penetration = overlapX;
         }
         else
         {
-            result.normal = glm::vec2(0.0f, signY);
+            result.normal = Vec2<Scalar>(Scalar(0), signY);
             result.penetration = overlapY;
         }
 
         return result;
     }
 
-    inline CollisionResult resolveCircleCollision(const glm::vec2 &centerA, float radiusA,
-                                                  const glm::vec2 &centerB, float radiusB)
+    template <typename Scalar>
+    BasicCollisionResult<Scalar> resolveCircleCollision(const Vec2<Scalar> &centerA, Scalar radiusA,
+                                                        const Vec2<Scalar> &centerB, Scalar radiusB)
     {
-        CollisionResult result;
+        BasicCollisionResult<Scalar> result;
 
-        glm::vec2 delta = centerA - centerB;
-        float distSquared = glm::dot(delta, delta);
-        float radiusSum = radiusA + radiusB;
+        Vec2<Scalar> delta = centerA - centerB;
+        Scalar distSquared = dot(delta, delta);
+        Scalar radiusSum = radiusA + radiusB;
 
         if (distSquared >= radiusSum * radiusSum)
             return result;
 
-        float distance = std::sqrt(distSquared);
+        Scalar distance = sqrtScalar(distSquared);
 
         result.isColliding = true;
-        if (distance > 0.0f)
+        if (distance > Scalar(0))
         {
             result.normal = delta / distance; // Normalized direction from B to A
             result.penetration = radiusSum - distance;
@@ -110,32 +382,33 @@ namespace Math
         else
         {
             // Concentric circles — pick an arbitrary separation axis
-            result.normal = glm::vec2(1.0f, 0.0f);
+            result.normal = Vec2<Scalar>(Scalar(1), Scalar(0));
             result.penetration = radiusSum;
         }
 
         return result;
     }
 
-    inline CollisionResult resolveAABBCircleCollision(const AABB &aabb, const glm::vec2 &circleCenter,
-                                                      float circleRadius)
+    template <typename Scalar>
+    BasicCollisionResult<Scalar> resolveAABBCircleCollision(const BasicAABB<Scalar> &aabb, const Vec2<Scalar> &circleCenter,
+                                                            Scalar circleRadius)
     {
-        CollisionResult result;
+        BasicCollisionResult<Scalar> result;
 
-        glm::vec2 closestPoint;
-        closestPoint.x = glm::clamp(circleCenter.x, aabb.min.x, aabb.max.x);
-        closestPoint.y = glm::clamp(circleCenter.y, aabb.min.y, aabb.max.y);
+        Vec2<Scalar> closestPoint;
+        closestPoint.x = clamp(circleCenter.x, aabb.min.x, aabb.max.x);
+        closestPoint.y = clamp(circleCenter.y, aabb.min.y, aabb.max.y);
 
-        glm::vec2 delta = circleCenter - closestPoint;
-        float distSquared = glm::dot(delta, delta);
+        Vec2<Scalar> delta = circleCenter - closestPoint;
+        Scalar distSquared = dot(delta, delta);
 
         if (distSquared > circleRadius * circleRadius)
             return result;
 
         result.isColliding = true;
-        float distance = std::sqrt(distSquared);
+        Scalar distance = sqrtScalar(distSquared);
 
-        if (distance > 0.0f)
+        if (distance > Scalar(0))
         {
             // Circle center is outside the AABB
             result.normal = delta / distance; // Points from AABB surface toward circle center
@@ -144,28 +417,28 @@ namespace Math
         else
         {
             // Circle center is inside the AABB — find nearest edge
-            float distToRight = aabb.max.x - circleCenter.x;
-            float distToLeft = circleCenter.x - aabb.min.x;
-            float distToTop = circleCenter.y - aabb.min.y;
-            float distToBottom = aabb.max.y - circleCenter.y;
+            Scalar distToRight = aabb.max.x - circleCenter.x;
+            Scalar distToLeft = circleCenter.x - aabb.min.x;
+            Scalar distToTop = circleCenter.y - aabb.min.y;
+            Scalar distToBottom = aabb.max.y - circleCenter.y;
 
-            float minDist = distToRight;
-            result.normal = glm::vec2(1.0f, 0.0f);
+            Scalar minDist = distToRight;
+            result.normal = Vec2<Scalar>(Scalar(1), Scalar(0));
 
             if (distToLeft < minDist)
             {
                 minDist = distToLeft;
-                result.normal = glm::vec2(-1.0f, 0.0f);
+                result.normal = Vec2<Scalar>(Scalar(-1), Scalar(0));
             }
             if (distToTop < minDist)
             {
                 minDist = distToTop;
-                result.normal = glm::vec2(0.0f, -1.0f);
+                result.normal = Vec2<Scalar>(Scalar(0), Scalar(-1));
             }
             if (distToBottom < minDist)
             {
                 minDist = distToBottom;
-                result.normal = glm::vec2(0.0f, 1.0f);
+                result.normal = Vec2<Scalar>(Scalar(0), Scalar(1));
             }
 
             result.penetration = circleRadius + minDist;
@@ -0,0 +1,388 @@
+#ifndef MATHBATCH_H
+#define MATHBATCH_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "Math.h"
+
+// Widest instruction set the translation unit is compiled for. AVX2 needs -mavx2 or /arch:AVX2
+// (see the 2DNGE_PHYSICS_AVX2 CMake option); SSE2 is part of every x86-64 target.
+#if defined(__AVX2__)
+#define MATH_BATCH_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_BATCH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/**
+ * Batch variants of the Math.h tests: one shape against many candidates stored as
+ * structure-of-arrays, 8 lanes at a time with AVX2, 4 with SSE2, one at a time otherwise.
+ *
+ * Every lane performs the same IEEE operations in the same order as the scalar function
+ * it mirrors (no reciprocal estimates, no fused multiply-add), so results are
+ * bit-identical to calling that function once per candidate.
+ */
+namespace Math
+{
+    /** @brief Boxes as parallel arrays of their bounds. */
+    struct AABBSoA
+    {
+        const float *minX;
+        const float *minY;
+        const float *maxX;
+        const float *maxY;
+    };
+
+    /** @brief Rigid bodies as parallel arrays, integrated in place by integrateVelocitiesBatch() and integratePositionsBatch(). */
+    struct BodySoA
+    {
+        float *positionX;
+        float *positionY;
+        float *velocityX;
+        float *velocityY;
+        const float *forceX;
+        const float *forceY;
+        const float *inverseMass;
+        const float *gravityScale;
+        const float *linearDamping;
+    };
+
+    /** @brief Circles as parallel arrays of their centers and radii. */
+    struct CircleSoA
+    {
+        const float *centerX;
+        const float *centerY;
+        const float *radius;
+    };
+
+    namespace detail
+    {
+#if defined(MATH_BATCH_AVX2)
+        struct Lanes
+        {
+            static constexpr size_t WIDTH = 8;
+            using F = __m256;
+
+            static F set(float v) { return _mm256_set1_ps(v); }
+            static F load(const float *p) { return _mm256_loadu_ps(p); }
+            static void store(float *p, F v) { _mm256_storeu_ps(p, v); }
+            static F add(F a, F b) { return _mm256_add_ps(a, b); }
+            static F sub(F a, F b) { return _mm256_sub_ps(a, b); }
+            static F mul(F a, F b) { return _mm256_mul_ps(a, b); }
+            static F div(F a, F b) { return _mm256_div_ps(a, b); }
+            static F sqrt(F a) { return _mm256_sqrt_ps(a); }
+            static F lt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+            static F le(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+            static F gt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+            static F land(F a, F b) { return _mm256_and_ps(a, b); }
+            static F select(F mask, F a, F b) { return _mm256_blendv_ps(b, a, mask); }
+            static int bits(F mask) { return _mm256_movemask_ps(mask); }
+        };
+#elif defined(MATH_BATCH_SSE2)
+        struct Lanes
+        {
+            static constexpr size_t WIDTH = 4;
+            using F = __m128;
+
+            static F set(float v) { return _mm_set1_ps(v); }
+            static F load(const float *p) { return _mm_loadu_ps(p); }
+            static void store(float *p, F v) { _mm_storeu_ps(p, v); }
+            static F add(F a, F b) { return _mm_add_ps(a, b); }
+            static F sub(F a, F b) { return _mm_sub_ps(a, b); }
+            static F mul(F a, F b) { return _mm_mul_ps(a, b); }
+            static F div(F a, F b) { return _mm_div_ps(a, b); }
+            static F sqrt(F a) { return _mm_sqrt_ps(a); }
+            static F lt(F a, F b) { return _mm_cmplt_ps(a, b); }
+            static F le(F a, F b) { return _mm_cmple_ps(a, b); }
+            static F gt(F a, F b) { return _mm_cmpgt_ps(a, b); }
+            static F land(F a, F b) { return _mm_and_ps(a, b); }
+            static F select(F mask, F a, F b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+            static int bits(F mask) { return _mm_movemask_ps(mask); }
+        };
+#endif
+
+#if defined(MATH_BATCH_AVX2) || defined(MATH_BATCH_SSE2)
+        /**
+         * glm::clamp(x, lo, hi) as glm evaluates it, min(max(x, lo), hi) with max(a, b) = a < b ? b : a
+         * and min(a, b) = b < a ? b : a. minps/maxps pick the other operand on ties, which differs for signed zeros.
+         */
+        inline Lanes::F clampLanes(Lanes::F x, Lanes::F lo, Lanes::F hi)
+        {
+            Lanes::F raised = Lanes::select(Lanes::lt(x, lo), lo, x);
+            return Lanes::select(Lanes::lt(hi, raised), hi, raised);
+        }
+
+        /** Scatter one block of lanes into CollisionResults; lanes outside @p colliding are left non-colliding. */
+        inline void storeResults(Lanes::F colliding, Lanes::F normalX, Lanes::F normalY, Lanes::F penetration,
+                                 CollisionResult *results)
+        {
+            int mask = Lanes::bits(colliding);
+            if (mask == 0)
+                return;
+
+            float nx[Lanes::WIDTH], ny[Lanes::WIDTH], pen[Lanes::WIDTH];
+            Lanes::store(nx, normalX);
+            Lanes::store(ny, normalY);
+            Lanes::store(pen, penetration);
+
+            for (size_t lane = 0; lane < Lanes::WIDTH; ++lane)
+            {
+                if (mask & (1 << lane))
+                {
+                    results[lane].isColliding = true;
+                    results[lane].normal = glm::vec2(nx[lane], ny[lane]);
+                    results[lane].penetration = pen[lane];
+                }
+            }
+        }
+#endif
+    }
+
+    /**
+     * @brief checkAABBOverlap(@p aabb, boxes[i]) for i in [0, count).
+     * @param overlaps Receives 1 for overlapping (or touching) boxes, 0 otherwise
+     */
+    inline void overlapAABBBatch(const AABB &aabb, const AABBSoA &boxes, size_t count, uint8_t *overlaps)
+    {
+        size_t i = 0;
+#if defined(MATH_BATCH_AVX2) || defined(MATH_BATCH_SSE2)
+        using L = detail::Lanes;
+        const L::F aMinX = L::set(aabb.min.x), aMinY = L::set(aabb.min.y);
+        const L::F aMaxX = L::set(aabb.max.x), aMaxY = L::set(aabb.max.y);
+
+        for (; i + L::WIDTH <= count; i += L::WIDTH)
+        {
+            L::F hit = L::land(L::land(L::le(aMinX, L::load(boxes.maxX + i)), L::le(L::load(boxes.minX + i), aMaxX)),
+                               L::land(L::le(aMinY, L::load(boxes.maxY + i)), L::le(L::load(boxes.minY + i), aMaxY)));
+            int mask = L::bits(hit);
+            for (size_t lane = 0; lane < L::WIDTH; ++lane)
+            {
+                overlaps[i + lane] = static_cast<uint8_t>((mask >> lane) & 1);
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            AABB other{{boxes.minX[i], boxes.minY[i]}, {boxes.maxX[i], boxes.maxY[i]}};
+            overlaps[i] = checkAABBOverlap(aabb, other) ? 1 : 0;
+        }
+    }
+
+    /** @brief results[i] = resolveAABBCollision(@p aabb, boxes[i]) for i in [0, count). */
+    inline void resolveAABBBatch(const AABB &aabb, const AABBSoA &boxes, size_t count, CollisionResult *results)
+    {
+        size_t i = 0;
+#if defined(MATH_BATCH_AVX2) || defined(MATH_BATCH_SSE2)
+        using L = detail::Lanes;
+        const L::F aMinX = L::set(aabb.min.x), aMinY = L::set(aabb.min.y);
+        const L::F aMaxX = L::set(aabb.max.x), aMaxY = L::set(aabb.max.y);
+        const L::F zero = L::set(0.0f), one = L::set(1.0f), minusOne = L::set(-1.0f);
+
+        for (; i + L::WIDTH <= count; i += L::WIDTH)
+        {
+            for (size_t lane = 0; lane < L::WIDTH; ++lane)
+            {
+                results[i + lane] = CollisionResult{};
+            }
+
+            L::F overlapX1 = L::sub(aMaxX, L::load(boxes.minX + i));
+            L::F overlapX2 = L::sub(L::load(boxes.maxX + i), aMinX);
+            L::F overlapY1 = L::sub(aMaxY, L::load(boxes.minY + i));
+            L::F overlapY2 = L::sub(L::load(boxes.maxY + i), aMinY);
+
+            L::F colliding = L::land(L::land(L::gt(overlapX1, zero), L::gt(overlapX2, zero)),
+                                     L::land(L::gt(overlapY1, zero), L::gt(overlapY2, zero)));
+
+            L::F pickX1 = L::lt(overlapX1, overlapX2);
+            L::F overlapX = L::select(pickX1, overlapX1, overlapX2);
+            L::F signX = L::select(pickX1, minusOne, one);
+            L::F pickY1 = L::lt(overlapY1, overlapY2);
+            L::F overlapY = L::select(pickY1, overlapY1, overlapY2);
+            L::F signY = L::select(pickY1, minusOne, one);
+
+            L::F alongX = L::lt(overlapX, overlapY);
+            detail::storeResults(colliding,
+                                 L::select(alongX, signX, zero),
+                                 L::select(alongX, zero, signY),
+                                 L::select(alongX, overlapX, overlapY),
+                                 results + i);
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            AABB other{{boxes.minX[i], boxes.minY[i]}, {boxes.maxX[i], boxes.maxY[i]}};
+            results[i] = resolveAABBCollision(aabb, other);
+        }
+    }
+
+    /** @brief results[i] = resolveCircleCollision(@p center, @p radius, circles[i]) for i in [0, count). */
+    inline void resolveCircleBatch(const glm::vec2 &center, float radius, const CircleSoA &circles, size_t count,
+                                   CollisionResult *results)
+    {
+        size_t i = 0;
+#if defined(MATH_BATCH_AVX2) || defined(MATH_BATCH_SSE2)
+        using L = detail::Lanes;
+        const L::F centerX = L::set(center.x), centerY = L::set(center.y), radiusA = L::set(radius);
+        const L::F zero = L::set(0.0f), one = L::set(1.0f);
+
+        for (; i + L::WIDTH <= count; i += L::WIDTH)
+        {
+            for (size_t lane = 0; lane < L::WIDTH; ++lane)
+            {
+                results[i + lane] = CollisionResult{};
+            }
+
+            L::F deltaX = L::sub(centerX, L::load(circles.centerX + i));
+            L::F deltaY = L::sub(centerY, L::load(circles.centerY + i));
+            L::F distSquared = L::add(L::mul(deltaX, deltaX), L::mul(deltaY, deltaY));
+            L::F radiusSum = L::add(radiusA, L::load(circles.radius + i));
+
+            L::F colliding = L::lt(distSquared, L::mul(radiusSum, radiusSum));
+            if (L::bits(colliding) == 0)
+                continue;
+
+            L::F distance = L::sqrt(distSquared);
+            L::F apart = L::gt(distance, zero);
+
+            // Concentric circles divide by zero here; those lanes take the arbitrary axis instead
+            detail::storeResults(colliding,
+                                 L::select(apart, L::div(deltaX, distance), one),
+                                 L::select(apart, L::div(deltaY, distance), zero),
+                                 L::select(apart, L::sub(radiusSum, distance), radiusSum),
+                                 results + i);
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            results[i] = resolveCircleCollision(center, radius, {circles.centerX[i], circles.centerY[i]}, circles.radius[i]);
+        }
+    }
+
+    /** @brief results[i] = resolveAABBCircleCollision(@p aabb, circles[i]) for i in [0, count); normals point toward the circle. */
+    inline void resolveAABBCircleBatch(const AABB &aabb, const CircleSoA &circles, size_t count, CollisionResult *results)
+    {
+        size_t i = 0;
+#if defined(MATH_BATCH_AVX2) || defined(MATH_BATCH_SSE2)
+        using L = detail::Lanes;
+        const L::F minX = L::set(aabb.min.x), minY = L::set(aabb.min.y);
+        const L::F maxX = L::set(aabb.max.x), maxY = L::set(aabb.max.y);
+        const L::F zero = L::set(0.0f), one = L::set(1.0f), minusOne = L::set(-1.0f);
+
+        for (; i + L::WIDTH <= count; i += L::WIDTH)
+        {
+            for (size_t lane = 0; lane < L::WIDTH; ++lane)
+            {
+                results[i + lane] = CollisionResult{};
+            }
+
+            L::F circleX = L::load(circles.centerX + i);
+            L::F circleY = L::load(circles.centerY + i);
+            L::F radius = L::load(circles.radius + i);
+
+            L::F deltaX = L::sub(circleX, detail::clampLanes(circleX, minX, maxX));
+            L::F deltaY = L::sub(circleY, detail::clampLanes(circleY, minY, maxY));
+            L::F distSquared = L::add(L::mul(deltaX, deltaX), L::mul(deltaY, deltaY));
+
+            L::F colliding = L::le(distSquared, L::mul(radius, radius));
+            if (L::bits(colliding) == 0)
+                continue;
+
+            L::F distance = L::sqrt(distSquared);
+            L::F outside = L::gt(distance, zero);
+
+            // Center inside the box: push out through the nearest edge, ties going to the earlier edge
+            L::F minDist = L::sub(maxX, circleX);
+            L::F insideX = one;
+            L::F insideY = zero;
+
+            L::F distToLeft = L::sub(circleX, minX);
+            L::F closer = L::lt(distToLeft, minDist);
+            minDist = L::select(closer, distToLeft, minDist);
+            insideX = L::select(closer, minusOne, insideX);
+
+            L::F distToTop = L::sub(circleY, minY);
+            closer = L::lt(distToTop, minDist);
+            minDist = L::select(closer, distToTop, minDist);
+            insideX = L::select(closer, zero, insideX);
+            insideY = L::select(closer, minusOne, insideY);
+
+            L::F distToBottom = L::sub(maxY, circleY);
+            closer = L::lt(distToBottom, minDist);
+            minDist = L::select(closer, distToBottom, minDist);
+            insideX = L::select(closer, zero, insideX);
+            insideY = L::select(closer, one, insideY);
+
+            detail::storeResults(colliding,
+                                 L::select(outside, L::div(deltaX, distance), insideX),
+                                 L::select(outside, L::div(deltaY, distance), insideY),
+                                 L::select(outside, L::sub(radius, distance), L::add(radius, minDist)),
+                                 results + i);
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            results[i] = resolveAABBCircleCollision(aabb, {circles.centerX[i], circles.centerY[i]}, circles.radius[i]);
+        }
+    }
+
+    /**
+     * @brief Semi-implicit Euler velocity step for bodies i in [0, count):
+     * velocity = (velocity + (gravity * gravityScale + force * inverseMass) * dt) / (1 + dt * linearDamping).
+     */
+    inline void integrateVelocitiesBatch(const BodySoA &bodies, size_t count, const glm::vec2 &gravity, float dt)
+    {
+        size_t i = 0;
+#if defined(MATH_BATCH_AVX2) || defined(MATH_BATCH_SSE2)
+        using L = detail::Lanes;
+        const L::F gravityX = L::set(gravity.x), gravityY = L::set(gravity.y);
+        const L::F step = L::set(dt), one = L::set(1.0f);
+
+        for (; i + L::WIDTH <= count; i += L::WIDTH)
+        {
+            L::F gravityScale = L::load(bodies.gravityScale + i);
+            L::F inverseMass = L::load(bodies.inverseMass + i);
+            L::F accelerationX = L::add(L::mul(gravityX, gravityScale), L::mul(L::load(bodies.forceX + i), inverseMass));
+            L::F accelerationY = L::add(L::mul(gravityY, gravityScale), L::mul(L::load(bodies.forceY + i), inverseMass));
+            L::F damping = L::add(one, L::mul(step, L::load(bodies.linearDamping + i)));
+
+            L::store(bodies.velocityX + i, L::div(L::add(L::load(bodies.velocityX + i), L::mul(accelerationX, step)), damping));
+            L::store(bodies.velocityY + i, L::div(L::add(L::load(bodies.velocityY + i), L::mul(accelerationY, step)), damping));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            float accelerationX = gravity.x * bodies.gravityScale[i] + bodies.forceX[i] * bodies.inverseMass[i];
+            float accelerationY = gravity.y * bodies.gravityScale[i] + bodies.forceY[i] * bodies.inverseMass[i];
+            float damping = 1.0f + dt * bodies.linearDamping[i];
+
+            bodies.velocityX[i] = (bodies.velocityX[i] + accelerationX * dt) / damping;
+            bodies.velocityY[i] = (bodies.velocityY[i] + accelerationY * dt) / damping;
+        }
+    }
+
+    /** @brief position += velocity * dt for bodies i in [0, count); reads only positions and velocities. */
+    inline void integratePositionsBatch(const BodySoA &bodies, size_t count, float dt)
+    {
+        size_t i = 0;
+#if defined(MATH_BATCH_AVX2) || defined(MATH_BATCH_SSE2)
+        using L = detail::Lanes;
+        const L::F step = L::set(dt);
+
+        for (; i + L::WIDTH <= count; i += L::WIDTH)
+        {
+            L::store(bodies.positionX + i, L::add(L::load(bodies.positionX + i), L::mul(L::load(bodies.velocityX + i), step)));
+            L::store(bodies.positionY + i, L::add(L::load(bodies.positionY + i), L::mul(L::load(bodies.velocityY + i), step)));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            bodies.positionX[i] += bodies.velocityX[i] * dt;
+            bodies.positionY[i] += bodies.velocityY[i] * dt;
+        }
+    }
+}
+
+#endif
@@ -1,52 +1,1240 @@
 #include "PhysicsManager.h"
 #include "CollisionDetector.h"
-#include "CollisionHandler.h"
+#include "ContactSolver.h"
+#include "BodyIntegrator.h"
+#include "TileMap.h"
+#include "broadphase/SpatialHashBroadPhase.h"
+#include "../core/JobPool.h"
 #include "../core/ecs/EntityManager.h"
 #include "../core/ecs/components/Transform.h"
 #include "../core/ecs/components/RigidBody.h"
 #include "../core/ecs/components/Collider.h"
+#include "../core/ecs/components/TileMapCollider.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double millisecondsSince(Clock::time_point start, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
 
 PhysicsManager::PhysicsManager(EntityManager *entityManager)
     : mEntityManager(entityManager),
       mCollisionDetector(std::make_unique<CollisionDetector>(entityManager)),
-      mCollisionHandler(std::make_unique<CollisionHandler>(entityManager))
+      mContactSolver(std::make_unique<ContactSolver>(entityManager)),
+      mBodyIntegrator(std::make_unique<BodyIntegrator>(entityManager)),
+      mBroadPhase(std::make_unique<SpatialHashBroadPhase>()),
+      mJobPool(std::make_unique<JobPool>()),
+      mContactRecords(std::make_shared<std::vector<ContactRecord>>())
 {
+    // Bodies and their transforms share dense indices, so integration walks both arrays in step
+    mEntityManager->group<ECS::Transform, ECS::RigidBody>();
 }
 
 PhysicsManager::~PhysicsManager()
 {
 }
 
-void PhysicsManager::update(float dt)
+void PhysicsManager::setBroadPhase(std::unique_ptr<IBroadPhase> broadPhase)
 {
-    // Transform entities with mobile components : RigidBody
+    mBroadPhase = broadPhase ? std::move(broadPhase) : std::make_unique<SpatialHashBroadPhase>();
+    mLayerBuckets.clear(); // Recreated from the new broad-phase
+}
+
+void PhysicsManager::setThreadCount(size_t threadCount)
+{
+    mJobPool = std::make_unique<JobPool>(threadCount);
+}
+
+size_t PhysicsManager::getThreadCount() const
+{
+    return mJobPool->getThreadCount();
+}
+
+std::vector<TriggerEvent> PhysicsManager::drainTriggerEvents()
+{
+    std::vector<TriggerEvent> events;
+    events.swap(mTriggerEvents);
+    return events;
+}
+
+const std::vector<Math::AABB> &PhysicsManager::getWorldAABBs() const
+{
+    return mCollisionDetector->getWorldAABBs();
+}
+
+const std::vector<EntityID> &PhysicsManager::getWorldAABBEntities() const
+{
+    return mCollisionDetector->getWorldAABBEntities();
+}
+
+ECS::BodyType PhysicsManager::getBodyType(EntityID entity) const
+{
+    if (!mEntityManager->hasComponent<ECS::RigidBody>(entity))
+        return ECS::BodyType::Static;
+    return mEntityManager->getComponent<ECS::RigidBody>(entity).type;
+}
+
+void PhysicsManager::updateStaticBodies(bool rescan)
+{
+    auto isStaticCollider = [&](EntityID entity)
+    {
+        return mEntityManager->hasComponent<ECS::Collider>(entity) && mEntityManager->hasComponent<ECS::Transform>(entity) &&
+               getBodyType(entity) == ECS::BodyType::Static;
+    };
+
+    if (rescan)
+    {
+        // Drop the leaves of entities that were deleted or lost their collider, transform or static type...
+        for (int32_t &proxy : mStaticProxy)
+        {
+            if (proxy != DynamicAABBTree::NULL_NODE && !isStaticCollider(mStaticTree.getEntity(proxy)))
+            {
+                mStaticTree.destroyProxy(proxy);
+                proxy = DynamicAABBTree::NULL_NODE;
+            }
+        }
+
+        // ...and add the static colliders without one. Existing leaves only move through markStaticDirty().
+        for (EntityID entity : mEntityManager->getComponentPool<ECS::Collider>())
+        {
+            uint32_t index = getEntityIndex(entity);
+            bool hasLeaf = index < mStaticProxy.size() && mStaticProxy[index] != DynamicAABBTree::NULL_NODE;
+            if (!hasLeaf && isStaticCollider(entity))
+                syncStaticProxy(entity);
+        }
+        ++mStaticRescanCount;
+    }
+
+    for (EntityID entity : mDirtyStatic)
+    {
+        syncStaticProxy(entity);
+    }
+    mDirtyStatic.clear();
+}
+
+void PhysicsManager::syncStaticProxy(EntityID entity)
+{
+    uint32_t index = getEntityIndex(entity);
+    if (index >= mStaticProxy.size())
+        mStaticProxy.resize(index + 1, DynamicAABBTree::NULL_NODE);
+
+    bool isStatic = mEntityManager->hasComponent<ECS::Collider>(entity) && mEntityManager->hasComponent<ECS::Transform>(entity) &&
+                    getBodyType(entity) == ECS::BodyType::Static;
+    int32_t &proxy = mStaticProxy[index];
+    if (proxy != DynamicAABBTree::NULL_NODE && mStaticTree.getEntity(proxy) != entity)
+    {
+        // The leaf belongs to an earlier entity at this index; it is stale only if this one is alive
+        if (!isStatic)
+            return;
+        mStaticTree.destroyProxy(proxy);
+        proxy = DynamicAABBTree::NULL_NODE;
+    }
+
+    if (!isStatic)
+    {
+        if (proxy != DynamicAABBTree::NULL_NODE)
+            mStaticTree.destroyProxy(proxy);
+        proxy = DynamicAABBTree::NULL_NODE;
+        return;
+    }
+
+    // The static tree has no margin, so a changed leaf is reinserted with its exact bounds
+    mCollisionDetector->refreshWorldAABB(entity);
+    const Math::AABB &aabb = mCollisionDetector->getWorldAABB(entity);
+    if (proxy != DynamicAABBTree::NULL_NODE)
+    {
+        const Math::AABB &current = mStaticTree.getFatAABB(proxy);
+        if (current.min == aabb.min && current.max == aabb.max)
+            return;
+        mStaticTree.destroyProxy(proxy);
+    }
+    proxy = mStaticTree.createProxy(aabb, entity);
+}
+
+void PhysicsManager::setSleepParameters(bool enabled, float velocityThreshold, float timeToSleep)
+{
+    mSleepEnabled = enabled;
+    mSleepVelocity = velocityThreshold;
+    mTimeToSleep = timeToSleep;
+
+    if (enabled)
+        return;
+
     auto &pool = mEntityManager->getComponentPool<ECS::RigidBody>();
+    for (EntityID entity : pool)
+    {
+        if (!pool.get(entity).awake)
+            wakeBody(entity);
+    }
+}
+
+void PhysicsManager::wakeBody(EntityID entity)
+{
+    if (!mEntityManager->hasComponent<ECS::RigidBody>(entity))
+        return;
+
+    const SleepSlot *slot = findSleepSlot(entity);
+    if (slot && slot->island != NO_ISLAND)
+        wakeIsland(slot->island);
+
+    auto &rigidBody = mEntityManager->getComponent<ECS::RigidBody>(entity);
+    rigidBody.awake = true;
+    rigidBody.sleepTime = 0.0f;
+    removeSleepingProxy(entity);
+}
 
-    for (auto &entry : pool.getDenseToEntity())
+void PhysicsManager::wakeIsland(uint32_t island)
+{
+    std::vector<EntityID> members = std::move(mIslands[island]);
+    mIslands[island].clear();
+    mFreeIslands.push_back(island);
+
+    for (EntityID member : members)
     {
-        EntityID entity = entry;
-        auto &rigidBody = pool.get(entity);
+        // Members woken on their own may have fallen asleep again in another island since
+        SleepSlot *slot = findSleepSlot(member);
+        if (!slot || slot->island != island)
+            continue;
+
+        slot->island = NO_ISLAND;
+        removeSleepingProxy(member);
+
+        if (mEntityManager->hasComponent<ECS::RigidBody>(member))
+        {
+            auto &rigidBody = mEntityManager->getComponent<ECS::RigidBody>(member);
+            rigidBody.awake = true;
+            rigidBody.sleepTime = 0.0f;
+        }
+    }
+}
+
+PhysicsManager::SleepSlot *PhysicsManager::findSleepSlot(EntityID entity)
+{
+    uint32_t index = getEntityIndex(entity);
+    if (index >= mSleepSlots.size() || mSleepSlots[index].entity != entity)
+        return nullptr;
+    return &mSleepSlots[index];
+}
+
+const PhysicsManager::SleepSlot *PhysicsManager::findSleepSlot(EntityID entity) const
+{
+    uint32_t index = getEntityIndex(entity);
+    if (index >= mSleepSlots.size() || mSleepSlots[index].entity != entity)
+        return nullptr;
+    return &mSleepSlots[index];
+}
+
+void PhysicsManager::removeSleepingProxy(EntityID entity)
+{
+    SleepSlot *slot = findSleepSlot(entity);
+    if (!slot || slot->proxy == DynamicAABBTree::NULL_NODE)
+        return;
+
+    mSleepingTree.destroyProxy(slot->proxy);
+    slot->proxy = DynamicAABBTree::NULL_NODE;
+}
+
+bool PhysicsManager::hasSleepingProxy(EntityID entity) const
+{
+    const SleepSlot *slot = findSleepSlot(entity);
+    return slot && slot->proxy != DynamicAABBTree::NULL_NODE;
+}
+
+void PhysicsManager::pruneSleepingTree()
+{
+    for (SleepSlot &slot : mSleepSlots)
+    {
+        if (slot.proxy == DynamicAABBTree::NULL_NODE)
+            continue;
+        if (!mEntityManager->hasComponent<ECS::RigidBody>(slot.entity) || !mEntityManager->hasComponent<ECS::Collider>(slot.entity))
+        {
+            mSleepingTree.destroyProxy(slot.proxy);
+            slot.proxy = DynamicAABBTree::NULL_NODE;
+        }
+    }
+}
+
+uint32_t PhysicsManager::findIsland(uint32_t body)
+{
+    while (mIslandParent[body] != body)
+    {
+        mIslandParent[body] = mIslandParent[mIslandParent[body]];
+        body = mIslandParent[body];
+    }
+    return body;
+}
+
+void PhysicsManager::updateSleep(float dt)
+{
+    if (!mSleepEnabled)
+        return;
+
+    auto &pool = mEntityManager->getComponentPool<ECS::RigidBody>();
+    auto &bodies = pool.getDense();
+    const auto &entities = pool.getDenseToEntity();
+    uint32_t count = static_cast<uint32_t>(bodies.size());
+
+    // Islands: dynamic bodies connected by this tick's touching pairs
+    mIslandParent.resize(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        mIslandParent[i] = i;
+    }
+    for (const auto &contact : mTouching)
+    {
+        uint32_t rootA = findIsland(contact.first);
+        uint32_t rootB = findIsland(contact.second);
+        if (rootA != rootB)
+            mIslandParent[std::max(rootA, rootB)] = std::min(rootA, rootB);
+    }
+
+    // Advance sleep timers and keep the shortest one per island in its root
+    const float thresholdSquared = mSleepVelocity * mSleepVelocity;
+    mIslandSleepTime.assign(count, mTimeToSleep);
+    bool anyResting = false;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        ECS::RigidBody &rigidBody = bodies[i];
+        if (rigidBody.type != ECS::BodyType::Dynamic || !rigidBody.awake)
+            continue;
+
+        if (glm::dot(rigidBody.velocity, rigidBody.velocity) > thresholdSquared)
+            rigidBody.sleepTime = 0.0f;
+        else
+            rigidBody.sleepTime += dt;
+
+        uint32_t root = findIsland(i);
+        mIslandSleepTime[root] = std::min(mIslandSleepTime[root], rigidBody.sleepTime);
+        anyResting |= rigidBody.sleepTime >= mTimeToSleep;
+    }
+
+    if (!anyResting)
+        return;
+
+    // Put every island whose bodies have all been resting long enough to sleep, together
+    std::vector<std::pair<uint32_t, uint32_t>> sleepers; // (island root, pool index)
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const ECS::RigidBody &rigidBody = bodies[i];
+        if (rigidBody.type != ECS::BodyType::Dynamic || !rigidBody.awake)
+            continue;
+
+        uint32_t root = findIsland(i);
+        if (mIslandSleepTime[root] >= mTimeToSleep)
+            sleepers.emplace_back(root, i);
+    }
+    std::sort(sleepers.begin(), sleepers.end());
+
+    uint32_t island = NO_ISLAND;
+    uint32_t currentRoot = NO_ISLAND;
+    for (const auto &sleeper : sleepers)
+    {
+        if (sleeper.first != currentRoot)
+        {
+            currentRoot = sleeper.first;
+            if (mFreeIslands.empty())
+            {
+                island = static_cast<uint32_t>(mIslands.size());
+                mIslands.emplace_back();
+            }
+            else
+            {
+                island = mFreeIslands.back();
+                mFreeIslands.pop_back();
+            }
+        }
+
+        EntityID entity = entities[sleeper.second];
+        ECS::RigidBody &rigidBody = bodies[sleeper.second];
+        rigidBody.awake = false;
+        rigidBody.velocity = {0.0f, 0.0f};
+        rigidBody.sleepTime = 0.0f;
+
+        mIslands[island].push_back(entity);
+        uint32_t index = getEntityIndex(entity);
+        if (index >= mSleepSlots.size())
+            mSleepSlots.resize(index + 1);
+
+        // A proxy still here belongs to a deleted entity that slept at this index before
+        SleepSlot &slot = mSleepSlots[index];
+        if (slot.proxy != DynamicAABBTree::NULL_NODE)
+            mSleepingTree.destroyProxy(slot.proxy);
+        slot = {entity, island, DynamicAABBTree::NULL_NODE};
+
+        if (mEntityManager->hasComponent<ECS::Collider>(entity) && mEntityManager->hasComponent<ECS::Transform>(entity))
+        {
+            Math::AABB aabb = mCollisionDetector->getColliderAABB(entity, mEntityManager->getComponent<ECS::Collider>(entity));
+            slot.proxy = mSleepingTree.createProxy(aabb, entity);
+        }
+    }
+}
+
+bool PhysicsManager::sweepCollider(EntityID entity, const ECS::Collider &collider, const glm::vec2 &delta, EntityID other,
+                                   EntityID hitEntity, float &fraction, glm::vec2 &normal) const
+{
+    const ECS::Collider &otherCollider = mEntityManager->getComponent<ECS::Collider>(other);
+    float hitFraction = 1.0f;
+    glm::vec2 hitNormal{0.0f, 0.0f};
+    bool hit;
+
+    if (collider.type == ECS::ColliderType::Circle && otherCollider.type == ECS::ColliderType::Circle)
+    {
+        glm::vec2 center = mEntityManager->getComponent<ECS::Transform>(entity).position + collider.offset;
+        const glm::vec2 &otherCenter = mCollisionDetector->getWorldCenter(other);
+        hit = Math::sweepCircle(center, collider.radius, delta, otherCenter, otherCollider.radius, hitFraction, hitNormal);
+    }
+    else
+    {
+        // Every other pair sweeps its bounds: conservative at a circle's corners and around oriented shapes
+        hit = Math::sweepAABB(mCollisionDetector->getColliderAABB(entity, collider), delta,
+                              mCollisionDetector->getWorldAABB(other), hitFraction, hitNormal);
+    }
+
+    // Equal times of impact go to the lower entity ID, so the winner does not depend on tree layout
+    bool sooner = hitFraction < fraction || (hitFraction == fraction && hitEntity != entity && other < hitEntity);
+    if (!hit || !sooner)
+        return false;
+
+    fraction = hitFraction;
+    normal = hitNormal;
+    return true;
+}
+
+void PhysicsManager::advanceContinuous(float dt)
+{
+    std::vector<EntityID> hitSleeping;
+
+    for (EntityID entity : mContinuous)
+    {
+        auto &rigidBody = mEntityManager->getComponent<ECS::RigidBody>(entity);
         auto &transform = mEntityManager->getComponent<ECS::Transform>(entity);
 
-        // Update position based on velocity
-        auto displacement = rigidBody.velocity * dt;
-        transform.position += displacement;
+        if (!mEntityManager->hasComponent<ECS::Collider>(entity))
+        {
+            transform.position += rigidBody.velocity * dt;
+            continue;
+        }
+
+        const ECS::Collider &collider = mEntityManager->getComponent<ECS::Collider>(entity);
+        float remaining = dt;
+
+        for (int substep = 0; substep < MAX_CCD_SUBSTEPS && remaining > 0.0f; ++substep)
+        {
+            glm::vec2 delta = rigidBody.velocity * remaining;
+            if (delta.x == 0.0f && delta.y == 0.0f)
+                break;
+
+            Math::AABB start = mCollisionDetector->getColliderAABB(entity, collider);
+            Math::AABB swept = Math::combineAABB(start, {start.min + delta, start.max + delta});
+
+            float fraction = 1.0f;
+            glm::vec2 normal{0.0f, 0.0f};
+            EntityID hitEntity = entity;
+            auto visit = [&](const DynamicAABBTree &tree)
+            {
+                tree.query(swept, [&](int32_t proxyId)
+                           {
+                    EntityID other = tree.getEntity(proxyId);
+                    const ECS::Collider &otherCollider = mEntityManager->getComponent<ECS::Collider>(other);
+                    if (other != entity && !collider.isTrigger && !otherCollider.isTrigger && ECS::canCollide(collider, otherCollider) &&
+                        sweepCollider(entity, collider, delta, other, hitEntity, fraction, normal))
+                        hitEntity = other;
+                    return true; });
+            };
+            visit(mStaticTree);
+            visit(mSleepingTree);
+
+            // Tile maps are swept by their merged rectangles, bounds against bounds like boxes
+            const auto &maps = mEntityManager->getComponentPool<ECS::TileMapCollider>();
+            for (size_t i = 0; i < maps.getDense().size() && !collider.isTrigger; ++i)
+            {
+                EntityID mapEntity = maps.getDenseToEntity()[i];
+                const ECS::TileMapCollider &map = maps.getDense()[i];
+                if (!mEntityManager->hasComponent<ECS::Transform>(mapEntity) || !ECS::canCollide(collider, map))
+                    continue;
+
+                TileMap::forEachRect(map, mEntityManager->getComponent<ECS::Transform>(mapEntity).position, swept, [&](const Math::AABB &rect)
+                                     {
+                    float hitFraction = 1.0f;
+                    glm::vec2 hitNormal{0.0f, 0.0f};
+                    if (!Math::sweepAABB(start, delta, rect, hitFraction, hitNormal))
+                        return;
+
+                    // Same tie-break as sweepCollider()
+                    bool sooner = hitFraction < fraction || (hitFraction == fraction && hitEntity != entity && mapEntity < hitEntity);
+                    if (!sooner)
+                        return;
+
+                    fraction = hitFraction;
+                    normal = hitNormal;
+                    hitEntity = mapEntity; });
+            }
+
+            transform.position += delta * fraction;
+            if (hitEntity == entity)
+                break;
+
+            remaining *= 1.0f - fraction;
+
+            // Remove the approach velocity, bouncing by the lower restitution of the two
+            float restitution = rigidBody.restitution;
+            if (mEntityManager->hasComponent<ECS::RigidBody>(hitEntity))
+                restitution = std::min(restitution, mEntityManager->getComponent<ECS::RigidBody>(hitEntity).restitution);
+
+            float normalVelocity = glm::dot(rigidBody.velocity, normal);
+            if (normalVelocity < 0.0f)
+                rigidBody.velocity -= normal * ((1.0f + restitution) * normalVelocity);
+
+            // Sleeping bodies are swept as obstacles; the contact step takes over once they are awake
+            if (hasSleepingProxy(hitEntity))
+                hitSleeping.push_back(hitEntity);
+        }
+
+        mCollisionDetector->refreshWorldAABB(entity);
     }
 
-    // Detect and resolve collisions
-    auto &colliderPool = mEntityManager->getComponentPool<ECS::Collider>();
-    const auto &entities = colliderPool.getDenseToEntity();
+    // Woken only now so every sweep saw the same sleeping tree
+    for (EntityID entity : hitSleeping)
+    {
+        wakeBody(entity);
+    }
+}
 
-    for (size_t i = 0; i < entities.size(); ++i)
+void PhysicsManager::findLayerPairs()
+{
+    const auto &colliderPool = mEntityManager->getComponentPool<ECS::Collider>();
+    for (LayerBucket &bucket : mLayerBuckets)
     {
-        for (size_t j = i + 1; j < entities.size(); ++j)
+        bucket.proxies.clear();
+    }
+
+    LayerBucket *bucket = nullptr;
+    for (const BroadPhaseProxy &proxy : mProxies)
+    {
+        const ECS::Collider &collider = colliderPool.get(proxy.entity);
+        if (bucket && bucket->category == collider.category && bucket->mask == collider.mask)
+        {
+            bucket->proxies.push_back(proxy);
+            continue;
+        }
+
+        auto it = std::find_if(mLayerBuckets.begin(), mLayerBuckets.end(), [&](const LayerBucket &candidate)
+                               { return candidate.category == collider.category && candidate.mask == collider.mask; });
+        if (it == mLayerBuckets.end())
         {
-            auto result = mCollisionDetector->checkCollision(entities[i], entities[j]);
+            mLayerBuckets.push_back(LayerBucket{collider.category, collider.mask, nullptr, {}});
+            it = std::prev(mLayerBuckets.end());
+        }
+        bucket = &*it;
+        bucket->proxies.push_back(proxy);
+    }
+
+    mLayerBuckets.erase(std::remove_if(mLayerBuckets.begin(), mLayerBuckets.end(), [](const LayerBucket &candidate)
+                                       { return candidate.proxies.empty(); }),
+                        mLayerBuckets.end());
+
+    const ECS::Collider defaultLayer{};
+    for (size_t i = 0; i < mLayerBuckets.size(); ++i)
+    {
+        LayerBucket &current = mLayerBuckets[i];
+        if ((current.category & current.mask) != 0)
+        {
+            IBroadPhase *broadPhase = mBroadPhase.get();
+            if (current.category != defaultLayer.category || current.mask != defaultLayer.mask)
+            {
+                if (!current.broadPhase)
+                    current.broadPhase = mBroadPhase->createEmpty();
+                broadPhase = current.broadPhase.get();
+            }
+            broadPhase->update(current.proxies);
+            broadPhase->findPairs(mPairs);
+        }
 
+        for (size_t j = i + 1; j < mLayerBuckets.size(); ++j)
+        {
+            const LayerBucket &other = mLayerBuckets[j];
+            if ((current.category & other.mask) != 0 && (other.category & current.mask) != 0)
+                findCrossPairs(current.proxies, other.proxies);
+        }
+    }
+}
+
+void PhysicsManager::findCrossPairs(const std::vector<BroadPhaseProxy> &a, const std::vector<BroadPhaseProxy> &b)
+{
+    auto byMinX = [](const BroadPhaseProxy &lhs, const BroadPhaseProxy &rhs)
+    { return lhs.aabb.min.x < rhs.aabb.min.x; };
+
+    mSweepA.assign(a.begin(), a.end());
+    mSweepB.assign(b.begin(), b.end());
+    std::sort(mSweepA.begin(), mSweepA.end(), byMinX);
+    std::sort(mSweepB.begin(), mSweepB.end(), byMinX);
+
+    // Scan @p into from the first proxy starting at (or strictly after) each proxy of @p from, up to where it ends
+    auto sweep = [this](const std::vector<BroadPhaseProxy> &from, const std::vector<BroadPhaseProxy> &into, bool inclusive)
+    {
+        for (const BroadPhaseProxy &proxy : from)
+        {
+            float start = proxy.aabb.min.x;
+            auto it = inclusive ? std::lower_bound(into.begin(), into.end(), start, [](const BroadPhaseProxy &candidate, float x)
+                                                   { return candidate.aabb.min.x < x; })
+                                : std::upper_bound(into.begin(), into.end(), start, [](float x, const BroadPhaseProxy &candidate)
+                                                   { return x < candidate.aabb.min.x; });
+
+            for (; it != into.end() && it->aabb.min.x <= proxy.aabb.max.x; ++it)
+            {
+                if (Math::checkAABBOverlap(proxy.aabb, it->aabb))
+                    mPairs.push_back(makeCollisionPair(proxy.entity, it->entity));
+            }
+        }
+    };
+
+    // Every overlapping pair is found once, from whichever side starts further left (A on a tie)
+    sweep(mSweepA, mSweepB, true);
+    sweep(mSweepB, mSweepA, false);
+}
+
+void PhysicsManager::runNarrowPhase()
+{
+    mThreadContacts.resize(mJobPool->getThreadCount());
+
+    // Each thread tests a contiguous run of the sorted pairs, so concatenating the buffers in thread order keeps pair order
+    mJobPool->parallelFor(mPairs.size(), MIN_PAIRS_PER_THREAD, [this](size_t begin, size_t end, size_t thread)
+                          {
+        auto &contacts = mThreadContacts[thread];
+        contacts.clear();
+        for (size_t i = begin; i < end; ++i)
+        {
+            const CollisionPair &pair = mPairs[i];
+            Math::CollisionResult result = mCollisionDetector->checkCachedCollision(pair.entityA, pair.entityB);
             if (result.isColliding)
+                contacts.emplace_back(pair, result);
+        } });
+
+    mContacts.clear();
+    for (auto &contacts : mThreadContacts)
+    {
+        mContacts.insert(mContacts.end(), contacts.begin(), contacts.end());
+        contacts.clear();
+    }
+}
+
+void PhysicsManager::findTileMapContacts()
+{
+    const auto &maps = mEntityManager->getComponentPool<ECS::TileMapCollider>();
+    if (maps.getDense().empty())
+        return;
+
+    const auto &colliderPool = mEntityManager->getComponentPool<ECS::Collider>();
+    const auto &transforms = mEntityManager->getComponentPool<ECS::Transform>();
+    const auto &mapEntities = maps.getDenseToEntity();
+
+    // Tile maps are static: like static colliders they only stop dynamic bodies
+    mTileContacts.clear();
+    for (const BroadPhaseProxy &proxy : mProxies)
+    {
+        const ECS::Collider &collider = colliderPool.get(proxy.entity);
+        if (collider.isTrigger || getBodyType(proxy.entity) != ECS::BodyType::Dynamic)
+            continue;
+
+        for (size_t i = 0; i < mapEntities.size(); ++i)
+        {
+            const ECS::TileMapCollider &map = maps.getDense()[i];
+            if (!transforms.has(mapEntities[i]) || !ECS::canCollide(collider, map))
+                continue;
+
+            CollisionPair pair = makeCollisionPair(proxy.entity, mapEntities[i]);
+            TileMap::forEachRect(map, transforms.get(mapEntities[i]).position, proxy.aabb, [&](const Math::AABB &rect)
+                                 {
+                ++mStats.narrowPhaseTests;
+                Math::CollisionResult result = mCollisionDetector->checkCachedCollision(proxy.entity, rect);
+                if (!result.isColliding)
+                    return;
+
+                // The normal pushes the body away; the pair orders entities by ID
+                if (pair.entityA != proxy.entity)
+                    result.normal = -result.normal;
+                mTileContacts.emplace_back(pair, result); });
+        }
+    }
+
+    // Rectangles of one pair stay in walk order, so the merge is deterministic
+    auto byPair = [](const Contact &a, const Contact &b)
+    { return a.first < b.first; };
+    std::stable_sort(mTileContacts.begin(), mTileContacts.end(), byPair);
+
+    size_t middle = mContacts.size();
+    mContacts.insert(mContacts.end(), mTileContacts.begin(), mTileContacts.end());
+    std::inplace_merge(mContacts.begin(), mContacts.begin() + middle, mContacts.end(), byPair);
+}
+
+bool PhysicsManager::isTrigger(EntityID entity) const
+{
+    return mEntityManager->hasComponent<ECS::Collider>(entity) && mEntityManager->getComponent<ECS::Collider>(entity).isTrigger;
+}
+
+void PhysicsManager::updateTriggers()
+{
+    // Trigger overlaps are reported, never resolved
+    mCurrentTriggerOverlaps.clear();
+    size_t solid = 0;
+    for (size_t i = 0; i < mContacts.size(); ++i)
+    {
+        const CollisionPair &pair = mContacts[i].first;
+        if (isTrigger(pair.entityA) || isTrigger(pair.entityB))
+            mCurrentTriggerOverlaps.push_back(pair);
+        else
+            mContacts[solid++] = mContacts[i];
+    }
+    mContacts.resize(solid);
+
+    if (mCurrentTriggerOverlaps.empty() && mTriggerOverlaps.empty())
+        return;
+
+    // Pairs of static or sleeping colliders are not tested again, so their overlap carries over until one side moves
+    auto isResting = [&](EntityID entity)
+    {
+        if (!mEntityManager->hasComponent<ECS::Collider>(entity) || !mEntityManager->hasComponent<ECS::Transform>(entity))
+            return false;
+        if (!mEntityManager->hasComponent<ECS::RigidBody>(entity))
+            return true;
+        const ECS::RigidBody &rigidBody = mEntityManager->getComponent<ECS::RigidBody>(entity);
+        return rigidBody.type == ECS::BodyType::Static || !rigidBody.awake;
+    };
+
+    size_t tested = mCurrentTriggerOverlaps.size();
+    for (const CollisionPair &pair : mTriggerOverlaps)
+    {
+        if (isResting(pair.entityA) && isResting(pair.entityB) &&
+            !std::binary_search(mCurrentTriggerOverlaps.begin(), mCurrentTriggerOverlaps.begin() + tested, pair))
+            mCurrentTriggerOverlaps.push_back(pair);
+    }
+    std::inplace_merge(mCurrentTriggerOverlaps.begin(), mCurrentTriggerOverlaps.begin() + tested, mCurrentTriggerOverlaps.end());
+
+    auto queue = [&](const CollisionPair &pair, TriggerEventType type)
+    {
+        // A removed collider can no longer say which side was the trigger; keep entityA then
+        bool bIsTrigger = isTrigger(pair.entityB) && !isTrigger(pair.entityA);
+        mTriggerEvents.push_back(bIsTrigger ? TriggerEvent{pair.entityB, pair.entityA, type}
+                                            : TriggerEvent{pair.entityA, pair.entityB, type});
+    };
+
+    // Both lists are sorted, so one merge walk finds what began, persisted and ended
+    auto previous = mTriggerOverlaps.begin();
+    auto current = mCurrentTriggerOverlaps.begin();
+    while (previous != mTriggerOverlaps.end() || current != mCurrentTriggerOverlaps.end())
+    {
+        if (current == mCurrentTriggerOverlaps.end() || (previous != mTriggerOverlaps.end() && *previous < *current))
+            queue(*previous++, TriggerEventType::Exit);
+        else if (previous == mTriggerOverlaps.end() || *current < *previous)
+            queue(*current++, TriggerEventType::Enter);
+        else
+        {
+            queue(*current++, TriggerEventType::Stay);
+            ++previous;
+        }
+    }
+
+    std::swap(mTriggerOverlaps, mCurrentTriggerOverlaps);
+}
+
+void PhysicsManager::updateMovingTree()
+{
+    const auto &colliderPool = mEntityManager->getComponentPool<ECS::Collider>();
+    const auto &pool = mEntityManager->getComponentPool<ECS::RigidBody>();
+
+    // Bodies woken by a contact this tick were not gathered, so re-check every body after the solve
+    auto isAwakeMoving = [&](EntityID entity)
+    {
+        return colliderPool.has(entity) && mEntityManager->hasComponent<ECS::Transform>(entity) &&
+               getBodyType(entity) != ECS::BodyType::Static && pool.get(entity).awake;
+    };
+
+    // Drop bodies that fell asleep, became static or lost their collider since the last sync
+    for (EntityID entity : mMovingEntities)
+    {
+        int32_t &proxy = mMovingProxy[getEntityIndex(entity)];
+        if (proxy != DynamicAABBTree::NULL_NODE && !isAwakeMoving(entity))
+        {
+            mMovingTree.destroyProxy(proxy);
+            proxy = DynamicAABBTree::NULL_NODE;
+        }
+    }
+
+    // Colliders without a RigidBody are static, so walking the bodies is enough
+    mMovingEntities.clear();
+    for (EntityID entity : pool)
+    {
+        if (!isAwakeMoving(entity))
+            continue;
+
+        uint32_t index = getEntityIndex(entity);
+        if (index >= mMovingProxy.size())
+            mMovingProxy.resize(index + 1, DynamicAABBTree::NULL_NODE);
+
+        // Bounds after the solver, which the cached world bounds predate
+        Math::AABB aabb = mCollisionDetector->getColliderAABB(entity, colliderPool.get(entity));
+        if (mMovingProxy[index] == DynamicAABBTree::NULL_NODE)
+            mMovingProxy[index] = mMovingTree.createProxy(aabb, entity);
+        else
+            mMovingTree.moveProxy(mMovingProxy[index], aabb);
+
+        mMovingEntities.push_back(entity);
+    }
+}
+
+void PhysicsManager::setSubsteps(int substeps)
+{
+    mSubsteps = std::max(1, substeps);
+}
+
+uint64_t PhysicsManager::getStateChecksum() const
+{
+    const auto &pool = mEntityManager->getComponentPool<ECS::RigidBody>();
+    std::vector<EntityID> entities = pool.getDenseToEntity();
+    std::sort(entities.begin(), entities.end());
+
+    // FNV-1a over the bit patterns, so -0.0f and 0.0f (or two NaNs) still tell states apart
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&](uint32_t value)
+    {
+        for (int byte = 0; byte < 4; ++byte)
+        {
+            hash ^= (value >> (byte * 8)) & 0xFFu;
+            hash *= 1099511628211ull;
+        }
+    };
+    auto mixFloat = [&](float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        mix(bits);
+    };
+
+    for (EntityID entity : entities)
+    {
+        const ECS::RigidBody &rigidBody = pool.get(entity);
+        mix(getEntityIndex(entity));
+        mix(getEntityGeneration(entity));
+        if (mEntityManager->hasComponent<ECS::Transform>(entity))
+        {
+            const glm::vec2 &position = mEntityManager->getComponent<ECS::Transform>(entity).position;
+            mixFloat(position.x);
+            mixFloat(position.y);
+        }
+        mixFloat(rigidBody.velocity.x);
+        mixFloat(rigidBody.velocity.y);
+        mix(rigidBody.awake ? 1u : 0u);
+    }
+    return hash;
+}
+
+void PhysicsManager::update(float dt)
+{
+    Clock::time_point start = Clock::now();
+    mStats = PhysicsStats{};
+    mStats.tick = mTickCount++;
+    mStats.dt = dt;
+    mStats.substeps = mSubsteps;
+
+    float substepDt = dt / static_cast<float>(mSubsteps);
+    for (int substep = 0; substep < mSubsteps; ++substep)
+    {
+        step(substepDt);
+    }
+    mBodyIntegrator->clearForces();
+
+    mStats.totalMs = millisecondsSince(start, Clock::now());
+    if (mTraceEnabled)
+        mTrace.push_back(mStats);
+}
+
+void PhysicsManager::setTraceEnabled(bool enabled)
+{
+    if (enabled && !mTraceEnabled)
+        mTrace.clear();
+    mTraceEnabled = enabled;
+}
+
+void PhysicsManager::setGravity(const glm::vec2 &gravity)
+{
+    mBodyIntegrator->setGravity(gravity);
+}
+
+const glm::vec2 &PhysicsManager::getGravity() const
+{
+    return mBodyIntegrator->getGravity();
+}
+
+void PhysicsManager::step(float dt)
+{
+    // Transform entities with mobile components : RigidBody
+    auto &pool = mEntityManager->getComponentPool<ECS::RigidBody>();
+    auto &colliderPool = mEntityManager->getComponentPool<ECS::Collider>();
+    size_t sleepingProxies = 0;
+    mContinuous.clear();
+
+    // Each stage adds the time since the previous one ended to its counter
+    Clock::time_point stageStart = Clock::now();
+    auto endStage = [&](double &stageMs)
+    {
+        Clock::time_point now = Clock::now();
+        stageMs += millisecondsSince(stageStart, now);
+        stageStart = now;
+    };
+
+    mBodyIntegrator->clear();
+
+    const auto &bodyEntities = pool.getDenseToEntity();
+    for (size_t i = 0; i < bodyEntities.size(); ++i)
+    {
+        EntityID entity = bodyEntities[i];
+        auto &rigidBody = pool.getDense()[i];
+        if (rigidBody.type == ECS::BodyType::Static)
+            continue;
+
+        if (!rigidBody.awake)
+        {
+            if (rigidBody.type == ECS::BodyType::Dynamic && mSleepEnabled)
             {
-                mCollisionHandler->resolveCollision(entities[i], entities[j], result);
+                sleepingProxies += hasSleepingProxy(entity) && colliderPool.has(entity);
+                continue;
             }
+            wakeBody(entity);
+        }
+        else if (const SleepSlot *slot = findSleepSlot(entity); slot && slot->island != NO_ISLAND)
+        {
+            // Woken from code by setting the flag: take the rest of its island along
+            wakeBody(entity);
+        }
+
+        // Continuous bodies are accelerated with the rest but moved by advanceContinuous() once the static tree is up to date
+        bool continuous = rigidBody.continuous && rigidBody.type == ECS::BodyType::Dynamic;
+        if (continuous)
+            mContinuous.push_back(entity);
+
+        mBodyIntegrator->add(static_cast<uint32_t>(i), rigidBody.type, continuous);
+    }
+
+    // Gravity, forces and damping, then positions, as one pass over parallel arrays
+    mBodyIntegrator->integrate(dt);
+    endStage(mStats.integrateMs);
+
+    // Sleeping bodies deleted, or whose collider was removed, since they fell asleep still have a proxy
+    if (sleepingProxies != mSleepingTree.getProxyCount())
+        pruneSleepingTree();
+
+    // Adding or removing a collider, transform or body reorders the pools and may change which colliders are static:
+    // then every world bound is recomputed and the static colliders rescanned. Otherwise only moving bodies are refreshed.
+    auto &transformPool = mEntityManager->getComponentPool<ECS::Transform>();
+    std::array<uint64_t, 3> poolVersions{colliderPool.getVersion(), transformPool.getVersion(), pool.getVersion()};
+    bool poolsChanged = !mPoolsSeen || poolVersions != mSeenPoolVersions;
+    mSeenPoolVersions = poolVersions;
+    mPoolsSeen = true;
+    if (poolsChanged)
+        mCollisionDetector->updateWorldAABBs(colliderPool);
+
+    // World bounds of the awake moving colliders, shared by every stage below; sleeping bodies are in the sleeping tree
+    mProxies.clear();
+    for (size_t i = 0; i < bodyEntities.size(); ++i)
+    {
+        EntityID entity = bodyEntities[i];
+        const ECS::RigidBody &rigidBody = pool.getDense()[i];
+        if (rigidBody.type == ECS::BodyType::Static || !rigidBody.awake || !colliderPool.has(entity) || !transformPool.has(entity))
+            continue;
+
+        if (!poolsChanged)
+            mCollisionDetector->refreshWorldAABB(entity);
+        mProxies.push_back({entity, mCollisionDetector->getWorldAABB(entity)});
+    }
+
+    updateStaticBodies(poolsChanged);
+    mStats.movingColliders = mProxies.size();
+    mStats.staticColliders = mStaticTree.getProxyCount();
+    mStats.sleepingColliders = mSleepingTree.getProxyCount();
+    endStage(mStats.broadPhaseMs);
+
+    if (!mContinuous.empty())
+    {
+        advanceContinuous(dt);
+
+        // Their proxies were gathered at the start of the sweep; advanceContinuous() refreshed their cached bounds
+        for (BroadPhaseProxy &proxy : mProxies)
+        {
+            const ECS::RigidBody &rigidBody = pool.get(proxy.entity);
+            if (rigidBody.continuous && rigidBody.type == ECS::BodyType::Dynamic)
+                proxy.aabb = mCollisionDetector->getWorldAABB(proxy.entity);
         }
+        endStage(mStats.continuousMs);
+    }
+
+    // Broad-phase over awake moving bodies only, per collision layer; kinematic bodies only respond to each other through triggers
+    mPairs.clear();
+    findLayerPairs();
+    mPairs.erase(std::remove_if(mPairs.begin(), mPairs.end(), [&](const CollisionPair &pair)
+                                { return getBodyType(pair.entityA) == ECS::BodyType::Kinematic &&
+                                         getBodyType(pair.entityB) == ECS::BodyType::Kinematic &&
+                                         !colliderPool.get(pair.entityA).isTrigger && !colliderPool.get(pair.entityB).isTrigger; }),
+                 mPairs.end());
+
+    // Moving bodies against the static tree; static-static pairs are never generated, kinematic-static ones only for triggers.
+    // Every awake moving body against the sleeping tree, so touching a sleeping body wakes it.
+    // Layers are checked as the trees report overlaps, so filtered pairs never reach the narrow-phase.
+    for (const BroadPhaseProxy &proxy : mProxies)
+    {
+        const ECS::Collider &collider = colliderPool.get(proxy.entity);
+        bool isKinematic = getBodyType(proxy.entity) == ECS::BodyType::Kinematic;
+        auto addPair = [&](const DynamicAABBTree &tree, int32_t proxyId, bool triggersOnly)
+        {
+            EntityID other = tree.getEntity(proxyId);
+            const ECS::Collider &otherCollider = colliderPool.get(other);
+            if (triggersOnly && !collider.isTrigger && !otherCollider.isTrigger)
+                return true;
+            if (ECS::canCollide(collider, otherCollider))
+                mPairs.push_back(makeCollisionPair(proxy.entity, other));
+            return true;
+        };
+
+        mStaticTree.query(proxy.aabb, [&](int32_t proxyId)
+                          { return addPair(mStaticTree, proxyId, isKinematic); });
+        mSleepingTree.query(proxy.aabb, [&](int32_t proxyId)
+                            { return addPair(mSleepingTree, proxyId, false); });
+    }
+
+    // Sort so resolution order does not depend on pool layout
+    std::sort(mPairs.begin(), mPairs.end());
+    mStats.broadPhasePairs += mPairs.size();
+    mStats.narrowPhaseTests += mPairs.size();
+    endStage(mStats.broadPhaseMs);
+
+    auto isAwakeDynamic = [&](EntityID entity)
+    {
+        return pool.has(entity) && pool.get(entity).type == ECS::BodyType::Dynamic && pool.get(entity).awake;
+    };
+
+    runNarrowPhase();
+    updateTriggers();
+    findTileMapContacts();
+
+    // A script may still be reading last tick's records; leave those to it
+    if (mContactRecords.use_count() > 1)
+        mContactRecords = std::make_shared<std::vector<ContactRecord>>();
+    mContactRecords->resize(mContacts.size());
+    for (size_t i = 0; i < mContacts.size(); ++i)
+    {
+        const auto &[pair, result] = mContacts[i];
+        (*mContactRecords)[i] = {pair.entityA, pair.entityB, result.normal.x, result.normal.y, result.penetration};
+    }
+
+    // Wake on contact: a sleeping side came from the sleeping tree
+    for (const auto &contact : mContacts)
+    {
+        for (EntityID entity : {contact.first.entityA, contact.first.entityB})
+        {
+            if (hasSleepingProxy(entity))
+                wakeBody(entity);
+        }
+    }
+
+    mStats.contacts += mContacts.size();
+    mStats.triggerOverlaps += mTriggerOverlaps.size();
+    endStage(mStats.narrowPhaseMs);
+
+    // Resolve every contact together, in pair order, independent of how the narrow-phase was split across threads
+    mContactSolver->solve(mContacts);
+    mStats.velocityIterations += mContactSolver->getVelocityIterations();
+    mStats.positionIterations += mContactSolver->getPositionIterations();
+    endStage(mStats.solverMs);
+
+    // Candidate bounds touch, so the pair links islands even once resting contact is corrected to zero penetration
+    mTouching.clear();
+    for (const CollisionPair &pair : mPairs)
+    {
+        if (isAwakeDynamic(pair.entityA) && isAwakeDynamic(pair.entityB) &&
+            !colliderPool.get(pair.entityA).isTrigger && !colliderPool.get(pair.entityB).isTrigger)
+            mTouching.emplace_back(pool.getDenseIndex(pair.entityA), pool.getDenseIndex(pair.entityB));
+    }
+
+    updateSleep(dt);
+    updateMovingTree();
+    endStage(mStats.sleepMs);
+}
+
+bool PhysicsManager::getQueryShape(EntityID entity, uint32_t mask, QueryShape &shape) const
+{
+    // Trees are only synced by update(), so an entity may have changed since
+    if (!mEntityManager->hasComponent<ECS::Collider>(entity) || !mEntityManager->hasComponent<ECS::Transform>(entity))
+        return false;
+
+    shape.collider = &mEntityManager->getComponent<ECS::Collider>(entity);
+    if ((shape.collider->category & mask) == 0)
+        return false;
+
+    shape.aabb = mCollisionDetector->getColliderAABB(entity, *shape.collider);
+    shape.center = mEntityManager->getComponent<ECS::Transform>(entity).position + shape.collider->offset;
+    shape.oriented = mCollisionDetector->getWorldPolygon(entity, *shape.collider, shape.polygon);
+    return true;
+}
+
+bool PhysicsManager::getWorldPolygon(EntityID entity, Math::Polygon &polygon) const
+{
+    if (!mEntityManager->hasComponent<ECS::Collider>(entity) || !mEntityManager->hasComponent<ECS::Transform>(entity))
+        return false;
+    return mCollisionDetector->getWorldPolygon(entity, mEntityManager->getComponent<ECS::Collider>(entity), polygon);
+}
+
+void PhysicsManager::raycast(const glm::vec2 &origin, const glm::vec2 &delta, std::vector<EntityID> &entities,
+                             size_t maxHits, uint32_t mask) const
+{
+    std::vector<std::pair<float, EntityID>> hits;
+    float maxFraction = 1.0f;
+
+    for (const DynamicAABBTree *tree : getQueryTrees())
+    {
+        tree->raycast(origin, delta, maxFraction, [&](int32_t proxyId, float currentMax)
+                      {
+            EntityID entity = tree->getEntity(proxyId);
+            QueryShape shape;
+            if (!getQueryShape(entity, mask, shape))
+                return currentMax;
+
+            float fraction = 0.0f;
+            bool hit = shape.oriented ? Math::raycastPolygon(origin, delta, shape.polygon, currentMax, fraction)
+                       : shape.collider->type == ECS::ColliderType::Circle
+                           ? Math::raycastCircle(origin, delta, shape.center, shape.collider->radius, currentMax, fraction)
+                           : Math::raycastAABB(origin, delta, shape.aabb, currentMax, fraction);
+            if (!hit)
+                return currentMax;
+
+            hits.emplace_back(fraction, entity);
+            if (maxHits == 0 || hits.size() < maxHits)
+                return currentMax;
+
+            // Keep the maxHits nearest and clip the ray to the farthest of them
+            std::nth_element(hits.begin(), hits.begin() + (maxHits - 1), hits.end());
+            hits.resize(maxHits);
+            maxFraction = hits.back().first;
+            return maxFraction; });
     }
-}
\ No newline at end of file
+
+    std::sort(hits.begin(), hits.end());
+    if (maxHits != 0 && hits.size() > maxHits)
+        hits.resize(maxHits);
+
+    for (const auto &hit : hits)
+    {
+        entities.push_back(hit.second);
+    }
+}
+
+void PhysicsManager::queryAABB(const Math::AABB &region, std::vector<EntityID> &entities, uint32_t mask) const
+{
+    size_t first = entities.size();
+    Math::Polygon regionPolygon;
+    Math::transformPolygon(Math::makeBox((region.max - region.min) * 0.5f), (region.min + region.max) * 0.5f, Math::Rotation{},
+                           glm::vec2(1.0f, 1.0f), regionPolygon);
+    for (const DynamicAABBTree *tree : getQueryTrees())
+    {
+        tree->query(region, [&](int32_t proxyId)
+                    {
+            EntityID entity = tree->getEntity(proxyId);
+            QueryShape shape;
+            if (!getQueryShape(entity, mask, shape))
+                return true;
+
+            bool hit = shape.oriented ? Math::checkPolygonOverlap(shape.polygon, regionPolygon)
+                       : shape.collider->type == ECS::ColliderType::Circle
+                           ? Math::checkAABBCircleCollision(region, shape.center, shape.collider->radius)
+                           : Math::checkAABBOverlap(shape.aabb, region);
+            if (hit)
+                entities.push_back(entity);
+            return true; });
+    }
+
+    std::sort(entities.begin() + first, entities.end());
+}
+
+void PhysicsManager::queryCircle(const glm::vec2 &center, float radius, std::vector<EntityID> &entities, uint32_t mask) const
+{
+    size_t first = entities.size();
+    Math::AABB region{center - glm::vec2(radius, radius), center + glm::vec2(radius, radius)};
+    for (const DynamicAABBTree *tree : getQueryTrees())
+    {
+        tree->query(region, [&](int32_t proxyId)
+                    {
+            EntityID entity = tree->getEntity(proxyId);
+            QueryShape shape;
+            if (!getQueryShape(entity, mask, shape))
+                return true;
+
+            bool hit = shape.oriented ? Math::collidePolygonCircle(shape.polygon, center, radius).isColliding
+                       : shape.collider->type == ECS::ColliderType::Circle
+                           ? glm::distance(center, shape.center) <= radius + shape.collider->radius
+                           : Math::checkAABBCircleCollision(shape.aabb, center, radius);
+            if (hit)
+                entities.push_back(entity);
+            return true; });
+    }
+
+    std::sort(entities.begin() + first, entities.end());
+}
+
+void PhysicsManager::queryNearest(const glm::vec2 &point, size_t k, std::vector<EntityID> &entities,
+                                  float maxDistance, uint32_t mask) const
+{
+    if (k == 0)
+        return;
+
+    // Max-heap of the k best (distance, entity) so far; its top bounds the rest of the search
+    std::vector<std::pair<float, EntityID>> best;
+    best.reserve(k);
+
+    for (const DynamicAABBTree *tree : getQueryTrees())
+    {
+        tree->nearest(point, maxDistance, [&](int32_t proxyId, float currentMax)
+                      {
+            EntityID entity = tree->getEntity(proxyId);
+            QueryShape shape;
+            if (!getQueryShape(entity, mask, shape))
+                return currentMax;
+
+            float distance = shape.oriented ? Math::distanceToPolygon(point, shape.polygon)
+                             : shape.collider->type == ECS::ColliderType::Circle
+                                 ? std::fmax(glm::distance(point, shape.center) - shape.collider->radius, 0.0f)
+                                 : Math::distanceToAABB(point, shape.aabb);
+            if (distance > currentMax)
+                return currentMax;
+
+            std::pair<float, EntityID> candidate{distance, entity};
+            if (best.size() < k)
+            {
+                best.push_back(candidate);
+                std::push_heap(best.begin(), best.end());
+            }
+            else if (candidate < best.front())
+            {
+                std::pop_heap(best.begin(), best.end());
+                best.back() = candidate;
+                std::push_heap(best.begin(), best.end());
+            }
+
+            if (best.size() == k)
+                maxDistance = best.front().first;
+            return maxDistance; });
+    }
+
+    std::sort_heap(best.begin(), best.end());
+    for (const auto &entry : best)
+    {
+        entities.push_back(entry.second);
+    }
+}
@@ -3,11 +3,52 @@
 
 #pragma once
 
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
+#include "broadphase/IBroadPhase.h"
+#include "broadphase/DynamicAABBTree.h"
+#include "ContactSolver.h"
+#include "PhysicsStats.h"
+#include "Polygon.h"
+#include "../core/ecs/components/RigidBody.h"
+#include "../core/ecs/components/Collider.h"
 
 class EntityManager;
 class CollisionDetector;
-class CollisionHandler;
+class BodyIntegrator;
+class JobPool;
+
+/** @brief Phase of an overlap between a trigger collider and another collider. */
+enum class TriggerEventType
+{
+    Enter, ///< Started overlapping during the tick
+    Stay,  ///< Overlapped before the tick and still does
+    Exit   ///< Overlapped before the tick and no longer does, or one side lost its collider
+};
+
+/** @brief One solid contact of a tick, laid out for scripts: two 8-byte IDs, three floats and 4 zero bytes. */
+struct ContactRecord
+{
+    EntityID entityA;     ///< Lower entity ID of the pair
+    EntityID entityB;     ///< Higher entity ID of the pair
+    float normalX;        ///< Normal pushing A away from B
+    float normalY;
+    float penetration;    ///< Overlap depth found by the narrow-phase, before resolution
+    uint32_t padding{0};  ///< Keeps the 8-byte alignment explicit, so no uninitialised byte reaches scripts
+};
+static_assert(sizeof(ContactRecord) == 32, "ContactRecord is exposed to scripts as a packed buffer");
+
+/** @brief One trigger overlap change, queued by PhysicsManager::update(). */
+struct TriggerEvent
+{
+    EntityID trigger;      ///< Entity with the trigger collider (the lower ID when both are triggers)
+    EntityID other;        ///< Entity overlapping it
+    TriggerEventType type;
+};
 
 class PhysicsManager
 {
@@ -19,12 +60,349 @@ public:
     PhysicsManager(const PhysicsManager &) = delete;
     PhysicsManager &operator=(const PhysicsManager &) = delete;
 
+    /**
+     * @brief Advance the simulation by @p dt, split into getSubsteps() equal steps.
+     *
+     * The result depends only on component values, never on component pool order or thread count:
+     * contacts are resolved in pair order and ties are broken by entity ID. Building with
+     * 2DNGE_STRICT_FP (the default) keeps the compiler from fusing multiply-adds, so CPUs with
+     * and without FMA agree bit for bit too.
+     */
     void update(float dt);
 
+    /**
+     * @brief Split every update() into @p substeps steps of dt / substeps. Values below 1 are raised to 1.
+     * Contacts then describe the last substep; trigger events are queued by every substep.
+     */
+    void setSubsteps(int substeps);
+    int getSubsteps() const { return mSubsteps; }
+
+    /**
+     * @brief Acceleration applied to every dynamic body each step, scaled by its RigidBody::gravityScale. Defaults to none.
+     * Velocities are integrated before positions (semi-implicit Euler), together with each body's
+     * accumulated force and linear damping; forces are cleared at the end of update().
+     */
+    void setGravity(const glm::vec2 &gravity);
+    const glm::vec2 &getGravity() const;
+
+    /** @brief Counters and stage times of the last update(). */
+    const PhysicsStats &getStats() const { return mStats; }
+
+    /**
+     * @brief Append a copy of getStats() to the trace after every update(), for PhysicsTrace::writeCSV() and writeJSON().
+     * Enabling a disabled trace starts it empty. It grows by one entry per update() until cleared.
+     */
+    void setTraceEnabled(bool enabled);
+    bool isTraceEnabled() const { return mTraceEnabled; }
+    const std::vector<PhysicsStats> &getTrace() const { return mTrace; }
+    void clearTrace() { mTrace.clear(); }
+
+    /**
+     * @brief Hash of every rigid body's position, velocity and sleep state, taken in entity order.
+     * Worlds that start alike and receive the same updates agree on it, so lockstep peers and
+     * replays can compare it every tick to detect a desync.
+     */
+    uint64_t getStateChecksum() const;
+
+    /**
+     * @brief Replace the broad-phase used to find candidate pairs.
+     * Defaults to a SpatialHashBroadPhase with its default cell size.
+     */
+    void setBroadPhase(std::unique_ptr<IBroadPhase> broadPhase);
+    IBroadPhase *getBroadPhase() const { return mBroadPhase.get(); }
+
+    /**
+     * @brief Number of collision layer buckets in the last update(): distinct category/mask combinations
+     * among awake moving colliders. Each bucket has its own broad-phase; the default layer uses getBroadPhase().
+     */
+    size_t getLayerBucketCount() const { return mLayerBuckets.size(); }
+
+    /** @brief Candidate pairs (broad-phase plus static tree) from the last update(), sorted ascending. */
+    const std::vector<CollisionPair> &getCandidatePairs() const { return mPairs; }
+
+    /** @brief Tree over the static colliders; dynamic bodies are tested against it instead of the broad-phase. */
+    const DynamicAABBTree &getStaticTree() const { return mStaticTree; }
+
+    /**
+     * @brief Apply a hand-made change to a static collider at the next update(): a moved or rotated Transform,
+     * an edited Collider, or a RigidBody whose type was switched to or from Static.
+     *
+     * Static colliders are only looked at again when marked here or when a Collider, Transform or RigidBody
+     * is added or removed anywhere; other ticks cost nothing per static collider. Harmless for other entities.
+     */
+    void markStaticDirty(EntityID entity) { mDirtyStatic.push_back(entity); }
+
+    /** @brief Number of updates that rescanned every static collider because components were added or removed. */
+    size_t getStaticRescanCount() const { return mStaticRescanCount; }
+
+    static constexpr float DEFAULT_SLEEP_VELOCITY = 1.0f; ///< World units per second
+    static constexpr float DEFAULT_TIME_TO_SLEEP = 0.5f;  ///< Seconds
+
+    /**
+     * @brief Configure automatic sleeping.
+     *
+     * A group of dynamic bodies in contact (an island) falls asleep once every body in it
+     * has moved slower than @p velocityThreshold for @p timeToSleep seconds. Sleeping bodies
+     * are skipped by integration and by the pair tests until something awake touches them.
+     * Disabling sleep wakes every sleeping body.
+     */
+    void setSleepParameters(bool enabled, float velocityThreshold = DEFAULT_SLEEP_VELOCITY, float timeToSleep = DEFAULT_TIME_TO_SLEEP);
+    bool isSleepEnabled() const { return mSleepEnabled; }
+
+    /** @brief Wake a body and the island it fell asleep with. No-op for entities without a RigidBody. */
+    void wakeBody(EntityID entity);
+
+    /** @brief Tree over sleeping bodies; awake bodies are tested against it to wake them on contact. */
+    const DynamicAABBTree &getSleepingTree() const { return mSleepingTree; }
+
+    static constexpr int MAX_CCD_SUBSTEPS = 4; ///< Impacts a continuous body can resolve in one tick; it stops at the last one
+
+    static constexpr size_t MIN_PAIRS_PER_THREAD = 256; ///< Below this many candidate pairs per thread the narrow-phase stays on one thread
+
+    /**
+     * @brief Number of threads the narrow-phase is split across, including the calling thread.
+     * 0 (the default) uses every hardware thread; 1 keeps the whole step on the calling thread.
+     * Contacts are resolved in candidate pair order either way, so the result does not depend on it.
+     */
+    void setThreadCount(size_t threadCount);
+    size_t getThreadCount() const;
+
+    /** @brief Solver that resolves the contacts of each tick; configure its iterations and warm starting here. */
+    ContactSolver &getContactSolver() { return *mContactSolver; }
+    const ContactSolver &getContactSolver() const { return *mContactSolver; }
+
+    /**
+     * @brief Colliding pairs found by the last update(), in candidate pair order, before they were resolved.
+     * Contacts with a TileMapCollider entity come once per merged tile rectangle touched.
+     */
+    const std::vector<Contact> &getContacts() const { return mContacts; }
+
+    /** @brief getContacts() packed into contiguous records, rebuilt by every update(). */
+    const std::vector<ContactRecord> &getContactRecords() const { return *mContactRecords; }
+
+    /**
+     * @brief Shared ownership of the records getContactRecords() returns, for holders that outlive the tick.
+     * While any copy is held, update() writes the next tick's records to a new buffer instead of reusing this one.
+     */
+    std::shared_ptr<const std::vector<ContactRecord>> shareContactRecords() const { return mContactRecords; }
+
+    /**
+     * @brief Trigger events queued since the last drain, oldest first.
+     *
+     * Contacts involving a trigger collider are never resolved. Instead each update() compares
+     * them with the previous tick's trigger overlaps and queues an Enter, Stay or Exit event per
+     * overlap. Events accumulate over several updates until drained, so drain them once per frame.
+     */
+    const std::vector<TriggerEvent> &getTriggerEvents() const { return mTriggerEvents; }
+
+    /** @brief Move the queued trigger events out, leaving the queue empty. */
+    std::vector<TriggerEvent> drainTriggerEvents();
+
+    /**
+     * @brief World bounds of every collider as the last update() tested them, before contacts were resolved.
+     * Indexed by dense collider index; getWorldAABBEntities() gives the entity of each entry.
+     */
+    const std::vector<Math::AABB> &getWorldAABBs() const;
+    const std::vector<EntityID> &getWorldAABBEntities() const;
+
+    /*
+     * Spatial queries. They run against the static, sleeping and moving trees as the last update()
+     * left them, then test each candidate's collider shape at its current position, so colliders
+     * added or moved by code since then may be missed. Only colliders whose category shares a bit
+     * with @p mask are reported, triggers included. Results are appended to @p entities. The trees
+     * share a traversal stack, so queries must not run on several threads at once.
+     */
+
+    /**
+     * @brief Colliders touched by the segment origin -> origin + delta, nearest first.
+     * @param maxHits Stop at this many hits, clipping the ray to the last one kept; 0 reports every hit
+     */
+    void raycast(const glm::vec2 &origin, const glm::vec2 &delta, std::vector<EntityID> &entities,
+                 size_t maxHits = 0, uint32_t mask = 0xFFFFFFFF) const;
+
+    /** @brief Colliders overlapping or touching @p region, in ascending entity order. */
+    void queryAABB(const Math::AABB &region, std::vector<EntityID> &entities, uint32_t mask = 0xFFFFFFFF) const;
+
+    /** @brief Colliders overlapping or touching the circle, in ascending entity order. */
+    void queryCircle(const glm::vec2 &center, float radius, std::vector<EntityID> &entities, uint32_t mask = 0xFFFFFFFF) const;
+
+    /**
+     * @brief The @p k colliders closest to @p point and no farther than @p maxDistance, nearest first.
+     * Distance is measured to the collider's shape, so every collider containing @p point is at distance 0.
+     */
+    void queryNearest(const glm::vec2 &point, size_t k, std::vector<EntityID> &entities,
+                      float maxDistance = INFINITY, uint32_t mask = 0xFFFFFFFF) const;
+
+    /**
+     * @brief Current world polygon of a polygon collider, or of a box collider on a rotated Transform.
+     * @return False for circles, unrotated boxes and entities without a collider and transform
+     */
+    bool getWorldPolygon(EntityID entity, Math::Polygon &polygon) const;
+
+    /** @brief Tree over the awake moving colliders, refreshed with their resolved bounds at the end of every update(). */
+    const DynamicAABBTree &getMovingTree() const { return mMovingTree; }
+
 private:
+    /** @brief One substep of update(). */
+    void step(float dt);
+
+    /** @brief Body type of an entity; colliders without a RigidBody are static. */
+    ECS::BodyType getBodyType(EntityID entity) const;
+
+    /**
+     * @brief Bring the static tree up to date: every static collider when @p rescan, else only the
+     * ones passed to markStaticDirty(). Leaves of unchanged static colliders are not touched.
+     */
+    void updateStaticBodies(bool rescan);
+
+    /** @brief Create, move or destroy the static tree leaf of @p entity to match its current components. */
+    void syncStaticProxy(EntityID entity);
+
+    /** @brief Advance sleep timers and put islands whose bodies have all been resting long enough to sleep. */
+    void updateSleep(float dt);
+
+    /** @brief Wake every body that fell asleep in island @p island and release the island slot. */
+    void wakeIsland(uint32_t island);
+
+    /** @brief Remove an entity from the sleeping tree if it is in it. */
+    void removeSleepingProxy(EntityID entity);
+
+    /** @brief True while @p entity is asleep with a collider in the sleeping tree. */
+    bool hasSleepingProxy(EntityID entity) const;
+
+    /** @brief Drop sleeping proxies whose entity was deleted, woken from code or lost its collider. */
+    void pruneSleepingTree();
+
+    /**
+     * @brief Move continuous bodies by sweeping them against the static and sleeping trees.
+     * Each impact stops the body at its time of impact, removes its approach velocity (with
+     * restitution) and sweeps the rest of the tick from there.
+     */
+    void advanceContinuous(float dt);
+
+    /**
+     * @brief Earliest impact of @p entity moving by @p delta; @p fraction is left untouched if nothing is hit sooner.
+     * An impact at the same fraction as the current one, @p hitEntity, only wins if @p other has a lower ID.
+     */
+    bool sweepCollider(EntityID entity, const ECS::Collider &collider, const glm::vec2 &delta, EntityID other,
+                       EntityID hitEntity, float &fraction, glm::vec2 &normal) const;
+
+    /**
+     * @brief Bucket the moving proxies by collision layer and append the overlapping pairs of interacting layers to mPairs.
+     * Pairs inside a bucket come from its broad-phase; pairs between two buckets from findCrossPairs().
+     * Buckets whose layers do not interact are never tested against each other.
+     */
+    void findLayerPairs();
+
+    /** @brief Append every overlapping pair with one proxy from @p a and the other from @p b to mPairs. */
+    void findCrossPairs(const std::vector<BroadPhaseProxy> &a, const std::vector<BroadPhaseProxy> &b);
+
+    /** @brief Test every candidate pair, possibly on several threads, and merge the colliding ones into mContacts in pair order. */
+    void runNarrowPhase();
+
+    /**
+     * @brief Test every awake dynamic collider against the rectangles of the tile maps under its bounds, and merge the
+     * colliding ones into mContacts in pair order. A body touching several rectangles of one map gets one contact per rectangle.
+     */
+    void findTileMapContacts();
+
+    /** @brief Move trigger contacts out of mContacts and queue events against the previous tick's trigger overlaps. */
+    void updateTriggers();
+
+    /** @brief Whether an entity still has a trigger collider. */
+    bool isTrigger(EntityID entity) const;
+
+    /** @brief Sync the moving tree with the awake moving colliders once contacts are resolved and sleep is updated. */
+    void updateMovingTree();
+
+    /** @brief Current shape of a collider as the queries test it. */
+    struct QueryShape
+    {
+        const ECS::Collider *collider{nullptr};
+        Math::AABB aabb;              ///< World bounds; the exact shape of an unrotated box
+        glm::vec2 center{0.0f, 0.0f}; ///< Shape centre; with the radius, the exact shape of a circle
+        bool oriented{false};         ///< Whether polygon holds the shape (polygons and rotated boxes)
+        Math::Polygon polygon;
+    };
+
+    /**
+     * @brief Current shape of a collider reported by a query tree, for the exact test.
+     * @return False if the entity has since lost its collider or transform, or its category is not in @p mask
+     */
+    bool getQueryShape(EntityID entity, uint32_t mask, QueryShape &shape) const;
+
+    /** @brief Trees spatial queries run against; between them they hold every collider exactly once. */
+    std::array<const DynamicAABBTree *, 3> getQueryTrees() const { return {&mMovingTree, &mSleepingTree, &mStaticTree}; }
+
+    uint32_t findIsland(uint32_t body);
+
+    static constexpr uint32_t NO_ISLAND = UINT32_MAX;
+
+    /** @brief Sleep state of the body that last fell asleep at one entity index; stale once a newer entity reuses the index. */
+    struct SleepSlot
+    {
+        EntityID entity{0};                        ///< Body the state belongs to
+        uint32_t island{NO_ISLAND};                ///< Island slot it fell asleep in (or NO_ISLAND once woken)
+        int32_t proxy{DynamicAABBTree::NULL_NODE}; ///< Its proxy in mSleepingTree (or NULL_NODE)
+    };
+
+    /** @brief The sleep state of @p entity, or nullptr if it never slept or its index now belongs to another entity. */
+    SleepSlot *findSleepSlot(EntityID entity);
+    const SleepSlot *findSleepSlot(EntityID entity) const;
+
+    /** @brief Awake moving colliders sharing one category/mask combination. */
+    struct LayerBucket
+    {
+        uint32_t category;
+        uint32_t mask;
+        std::unique_ptr<IBroadPhase> broadPhase; ///< Created from mBroadPhase once the bucket collides with itself (unused by the default layer)
+        std::vector<BroadPhaseProxy> proxies;    ///< Per-tick proxies of the bucket
+    };
+
     EntityManager *mEntityManager;                         ///< Pointer to the EntityManager for accessing entities and their components
     std::unique_ptr<CollisionDetector> mCollisionDetector; ///< Pointer to the CollisionDetector for checking collisions
-    std::unique_ptr<CollisionHandler> mCollisionHandler;   ///< Pointer to the CollisionHandler for resolving collisions
+    std::unique_ptr<ContactSolver> mContactSolver;         ///< Pointer to the ContactSolver for resolving collisions
+    std::unique_ptr<BodyIntegrator> mBodyIntegrator;       ///< Integrates the awake moving bodies of each step
+    std::unique_ptr<IBroadPhase> mBroadPhase;              ///< Broad-phase stage that culls pairs before narrow-phase testing
+    int mSubsteps{1};                                      ///< Steps each update() is split into
+    uint64_t mTickCount{0};                                ///< Number of update() calls so far
+    PhysicsStats mStats;                                   ///< Counters of the last update(), reset by each one
+    bool mTraceEnabled{false};                             ///< Whether update() appends mStats to mTrace
+    std::vector<PhysicsStats> mTrace;                      ///< Per-update() stats recorded while tracing
+    std::vector<BroadPhaseProxy> mProxies;                 ///< Per-tick world bounds of every kinematic and dynamic collider, reused between ticks
+    DynamicAABBTree mStaticTree{0.0f};                     ///< Static colliders, edited leaf by leaf as they change
+    std::vector<int32_t> mStaticProxy;                     ///< getEntityIndex(EntityID) -> leaf in mStaticTree (or NULL_NODE)
+    std::vector<EntityID> mDirtyStatic;                    ///< Entities passed to markStaticDirty() since the last update()
+    std::array<uint64_t, 3> mSeenPoolVersions{};           ///< Collider, Transform and RigidBody pool versions at the last update()
+    bool mPoolsSeen{false};                                ///< Whether mSeenPoolVersions has been filled yet
+    size_t mStaticRescanCount{0};                          ///< Number of full static rescans so far
+    std::vector<LayerBucket> mLayerBuckets;                ///< Collision layers seen in the last update(), kept while they have proxies
+    std::vector<BroadPhaseProxy> mSweepA;                  ///< Scratch copy of one bucket sorted by min.x, used by findCrossPairs()
+    std::vector<BroadPhaseProxy> mSweepB;                  ///< Scratch copy of the other bucket
+    std::vector<CollisionPair> mPairs;                     ///< Per-tick candidate pairs, reused between ticks
+    std::vector<EntityID> mContinuous;                     ///< Per-tick awake continuous bodies, integrated by advanceContinuous()
+    std::unique_ptr<JobPool> mJobPool;                     ///< Threads the narrow-phase is split across
+    std::vector<std::vector<Contact>> mThreadContacts;     ///< Per-thread narrow-phase output, reused between ticks
+    std::vector<Contact> mContacts;                        ///< Per-tick colliding pairs merged from mThreadContacts, minus trigger overlaps
+    std::vector<Contact> mTileContacts;                    ///< Per-tick contacts against tile maps, merged into mContacts
+    std::shared_ptr<std::vector<ContactRecord>> mContactRecords; ///< Per-tick mContacts in script-facing layout, replaced while shared
+    DynamicAABBTree mMovingTree;                           ///< Awake moving colliders for spatial queries, with fat leaves so most ticks move nothing
+    std::vector<int32_t> mMovingProxy;                     ///< getEntityIndex(EntityID) -> proxy in mMovingTree (or NULL_NODE)
+    std::vector<EntityID> mMovingEntities;                 ///< Entities in mMovingTree, in the order they were synced
+    std::vector<CollisionPair> mTriggerOverlaps;           ///< Trigger pairs overlapping after the last update(), sorted
+    std::vector<CollisionPair> mCurrentTriggerOverlaps;    ///< Per-tick trigger pairs, swapped into mTriggerOverlaps once diffed
+    std::vector<TriggerEvent> mTriggerEvents;              ///< Events queued since the last drainTriggerEvents()
+
+    bool mSleepEnabled{true};                              ///< Whether resting islands are put to sleep
+    float mSleepVelocity{DEFAULT_SLEEP_VELOCITY};          ///< Speed below which a body counts as resting
+    float mTimeToSleep{DEFAULT_TIME_TO_SLEEP};             ///< Resting time after which an island falls asleep
+    DynamicAABBTree mSleepingTree{0.0f};                   ///< Colliders of sleeping bodies, updated as bodies fall asleep and wake
+    std::vector<SleepSlot> mSleepSlots;                    ///< getEntityIndex(EntityID) -> sleep state of the body that last slept there
+    std::vector<std::vector<EntityID>> mIslands;           ///< Island slot -> bodies that fell asleep together
+    std::vector<uint32_t> mFreeIslands;                    ///< Released island slots
+    std::vector<std::pair<uint32_t, uint32_t>> mTouching;  ///< Per-tick touching pairs of awake dynamic bodies, as RigidBody pool indices
+    std::vector<uint32_t> mIslandParent;                   ///< Per-tick union-find over RigidBody pool indices
+    std::vector<float> mIslandSleepTime;                   ///< Per-tick shortest sleepTime of each island, indexed by root
 };
 
-#endif
\ No newline at end of file
+#endif
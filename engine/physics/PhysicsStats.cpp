@@ -0,0 +1,40 @@
+#include "PhysicsStats.h"
+
+namespace PhysicsTrace
+{
+    void writeCSV(std::ostream &out, const std::vector<PhysicsStats> &trace)
+    {
+        const char *separator = "";
+        forEachField(PhysicsStats{}, [&](const char *name, const auto &)
+                     {
+            out << separator << name;
+            separator = ","; });
+        out << '\n';
+
+        for (const PhysicsStats &stats : trace)
+        {
+            separator = "";
+            forEachField(stats, [&](const char *, const auto &value)
+                         {
+                out << separator << value;
+                separator = ","; });
+            out << '\n';
+        }
+    }
+
+    void writeJSON(std::ostream &out, const std::vector<PhysicsStats> &trace)
+    {
+        out << '[';
+        for (size_t i = 0; i < trace.size(); ++i)
+        {
+            out << (i == 0 ? "\n  {" : ",\n  {");
+            const char *separator = "";
+            forEachField(trace[i], [&](const char *name, const auto &value)
+                         {
+                out << separator << '"' << name << "\": " << value;
+                separator = ", "; });
+            out << '}';
+        }
+        out << (trace.empty() ? "]\n" : "\n]\n");
+    }
+}
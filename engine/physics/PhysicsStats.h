@@ -0,0 +1,77 @@
+#ifndef PHYSICSSTATS_H
+#define PHYSICSSTATS_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * @brief Work done and time spent by one PhysicsManager::update(), summed over its substeps.
+ *
+ * Counts describe what each stage was handed, so a level whose collider count grows shows up
+ * as more pairs or tests before it shows up as time. Times are wall-clock milliseconds.
+ */
+struct PhysicsStats
+{
+    uint64_t tick{0};                ///< Index of the update(), counting from 0
+    float dt{0.0f};                  ///< Time step passed to update()
+    int substeps{0};
+
+    size_t movingColliders{0};       ///< Awake kinematic and dynamic colliders, last substep
+    size_t staticColliders{0};       ///< Colliders in the static tree, last substep
+    size_t sleepingColliders{0};     ///< Colliders in the sleeping tree, last substep
+
+    size_t broadPhasePairs{0};       ///< Candidate pairs from the broad-phase and the static and sleeping trees
+    size_t narrowPhaseTests{0};      ///< Shape tests: every candidate pair plus every tile map rectangle tested
+    size_t contacts{0};              ///< Solid contacts handed to the solver
+    size_t triggerOverlaps{0};       ///< Overlaps involving a trigger collider
+    size_t velocityIterations{0};    ///< Solver velocity iterations run
+    size_t positionIterations{0};    ///< Solver position iterations run
+
+    double integrateMs{0.0};         ///< Body classification and velocity and position integration
+    double broadPhaseMs{0.0};        ///< World bounds, static tree upkeep, broad-phase and tree queries
+    double continuousMs{0.0};        ///< Continuous collision sweeps
+    double narrowPhaseMs{0.0};       ///< Shape tests, trigger events and tile map contacts
+    double solverMs{0.0};            ///< Contact solver
+    double sleepMs{0.0};             ///< Islands, sleep and the query tree sync
+    double totalMs{0.0};             ///< The whole update()
+};
+
+namespace PhysicsTrace
+{
+    /** @brief Call @p visit(name, value) for every field in declaration order, under the snake_case names the trace and scripts use. */
+    template <typename Visitor>
+    void forEachField(const PhysicsStats &stats, Visitor &&visit)
+    {
+        visit("tick", stats.tick);
+        visit("dt", stats.dt);
+        visit("substeps", stats.substeps);
+        visit("moving_colliders", stats.movingColliders);
+        visit("static_colliders", stats.staticColliders);
+        visit("sleeping_colliders", stats.sleepingColliders);
+        visit("broad_phase_pairs", stats.broadPhasePairs);
+        visit("narrow_phase_tests", stats.narrowPhaseTests);
+        visit("contacts", stats.contacts);
+        visit("trigger_overlaps", stats.triggerOverlaps);
+        visit("velocity_iterations", stats.velocityIterations);
+        visit("position_iterations", stats.positionIterations);
+        visit("integrate_ms", stats.integrateMs);
+        visit("broad_phase_ms", stats.broadPhaseMs);
+        visit("continuous_ms", stats.continuousMs);
+        visit("narrow_phase_ms", stats.narrowPhaseMs);
+        visit("solver_ms", stats.solverMs);
+        visit("sleep_ms", stats.sleepMs);
+        visit("total_ms", stats.totalMs);
+    }
+
+    /** @brief A header line of snake_case field names, then one line per update(). */
+    void writeCSV(std::ostream &out, const std::vector<PhysicsStats> &trace);
+
+    /** @brief A JSON array with one object per update(), keyed by the same names as the CSV columns. */
+    void writeJSON(std::ostream &out, const std::vector<PhysicsStats> &trace);
+}
+
+#endif
@@ -0,0 +1,329 @@
+#include "Polygon.h"
+
+#include <algorithm>
+#include <cfloat>
+
+namespace
+{
+    /** A face of b must beat a's by this much (world units) to become the reference face, so the choice does not flicker. */
+    constexpr float REFERENCE_FACE_TOLERANCE = 0.0005f;
+
+    float cross(const glm::vec2 &origin, const glm::vec2 &a, const glm::vec2 &b)
+    {
+        return (a.x - origin.x) * (b.y - origin.y) - (a.y - origin.y) * (b.x - origin.x);
+    }
+
+    glm::vec2 edgeNormal(const glm::vec2 &from, const glm::vec2 &to)
+    {
+        glm::vec2 edge = to - from;
+        return glm::vec2(edge.y, -edge.x) / std::sqrt(Math::dot(edge, edge));
+    }
+
+    /** @brief Largest separation of @p b from any face of @p a; negative when every face sees penetration. */
+    float findMaxSeparation(const Math::Polygon &a, const Math::Polygon &b, int &face)
+    {
+        float maxSeparation = -FLT_MAX;
+        face = 0;
+        for (int i = 0; i < a.count; ++i)
+        {
+            float separation = FLT_MAX;
+            for (int j = 0; j < b.count; ++j)
+            {
+                separation = std::min(separation, Math::dot(a.normals[i], b.vertices[j] - a.vertices[i]));
+            }
+
+            if (separation > maxSeparation)
+            {
+                maxSeparation = separation;
+                face = i;
+            }
+        }
+        return maxSeparation;
+    }
+
+    /** @brief Keep the part of segment @p in where dot(normal, p) <= offset; returns the number of points written. */
+    int clipSegment(const glm::vec2 in[2], glm::vec2 out[2], const glm::vec2 &normal, float offset)
+    {
+        int count = 0;
+        float distance0 = Math::dot(normal, in[0]) - offset;
+        float distance1 = Math::dot(normal, in[1]) - offset;
+
+        if (distance0 <= 0.0f)
+            out[count++] = in[0];
+        if (distance1 <= 0.0f)
+            out[count++] = in[1];
+        if (distance0 * distance1 < 0.0f)
+            out[count++] = in[0] + (in[1] - in[0]) * (distance0 / (distance0 - distance1));
+        return count;
+    }
+}
+
+namespace Math
+{
+    bool makePolygon(const glm::vec2 *points, int count, Polygon &polygon)
+    {
+        if (count < 3 || count > MAX_POLYGON_VERTICES)
+            return false;
+
+        glm::vec2 sorted[MAX_POLYGON_VERTICES];
+        std::copy(points, points + count, sorted);
+        std::sort(sorted, sorted + count, [](const glm::vec2 &a, const glm::vec2 &b)
+                  { return a.x < b.x || (a.x == b.x && a.y < b.y); });
+
+        // Monotone chain: lower hull left to right, then upper hull right to left, both turning left
+        glm::vec2 hull[2 * MAX_POLYGON_VERTICES];
+        int size = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            while (size >= 2 && cross(hull[size - 2], hull[size - 1], sorted[i]) <= 0.0f)
+                --size;
+            hull[size++] = sorted[i];
+        }
+        for (int i = count - 2, lower = size + 1; i >= 0; --i)
+        {
+            while (size >= lower && cross(hull[size - 2], hull[size - 1], sorted[i]) <= 0.0f)
+                --size;
+            hull[size++] = sorted[i];
+        }
+        --size; // The last point closes the loop on the first
+
+        if (size < 3)
+            return false;
+
+        polygon.count = size;
+        for (int i = 0; i < size; ++i)
+        {
+            polygon.vertices[i] = hull[i];
+            polygon.normals[i] = edgeNormal(hull[i], hull[(i + 1) % size]);
+        }
+        return true;
+    }
+
+    Polygon makeBox(const glm::vec2 &halfSize)
+    {
+        Polygon box;
+        box.count = 4;
+        box.vertices[0] = {-halfSize.x, -halfSize.y};
+        box.vertices[1] = {halfSize.x, -halfSize.y};
+        box.vertices[2] = {halfSize.x, halfSize.y};
+        box.vertices[3] = {-halfSize.x, halfSize.y};
+        box.normals[0] = {0.0f, -1.0f};
+        box.normals[1] = {1.0f, 0.0f};
+        box.normals[2] = {0.0f, 1.0f};
+        box.normals[3] = {-1.0f, 0.0f};
+        return box;
+    }
+
+    void transformPolygon(const Polygon &local, const glm::vec2 &center, const Rotation &rotation, const glm::vec2 &scale,
+                          Polygon &world)
+    {
+        // A mirroring scale turns the winding clockwise: store the vertices backwards to keep it counter-clockwise
+        bool mirrored = scale.x * scale.y < 0.0f;
+        int count = local.count;
+        world.count = count;
+        for (int i = 0; i < count; ++i)
+        {
+            world.vertices[mirrored ? count - 1 - i : i] = center + rotate(rotation, local.vertices[i] * scale);
+        }
+
+        if (scale.x == scale.y)
+        {
+            // Uniform scale keeps every normal's direction, flipped if the scale is negative
+            float sign = scale.x < 0.0f ? -1.0f : 1.0f;
+            for (int i = 0; i < count; ++i)
+            {
+                world.normals[i] = rotate(rotation, local.normals[i]) * sign;
+            }
+            return;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            world.normals[i] = edgeNormal(world.vertices[i], world.vertices[(i + 1) % count]);
+        }
+    }
+
+    AABB polygonAABB(const Polygon &polygon)
+    {
+        AABB aabb{polygon.vertices[0], polygon.vertices[0]};
+        for (int i = 1; i < polygon.count; ++i)
+        {
+            aabb.min = glm::vec2(std::fmin(aabb.min.x, polygon.vertices[i].x), std::fmin(aabb.min.y, polygon.vertices[i].y));
+            aabb.max = glm::vec2(std::fmax(aabb.max.x, polygon.vertices[i].x), std::fmax(aabb.max.y, polygon.vertices[i].y));
+        }
+        return aabb;
+    }
+
+    bool checkPolygonOverlap(const Polygon &a, const Polygon &b)
+    {
+        int face;
+        return findMaxSeparation(a, b, face) <= 0.0f && findMaxSeparation(b, a, face) <= 0.0f;
+    }
+
+    CollisionResult collidePolygons(const Polygon &a, const Polygon &b)
+    {
+        CollisionResult result;
+
+        int faceA;
+        float separationA = findMaxSeparation(a, b, faceA);
+        if (separationA >= 0.0f)
+            return result;
+
+        int faceB;
+        float separationB = findMaxSeparation(b, a, faceB);
+        if (separationB >= 0.0f)
+            return result;
+
+        bool flip = separationB > separationA + REFERENCE_FACE_TOLERANCE;
+        const Polygon &reference = flip ? b : a;
+        const Polygon &incident = flip ? a : b;
+        int referenceFace = flip ? faceB : faceA;
+        glm::vec2 referenceNormal = reference.normals[referenceFace];
+
+        // Incident face: the one facing the reference face the most
+        int incidentFace = 0;
+        float minDot = FLT_MAX;
+        for (int i = 0; i < incident.count; ++i)
+        {
+            float d = dot(referenceNormal, incident.normals[i]);
+            if (d < minDot)
+            {
+                minDot = d;
+                incidentFace = i;
+            }
+        }
+
+        glm::vec2 v1 = reference.vertices[referenceFace];
+        glm::vec2 v2 = reference.vertices[(referenceFace + 1) % reference.count];
+        glm::vec2 tangent = (v2 - v1) / std::sqrt(dot(v2 - v1, v2 - v1));
+
+        // Clip the incident face to the side planes of the reference face
+        glm::vec2 incidentEdge[2] = {incident.vertices[incidentFace], incident.vertices[(incidentFace + 1) % incident.count]};
+        glm::vec2 clipped1[2];
+        glm::vec2 clipped2[2];
+        int count = clipSegment(incidentEdge, clipped1, -tangent, -dot(tangent, v1));
+        if (count == 2)
+            count = clipSegment(clipped1, clipped2, tangent, dot(tangent, v2));
+
+        result.isColliding = true;
+        result.normal = flip ? referenceNormal : -referenceNormal;
+        result.penetration = -(flip ? separationB : separationA);
+
+        if (count == 2)
+        {
+            for (const glm::vec2 &point : clipped2)
+            {
+                if (dot(referenceNormal, point - v1) <= 0.0f)
+                    result.points[result.pointCount++] = point;
+            }
+        }
+        return result;
+    }
+
+    CollisionResult collidePolygonCircle(const Polygon &polygon, const glm::vec2 &center, float radius)
+    {
+        CollisionResult result;
+
+        float separation = -FLT_MAX;
+        int face = 0;
+        for (int i = 0; i < polygon.count; ++i)
+        {
+            float s = dot(polygon.normals[i], center - polygon.vertices[i]);
+            if (s > radius)
+                return result;
+            if (s > separation)
+            {
+                separation = s;
+                face = i;
+            }
+        }
+
+        glm::vec2 v1 = polygon.vertices[face];
+        glm::vec2 v2 = polygon.vertices[(face + 1) % polygon.count];
+        const glm::vec2 &normal = polygon.normals[face];
+
+        // Outside the face: the closest feature may be one of its vertices
+        if (separation > 0.0f)
+        {
+            const glm::vec2 ends[2] = {v1, v2};
+            for (int end = 0; end < 2; ++end)
+            {
+                const glm::vec2 &vertex = ends[end];
+                const glm::vec2 &other = ends[1 - end];
+                if (dot(center - vertex, other - vertex) > 0.0f)
+                    continue;
+
+                glm::vec2 delta = center - vertex;
+                float distSquared = dot(delta, delta);
+                if (distSquared > radius * radius)
+                    return result;
+
+                float distance = std::sqrt(distSquared);
+                result.isColliding = true;
+                result.normal = distance > 0.0f ? delta / distance : normal;
+                result.penetration = radius - distance;
+                result.pointCount = 1;
+                result.points[0] = vertex;
+                return result;
+            }
+        }
+
+        result.isColliding = true;
+        result.normal = normal;
+        result.penetration = radius - separation;
+        result.pointCount = 1;
+        result.points[0] = center - normal * separation;
+        return result;
+    }
+
+    bool raycastPolygon(const glm::vec2 &origin, const glm::vec2 &delta, const Polygon &polygon, float maxFraction, float &fraction)
+    {
+        float lower = 0.0f;
+        float upper = maxFraction;
+
+        for (int i = 0; i < polygon.count; ++i)
+        {
+            // The segment is inside face i's half-plane where dot(normal, point - vertex) <= 0
+            float numerator = dot(polygon.normals[i], polygon.vertices[i] - origin);
+            float denominator = dot(polygon.normals[i], delta);
+
+            if (denominator == 0.0f)
+            {
+                if (numerator < 0.0f)
+                    return false; // Parallel to this face and outside it
+                continue;
+            }
+
+            float t = numerator / denominator;
+            if (denominator < 0.0f)
+                lower = std::max(lower, t); // Entering the half-plane
+            else
+                upper = std::min(upper, t); // Leaving it
+
+            if (upper < lower)
+                return false;
+        }
+
+        fraction = lower;
+        return true;
+    }
+
+    float distanceToPolygon(const glm::vec2 &point, const Polygon &polygon)
+    {
+        bool inside = true;
+        float minDistSquared = FLT_MAX;
+        for (int i = 0; i < polygon.count; ++i)
+        {
+            const glm::vec2 &a = polygon.vertices[i];
+            const glm::vec2 &b = polygon.vertices[(i + 1) % polygon.count];
+            if (dot(polygon.normals[i], point - a) > 0.0f)
+                inside = false;
+
+            glm::vec2 edge = b - a;
+            float t = clamp(dot(point - a, edge) / dot(edge, edge), 0.0f, 1.0f);
+            glm::vec2 offset = point - (a + edge * t);
+            minDistSquared = std::min(minDistSquared, dot(offset, offset));
+        }
+        return inside ? 0.0f : std::sqrt(minDistSquared);
+    }
+}
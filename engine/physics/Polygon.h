@@ -0,0 +1,93 @@
+#ifndef POLYGON_H
+#define POLYGON_H
+
+#pragma once
+
+#include <cmath>
+#include <glm/glm.hpp>
+#include "Math.h"
+
+/*
+ * Oriented boxes and convex polygons, tested with the separating axis theorem.
+ *
+ * A PolygonShape keeps its polygon in local space with the edge normals precomputed; each test
+ * places it in the world with transformPolygon(), which only rotates (and, for non-uniform
+ * scale, renormalizes) the cached normals.
+ */
+namespace Math
+{
+    constexpr int MAX_POLYGON_VERTICES = 8;
+
+    /** @brief Rotation stored as its cosine and sine. */
+    struct Rotation
+    {
+        float cosine{1.0f};
+        float sine{0.0f};
+    };
+
+    /** @brief Rotation by @p degrees, the unit of Transform::rotation; positive turns +x toward +y. */
+    inline Rotation makeRotation(float degrees)
+    {
+        if (degrees == 0.0f)
+            return Rotation{};
+
+        float radians = degrees * (3.14159265358979323846f / 180.0f);
+        return {std::cos(radians), std::sin(radians)};
+    }
+
+    inline glm::vec2 rotate(const Rotation &rotation, const glm::vec2 &v)
+    {
+        return {rotation.cosine * v.x - rotation.sine * v.y, rotation.sine * v.x + rotation.cosine * v.y};
+    }
+
+    /** @brief Convex polygon with counter-clockwise vertices (positive signed area). */
+    struct Polygon
+    {
+        glm::vec2 vertices[MAX_POLYGON_VERTICES]{};
+        glm::vec2 normals[MAX_POLYGON_VERTICES]{}; ///< normals[i]: outward unit normal of the edge vertices[i] -> vertices[i + 1]
+        int count{0};
+    };
+
+    /**
+     * @brief Convex hull of @p count points (at most MAX_POLYGON_VERTICES), with its edge normals.
+     * Collinear and duplicate points are dropped, so the points may come in any order.
+     * @return False, leaving @p polygon untouched, if the hull has fewer than three vertices
+     */
+    bool makePolygon(const glm::vec2 *points, int count, Polygon &polygon);
+
+    /** @brief Box of half-size @p halfSize centred on the origin. */
+    Polygon makeBox(const glm::vec2 &halfSize);
+
+    /** @brief @p local scaled by @p scale, rotated by @p rotation and moved to @p center. */
+    void transformPolygon(const Polygon &local, const glm::vec2 &center, const Rotation &rotation, const glm::vec2 &scale,
+                          Polygon &world);
+
+    AABB polygonAABB(const Polygon &polygon);
+
+    /** @brief Whether the polygons overlap or touch. */
+    bool checkPolygonOverlap(const Polygon &a, const Polygon &b);
+
+    /**
+     * @brief SAT test of two polygons; touching polygons do not collide.
+     *
+     * The axis of least penetration picks a reference face; the most anti-parallel face of the other
+     * polygon is clipped against it, giving up to two contact points (the incident polygon's vertices
+     * that lie below the reference face).
+     * @return Normal pushing @p a away from @p b
+     */
+    CollisionResult collidePolygons(const Polygon &a, const Polygon &b);
+
+    /**
+     * @brief SAT test of a polygon and a circle; touching counts as colliding, like resolveAABBCircleCollision.
+     * @return Normal pointing from the polygon toward the circle, and the closest point of the polygon
+     */
+    CollisionResult collidePolygonCircle(const Polygon &polygon, const glm::vec2 &center, float radius);
+
+    /** @brief Same contract as raycastAABB, against a polygon. */
+    bool raycastPolygon(const glm::vec2 &origin, const glm::vec2 &delta, const Polygon &polygon, float maxFraction, float &fraction);
+
+    /** @brief Distance from @p point to the polygon; 0 inside it. */
+    float distanceToPolygon(const glm::vec2 &point, const Polygon &polygon);
+}
+
+#endif
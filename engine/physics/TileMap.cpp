@@ -0,0 +1,52 @@
+#include "TileMap.h"
+
+namespace TileMap
+{
+    void build(ECS::TileMapCollider &map, int columns, int rows, const std::vector<uint8_t> &solid)
+    {
+        map.columns = std::max(columns, 0);
+        map.rows = std::max(rows, 0);
+        map.rects.clear();
+        map.tileRect.assign(static_cast<size_t>(map.columns) * map.rows, ECS::TileMapCollider::NO_RECT);
+
+        auto isOpen = [&](int column, int row)
+        {
+            size_t tile = static_cast<size_t>(row) * map.columns + column;
+            return tile < solid.size() && solid[tile] != 0 && map.tileRect[tile] == ECS::TileMapCollider::NO_RECT;
+        };
+
+        for (int row = 0; row < map.rows; ++row)
+        {
+            for (int column = 0; column < map.columns; ++column)
+            {
+                if (!isOpen(column, row))
+                    continue;
+
+                ECS::TileRect rect{column, row, 1, 1};
+                while (rect.x + rect.width < map.columns && isOpen(rect.x + rect.width, row))
+                    ++rect.width;
+
+                auto spanOpen = [&](int spanRow)
+                {
+                    for (int x = rect.x; x < rect.x + rect.width; ++x)
+                    {
+                        if (!isOpen(x, spanRow))
+                            return false;
+                    }
+                    return true;
+                };
+                while (rect.y + rect.height < map.rows && spanOpen(rect.y + rect.height))
+                    ++rect.height;
+
+                uint32_t index = static_cast<uint32_t>(map.rects.size());
+                map.rects.push_back(rect);
+                for (int y = rect.y; y < rect.y + rect.height; ++y)
+                {
+                    std::fill_n(map.tileRect.begin() + static_cast<size_t>(y) * map.columns + rect.x, rect.width, index);
+                }
+
+                column += rect.width - 1;
+            }
+        }
+    }
+}
@@ -0,0 +1,127 @@
+#include "AABBTreeBroadPhase.h"
+#include <algorithm>
+#include <utility>
+
+void AABBTreeBroadPhase::update(const std::vector<BroadPhaseProxy> &proxies)
+{
+    ++mStamp;
+    mMoved.clear();
+
+    std::vector<int32_t> live;
+    live.reserve(proxies.size());
+
+    // Insert new proxies and move existing ones; only escapes from the fat AABB touch the tree
+    for (const BroadPhaseProxy &proxy : proxies)
+    {
+        uint32_t index = getEntityIndex(proxy.entity);
+        if (index >= mEntityToProxy.size())
+        {
+            mEntityToProxy.resize(index + 1, NULL_PROXY);
+            mEntityDirtyStamp.resize(index + 1, 0);
+        }
+
+        // A proxy of a deleted entity whose index was reused is left for the removal pass below
+        int32_t proxyId = mEntityToProxy[index];
+        bool moved = false;
+        if (proxyId == NULL_PROXY || mTree.getEntity(proxyId) != proxy.entity)
+        {
+            proxyId = mTree.createProxy(proxy.aabb, proxy.entity);
+            mEntityToProxy[index] = proxyId;
+            moved = true;
+        }
+        else
+        {
+            moved = mTree.moveProxy(proxyId, proxy.aabb);
+        }
+
+        if (static_cast<size_t>(proxyId) >= mTightAABBs.size())
+        {
+            mTightAABBs.resize(proxyId + 1);
+            mProxySeenStamp.resize(proxyId + 1, 0);
+        }
+        mTightAABBs[proxyId] = proxy.aabb;
+        mProxySeenStamp[proxyId] = mStamp;
+        live.push_back(proxyId);
+
+        if (moved)
+        {
+            mMoved.push_back(proxyId);
+            mEntityDirtyStamp[index] = mStamp;
+        }
+    }
+
+    // Destroy proxies whose entity was not in this update
+    for (int32_t proxyId : mLiveProxies)
+    {
+        if (mProxySeenStamp[proxyId] == mStamp)
+            continue;
+
+        uint32_t index = getEntityIndex(mTree.getEntity(proxyId));
+        mEntityDirtyStamp[index] = mStamp;
+        if (mEntityToProxy[index] == proxyId)
+            mEntityToProxy[index] = NULL_PROXY;
+        mTree.destroyProxy(proxyId);
+    }
+    mLiveProxies = std::move(live);
+
+    // Forget every pair that involves a moved or removed proxy...
+    mFatPairs.erase(std::remove_if(mFatPairs.begin(), mFatPairs.end(), [&](const CollisionPair &pair)
+                                   { return isDirty(pair.entityA) || isDirty(pair.entityB); }),
+                    mFatPairs.end());
+
+    // ...and find them again by querying the tree with the moved proxies only
+    for (int32_t proxyId : mMoved)
+    {
+        EntityID entity = mTree.getEntity(proxyId);
+        mTree.query(mTree.getFatAABB(proxyId), [&](int32_t otherId)
+                    {
+            if (otherId == proxyId)
+                return true;
+
+            // A pair of two moved proxies is found from both sides; keep one
+            EntityID other = mTree.getEntity(otherId);
+            if (isDirty(other) && other < entity)
+                return true;
+
+            mFatPairs.push_back(makeCollisionPair(entity, other));
+            return true; });
+    }
+}
+
+void AABBTreeBroadPhase::findPairs(std::vector<CollisionPair> &pairs)
+{
+    // Fat overlap is only a hint; report the pairs whose current bounds actually touch
+    for (const CollisionPair &pair : mFatPairs)
+    {
+        if (Math::checkAABBOverlap(tightAABB(pair.entityA), tightAABB(pair.entityB)))
+        {
+            pairs.push_back(pair);
+        }
+    }
+}
+
+void AABBTreeBroadPhase::queryAABB(const Math::AABB &region, std::vector<EntityID> &entities) const
+{
+    mTree.query(region, [&](int32_t proxyId)
+                {
+        if (Math::checkAABBOverlap(mTightAABBs[proxyId], region))
+            entities.push_back(mTree.getEntity(proxyId));
+        return true; });
+}
+
+void AABBTreeBroadPhase::raycast(const glm::vec2 &origin, const glm::vec2 &delta, std::vector<EntityID> &entities) const
+{
+    std::vector<std::pair<float, EntityID>> hits;
+    mTree.raycast(origin, delta, 1.0f, [&](int32_t proxyId, float maxFraction)
+                  {
+        float fraction = 0.0f;
+        if (Math::raycastAABB(origin, delta, mTightAABBs[proxyId], maxFraction, fraction))
+            hits.emplace_back(fraction, mTree.getEntity(proxyId));
+        return maxFraction; });
+
+    std::sort(hits.begin(), hits.end());
+    for (const auto &hit : hits)
+    {
+        entities.push_back(hit.second);
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef AABBTREEBROADPHASE_H
+#define AABBTREEBROADPHASE_H
+
+#pragma once
+
+#include <cstdint>
+#include "IBroadPhase.h"
+#include "DynamicAABBTree.h"
+
+/**
+ * @class AABBTreeBroadPhase
+ * @brief Broad-phase backed by a DynamicAABBTree with fat leaves.
+ *
+ * Only proxies whose bounds left their fat AABB this tick are reinserted and
+ * re-queried; the overlapping pairs of everything else are kept from previous
+ * ticks. Static geometry is therefore inserted once and then costs nothing,
+ * which suits levels where walls make up most of the colliders.
+ */
+class AABBTreeBroadPhase : public IBroadPhase
+{
+public:
+    static constexpr float DEFAULT_FAT_MARGIN = 4.0f;
+
+    explicit AABBTreeBroadPhase(float fatMargin = DEFAULT_FAT_MARGIN) : mTree(fatMargin) {};
+    ~AABBTreeBroadPhase() override = default;
+
+    void update(const std::vector<BroadPhaseProxy> &proxies) override;
+    void findPairs(std::vector<CollisionPair> &pairs) override;
+    std::unique_ptr<IBroadPhase> createEmpty() const override { return std::make_unique<AABBTreeBroadPhase>(mTree.getFatMargin()); }
+
+    /** @brief Append every entity whose collider bounds overlap @p region. */
+    void queryAABB(const Math::AABB &region, std::vector<EntityID> &entities) const;
+
+    /**
+     * @brief Append every entity whose collider bounds are touched by the segment
+     * origin -> origin + delta, nearest first.
+     */
+    void raycast(const glm::vec2 &origin, const glm::vec2 &delta, std::vector<EntityID> &entities) const;
+
+    const DynamicAABBTree &getTree() const { return mTree; }
+
+    /** @brief Number of proxies inserted or reinserted by the last update(). */
+    size_t getLastMovedCount() const { return mMoved.size(); }
+
+private:
+    static constexpr int32_t NULL_PROXY = DynamicAABBTree::NULL_NODE;
+
+    const Math::AABB &tightAABB(EntityID entity) const { return mTightAABBs[mEntityToProxy[getEntityIndex(entity)]]; }
+    bool isDirty(EntityID entity) const { return mEntityDirtyStamp[getEntityIndex(entity)] == mStamp; }
+
+    DynamicAABBTree mTree;                      ///< Fat-AABB hierarchy over every proxy
+    uint32_t mStamp{0};                         ///< Incremented on every update()
+    std::vector<int32_t> mEntityToProxy;        ///< getEntityIndex(EntityID) -> tree proxy (or NULL_PROXY)
+    std::vector<uint32_t> mEntityDirtyStamp;    ///< getEntityIndex(EntityID) -> stamp of the last update() that moved or removed an entity there
+    std::vector<Math::AABB> mTightAABBs;        ///< Tree proxy -> tight bounds from the last update()
+    std::vector<uint32_t> mProxySeenStamp;      ///< Tree proxy -> stamp of the last update() that contained it
+    std::vector<int32_t> mLiveProxies;          ///< Proxies present after the last update()
+    std::vector<int32_t> mMoved;                ///< Proxies inserted or reinserted by the last update()
+    std::vector<CollisionPair> mFatPairs;       ///< Persistent pairs whose fat AABBs overlap
+};
+
+#endif
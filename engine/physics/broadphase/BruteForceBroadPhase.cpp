@@ -0,0 +1,40 @@
+#include "BruteForceBroadPhase.h"
+#include "../MathBatch.h"
+
+void BruteForceBroadPhase::update(const std::vector<BroadPhaseProxy> &proxies)
+{
+    mProxies = proxies;
+
+    mMinX.resize(mProxies.size());
+    mMinY.resize(mProxies.size());
+    mMaxX.resize(mProxies.size());
+    mMaxY.resize(mProxies.size());
+    for (size_t i = 0; i < mProxies.size(); ++i)
+    {
+        mMinX[i] = mProxies[i].aabb.min.x;
+        mMinY[i] = mProxies[i].aabb.min.y;
+        mMaxX[i] = mProxies[i].aabb.max.x;
+        mMaxY[i] = mProxies[i].aabb.max.y;
+    }
+    mOverlaps.resize(mProxies.size());
+}
+
+void BruteForceBroadPhase::findPairs(std::vector<CollisionPair> &pairs)
+{
+    for (size_t i = 0; i < mProxies.size(); ++i)
+    {
+        // Every later proxy in one batch call
+        size_t first = i + 1;
+        size_t count = mProxies.size() - first;
+        Math::AABBSoA rest{mMinX.data() + first, mMinY.data() + first, mMaxX.data() + first, mMaxY.data() + first};
+        Math::overlapAABBBatch(mProxies[i].aabb, rest, count, mOverlaps.data());
+
+        for (size_t j = 0; j < count; ++j)
+        {
+            if (mOverlaps[j])
+            {
+                pairs.push_back(makeCollisionPair(mProxies[i].entity, mProxies[first + j].entity));
+            }
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef BRUTEFORCEBROADPHASE_H
+#define BRUTEFORCEBROADPHASE_H
+
+#pragma once
+
+#include <cstdint>
+#include "IBroadPhase.h"
+
+/**
+ * @class BruteForceBroadPhase
+ * @brief Tests every proxy against every other one. O(n²), but has no setup cost,
+ * which makes it the cheapest option for scenes with only a handful of colliders.
+ *
+ * Bounds are kept as structure-of-arrays so each proxy is tested against the rest
+ * with Math::overlapAABBBatch, several candidates per instruction.
+ */
+class BruteForceBroadPhase : public IBroadPhase
+{
+public:
+    BruteForceBroadPhase() = default;
+    ~BruteForceBroadPhase() override = default;
+
+    void update(const std::vector<BroadPhaseProxy> &proxies) override;
+    void findPairs(std::vector<CollisionPair> &pairs) override;
+    std::unique_ptr<IBroadPhase> createEmpty() const override { return std::make_unique<BruteForceBroadPhase>(); }
+
+private:
+    std::vector<BroadPhaseProxy> mProxies; ///< Copy of the proxies passed to the last update()
+    std::vector<float> mMinX;              ///< mProxies[i].aabb.min.x, contiguous for batch tests
+    std::vector<float> mMinY;              ///< mProxies[i].aabb.min.y
+    std::vector<float> mMaxX;              ///< mProxies[i].aabb.max.x
+    std::vector<float> mMaxY;              ///< mProxies[i].aabb.max.y
+    std::vector<uint8_t> mOverlaps;        ///< Scratch output of the batch test
+};
+
+#endif
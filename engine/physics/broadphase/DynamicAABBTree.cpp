@@ -0,0 +1,293 @@
+#include "DynamicAABBTree.h"
+#include <algorithm>
+#include <cassert>
+
+Math::AABB DynamicAABBTree::fatten(const Math::AABB &aabb) const
+{
+    glm::vec2 margin{mFatMargin, mFatMargin};
+    return {aabb.min - margin, aabb.max + margin};
+}
+
+int32_t DynamicAABBTree::allocateNode()
+{
+    if (mFreeList == NULL_NODE)
+    {
+        mNodes.emplace_back();
+        return static_cast<int32_t>(mNodes.size() - 1);
+    }
+
+    int32_t node = mFreeList;
+    mFreeList = mNodes[node].parent;
+    mNodes[node] = Node{};
+    return node;
+}
+
+void DynamicAABBTree::freeNode(int32_t node)
+{
+    mNodes[node].parent = mFreeList;
+    mNodes[node].child1 = NULL_NODE;
+    mNodes[node].child2 = NULL_NODE;
+    mNodes[node].height = -1;
+    mFreeList = node;
+}
+
+void DynamicAABBTree::clear()
+{
+    mNodes.clear();
+    mRoot = NULL_NODE;
+    mFreeList = NULL_NODE;
+    mProxyCount = 0;
+}
+
+int32_t DynamicAABBTree::createProxy(const Math::AABB &aabb, EntityID entity)
+{
+    int32_t leaf = allocateNode();
+    mNodes[leaf].aabb = fatten(aabb);
+    mNodes[leaf].entity = entity;
+    mNodes[leaf].height = 0;
+
+    insertLeaf(leaf);
+    ++mProxyCount;
+    return leaf;
+}
+
+void DynamicAABBTree::destroyProxy(int32_t proxyId)
+{
+    assert(proxyId >= 0 && proxyId < static_cast<int32_t>(mNodes.size()) && mNodes[proxyId].isLeaf());
+
+    removeLeaf(proxyId);
+    freeNode(proxyId);
+    --mProxyCount;
+}
+
+bool DynamicAABBTree::moveProxy(int32_t proxyId, const Math::AABB &aabb)
+{
+    assert(proxyId >= 0 && proxyId < static_cast<int32_t>(mNodes.size()) && mNodes[proxyId].isLeaf());
+
+    // Still inside the fat box: nothing to do
+    if (Math::containsAABB(mNodes[proxyId].aabb, aabb))
+        return false;
+
+    removeLeaf(proxyId);
+    mNodes[proxyId].aabb = fatten(aabb);
+    insertLeaf(proxyId);
+    return true;
+}
+
+void DynamicAABBTree::insertLeaf(int32_t leaf)
+{
+    if (mRoot == NULL_NODE)
+    {
+        mRoot = leaf;
+        mNodes[leaf].parent = NULL_NODE;
+        return;
+    }
+
+    // Descend towards the sibling that minimises the perimeter growth of the tree
+    Math::AABB leafAABB = mNodes[leaf].aabb;
+    int32_t index = mRoot;
+    while (!mNodes[index].isLeaf())
+    {
+        int32_t child1 = mNodes[index].child1;
+        int32_t child2 = mNodes[index].child2;
+
+        float area = Math::perimeterAABB(mNodes[index].aabb);
+        float combinedArea = Math::perimeterAABB(Math::combineAABB(mNodes[index].aabb, leafAABB));
+
+        // Cost of making a new parent for this node and the new leaf
+        float cost = 2.0f * combinedArea;
+        // Minimum cost of pushing the leaf further down the tree
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](int32_t child)
+        {
+            float grown = Math::perimeterAABB(Math::combineAABB(leafAABB, mNodes[child].aabb));
+            if (mNodes[child].isLeaf())
+                return grown + inheritanceCost;
+            return (grown - Math::perimeterAABB(mNodes[child].aabb)) + inheritanceCost;
+        };
+
+        float cost1 = descendCost(child1);
+        float cost2 = descendCost(child2);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        index = (cost1 < cost2) ? child1 : child2;
+    }
+
+    int32_t sibling = index;
+
+    // Create a new parent joining the sibling and the leaf
+    int32_t oldParent = mNodes[sibling].parent;
+    int32_t newParent = allocateNode();
+    mNodes[newParent].parent = oldParent;
+    mNodes[newParent].aabb = Math::combineAABB(leafAABB, mNodes[sibling].aabb);
+    mNodes[newParent].height = mNodes[sibling].height + 1;
+    mNodes[newParent].child1 = sibling;
+    mNodes[newParent].child2 = leaf;
+    mNodes[sibling].parent = newParent;
+    mNodes[leaf].parent = newParent;
+
+    if (oldParent != NULL_NODE)
+    {
+        if (mNodes[oldParent].child1 == sibling)
+            mNodes[oldParent].child1 = newParent;
+        else
+            mNodes[oldParent].child2 = newParent;
+    }
+    else
+    {
+        mRoot = newParent;
+    }
+
+    // Walk back up, rebalancing and refitting the ancestors
+    index = mNodes[leaf].parent;
+    while (index != NULL_NODE)
+    {
+        index = balance(index);
+
+        int32_t child1 = mNodes[index].child1;
+        int32_t child2 = mNodes[index].child2;
+        mNodes[index].height = 1 + std::max(mNodes[child1].height, mNodes[child2].height);
+        mNodes[index].aabb = Math::combineAABB(mNodes[child1].aabb, mNodes[child2].aabb);
+
+        index = mNodes[index].parent;
+    }
+}
+
+void DynamicAABBTree::removeLeaf(int32_t leaf)
+{
+    if (leaf == mRoot)
+    {
+        mRoot = NULL_NODE;
+        return;
+    }
+
+    int32_t parent = mNodes[leaf].parent;
+    int32_t grandParent = mNodes[parent].parent;
+    int32_t sibling = (mNodes[parent].child1 == leaf) ? mNodes[parent].child2 : mNodes[parent].child1;
+
+    if (grandParent == NULL_NODE)
+    {
+        mRoot = sibling;
+        mNodes[sibling].parent = NULL_NODE;
+        freeNode(parent);
+        return;
+    }
+
+    // Replace the parent with the sibling and refit the ancestors
+    if (mNodes[grandParent].child1 == parent)
+        mNodes[grandParent].child1 = sibling;
+    else
+        mNodes[grandParent].child2 = sibling;
+    mNodes[sibling].parent = grandParent;
+    freeNode(parent);
+
+    int32_t index = grandParent;
+    while (index != NULL_NODE)
+    {
+        index = balance(index);
+
+        int32_t child1 = mNodes[index].child1;
+        int32_t child2 = mNodes[index].child2;
+        mNodes[index].aabb = Math::combineAABB(mNodes[child1].aabb, mNodes[child2].aabb);
+        mNodes[index].height = 1 + std::max(mNodes[child1].height, mNodes[child2].height);
+
+        index = mNodes[index].parent;
+    }
+}
+
+int32_t DynamicAABBTree::balance(int32_t iA)
+{
+    // Rotate the taller grandchild up when A's children differ in height by more than one.
+    // Returns the index of the node now sitting where A was.
+    Node &A = mNodes[iA];
+    if (A.isLeaf() || A.height < 2)
+        return iA;
+
+    int32_t iB = A.child1;
+    int32_t iC = A.child2;
+    int32_t heightDiff = mNodes[iC].height - mNodes[iB].height;
+
+    auto rotateUp = [&](int32_t iUp, int32_t iOther) -> int32_t
+    {
+        // iUp (a child of A) becomes the parent of A
+        Node &Up = mNodes[iUp];
+        int32_t iF = Up.child1;
+        int32_t iG = Up.child2;
+
+        Up.child1 = iA;
+        Up.parent = A.parent;
+        A.parent = iUp;
+
+        if (Up.parent != NULL_NODE)
+        {
+            if (mNodes[Up.parent].child1 == iA)
+                mNodes[Up.parent].child1 = iUp;
+            else
+                mNodes[Up.parent].child2 = iUp;
+        }
+        else
+        {
+            mRoot = iUp;
+        }
+
+        // Keep the taller of Up's children under Up, hand the other to A
+        int32_t iKeep = (mNodes[iF].height > mNodes[iG].height) ? iF : iG;
+        int32_t iGive = (iKeep == iF) ? iG : iF;
+
+        Up.child2 = iKeep;
+        if (A.child1 == iUp)
+            A.child1 = iGive;
+        else
+            A.child2 = iGive;
+        mNodes[iGive].parent = iA;
+
+        A.aabb = Math::combineAABB(mNodes[iOther].aabb, mNodes[iGive].aabb);
+        A.height = 1 + std::max(mNodes[iOther].height, mNodes[iGive].height);
+        Up.aabb = Math::combineAABB(A.aabb, mNodes[iKeep].aabb);
+        Up.height = 1 + std::max(A.height, mNodes[iKeep].height);
+
+        return iUp;
+    };
+
+    if (heightDiff > 1)
+        return rotateUp(iC, iB);
+    if (heightDiff < -1)
+        return rotateUp(iB, iC);
+
+    return iA;
+}
+
+bool DynamicAABBTree::validateNode(int32_t index) const
+{
+    const Node &node = mNodes[index];
+    if (node.isLeaf())
+        return node.height == 0 && node.child2 == NULL_NODE;
+
+    int32_t child1 = node.child1;
+    int32_t child2 = node.child2;
+    if (mNodes[child1].parent != index || mNodes[child2].parent != index)
+        return false;
+
+    int32_t height = 1 + std::max(mNodes[child1].height, mNodes[child2].height);
+    if (node.height != height)
+        return false;
+
+    if (!Math::containsAABB(node.aabb, mNodes[child1].aabb) || !Math::containsAABB(node.aabb, mNodes[child2].aabb))
+        return false;
+
+    return validateNode(child1) && validateNode(child2);
+}
+
+bool DynamicAABBTree::validate() const
+{
+    if (mRoot == NULL_NODE)
+        return mProxyCount == 0;
+
+    if (mNodes[mRoot].parent != NULL_NODE)
+        return false;
+
+    return validateNode(mRoot);
+}
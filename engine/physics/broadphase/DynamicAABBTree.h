@@ -0,0 +1,228 @@
+#ifndef DYNAMICAABBTREE_H
+#define DYNAMICAABBTREE_H
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "../../core/ecs/ComponentTypeID.h"
+#include "../Math.h"
+
+/**
+ * @class DynamicAABBTree
+ * @brief Balanced bounding-volume hierarchy over fattened AABBs.
+ *
+ * Leaves store an AABB enlarged by a margin. Moving a proxy only touches the tree
+ * when its tight bounds leave that fat box, so slow or resting bodies cost nothing
+ * and static geometry is inserted once. Nodes live in a flat array and refer to each
+ * other by index; freed nodes are recycled through a free list.
+ *
+ * Queries share a traversal stack, so a tree must not be queried from several
+ * threads at once.
+ */
+class DynamicAABBTree
+{
+public:
+    static constexpr int32_t NULL_NODE = -1;
+
+    explicit DynamicAABBTree(float fatMargin = 4.0f) : mFatMargin(fatMargin) {};
+    ~DynamicAABBTree() = default;
+
+    /** @brief Insert a leaf for @p entity and return its proxy ID. */
+    int32_t createProxy(const Math::AABB &aabb, EntityID entity);
+
+    /** @brief Remove a leaf previously returned by createProxy(). */
+    void destroyProxy(int32_t proxyId);
+
+    /**
+     * @brief Update a leaf with new tight bounds.
+     * @return True if the bounds escaped the fat AABB and the leaf was reinserted.
+     */
+    bool moveProxy(int32_t proxyId, const Math::AABB &aabb);
+
+    EntityID getEntity(int32_t proxyId) const { return mNodes[proxyId].entity; }
+    const Math::AABB &getFatAABB(int32_t proxyId) const { return mNodes[proxyId].aabb; }
+
+    /** @brief Remove every proxy. */
+    void clear();
+
+    /**
+     * @brief Call @p callback(proxyId) for every leaf whose fat AABB overlaps @p aabb.
+     * The callback returns false to stop the query early.
+     */
+    template <typename Callback>
+    void query(const Math::AABB &aabb, Callback &&callback) const;
+
+    /**
+     * @brief Walk the leaves touched by the segment origin + t * delta, t in [0, maxFraction].
+     *
+     * The callback is called as callback(proxyId, maxFraction) and returns the new
+     * max fraction: the same value to keep going, a smaller one to clip the ray
+     * (closest-hit queries), or 0 to stop.
+     */
+    template <typename Callback>
+    void raycast(const glm::vec2 &origin, const glm::vec2 &delta, float maxFraction, Callback &&callback) const;
+
+    /**
+     * @brief Walk the leaves whose fat AABB lies within @p maxDistance of @p point, nearer subtrees first.
+     *
+     * The callback is called as callback(proxyId, maxDistance) and returns the new max distance,
+     * as for raycast(), or a negative value to stop. A k-nearest search returns its current k-th
+     * distance once it has found k leaves.
+     */
+    template <typename Callback>
+    void nearest(const glm::vec2 &point, float maxDistance, Callback &&callback) const;
+
+    int32_t getRoot() const { return mRoot; }
+    int32_t getHeight() const { return mRoot == NULL_NODE ? 0 : mNodes[mRoot].height; }
+    size_t getProxyCount() const { return mProxyCount; }
+    float getFatMargin() const { return mFatMargin; }
+
+    /** @brief Check parent links, heights and bounds of the whole tree (for tests). */
+    bool validate() const;
+
+private:
+    struct Node
+    {
+        Math::AABB aabb;            ///< Fat AABB for leaves, union of children for branches
+        EntityID entity{0};         ///< Owning entity (leaves only)
+        int32_t parent{NULL_NODE};  ///< Parent node, or next free node while on the free list
+        int32_t child1{NULL_NODE};  ///< First child, NULL_NODE for leaves
+        int32_t child2{NULL_NODE};  ///< Second child, NULL_NODE for leaves
+        int32_t height{-1};         ///< 0 for leaves, -1 while on the free list
+
+        bool isLeaf() const { return child1 == NULL_NODE; }
+    };
+
+    int32_t allocateNode();
+    void freeNode(int32_t node);
+    void insertLeaf(int32_t leaf);
+    void removeLeaf(int32_t leaf);
+    int32_t balance(int32_t node);
+    bool validateNode(int32_t node) const;
+
+    Math::AABB fatten(const Math::AABB &aabb) const;
+
+    std::vector<Node> mNodes;          ///< Node storage (leaves, branches and free slots)
+    int32_t mRoot{NULL_NODE};          ///< Root node index
+    int32_t mFreeList{NULL_NODE};      ///< Head of the free node list
+    size_t mProxyCount{0};             ///< Number of live leaves
+    float mFatMargin;                  ///< Margin added on every side of a leaf's tight AABB
+    mutable std::vector<int32_t> mStack; ///< Traversal stack reused by query(), raycast() and nearest()
+};
+
+template <typename Callback>
+void DynamicAABBTree::query(const Math::AABB &aabb, Callback &&callback) const
+{
+    if (mRoot == NULL_NODE)
+        return;
+
+    std::vector<int32_t> &stack = mStack;
+    size_t base = stack.size(); // Allows nested queries from inside a callback
+    stack.push_back(mRoot);
+
+    while (stack.size() > base)
+    {
+        int32_t nodeId = stack.back();
+        stack.pop_back();
+
+        const Node &node = mNodes[nodeId];
+        if (!Math::checkAABBOverlap(node.aabb, aabb))
+            continue;
+
+        if (node.isLeaf())
+        {
+            if (!callback(nodeId))
+            {
+                stack.resize(base);
+                return;
+            }
+        }
+        else
+        {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+}
+
+template <typename Callback>
+void DynamicAABBTree::raycast(const glm::vec2 &origin, const glm::vec2 &delta, float maxFraction, Callback &&callback) const
+{
+    if (mRoot == NULL_NODE || maxFraction <= 0.0f)
+        return;
+
+    std::vector<int32_t> &stack = mStack;
+    size_t base = stack.size();
+    stack.push_back(mRoot);
+
+    while (stack.size() > base)
+    {
+        int32_t nodeId = stack.back();
+        stack.pop_back();
+
+        const Node &node = mNodes[nodeId];
+        float entry = 0.0f;
+        if (!Math::raycastAABB(origin, delta, node.aabb, maxFraction, entry))
+            continue;
+
+        if (node.isLeaf())
+        {
+            float value = callback(nodeId, maxFraction);
+            if (value <= 0.0f)
+            {
+                stack.resize(base);
+                return;
+            }
+            maxFraction = value < maxFraction ? value : maxFraction;
+        }
+        else
+        {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+}
+
+template <typename Callback>
+void DynamicAABBTree::nearest(const glm::vec2 &point, float maxDistance, Callback &&callback) const
+{
+    if (mRoot == NULL_NODE || maxDistance < 0.0f)
+        return;
+
+    std::vector<int32_t> &stack = mStack;
+    size_t base = stack.size();
+    stack.push_back(mRoot);
+
+    while (stack.size() > base)
+    {
+        int32_t nodeId = stack.back();
+        stack.pop_back();
+
+        // Checked when popped rather than pushed: the bound may have shrunk in between
+        const Node &node = mNodes[nodeId];
+        if (Math::distanceToAABB(point, node.aabb) > maxDistance)
+            continue;
+
+        if (node.isLeaf())
+        {
+            float value = callback(nodeId, maxDistance);
+            if (value < 0.0f)
+            {
+                stack.resize(base);
+                return;
+            }
+            maxDistance = value < maxDistance ? value : maxDistance;
+        }
+        else
+        {
+            // Push the farther child first so the nearer one is visited first and tightens the bound
+            bool firstNearer = Math::distanceToAABB(point, mNodes[node.child1].aabb) <=
+                               Math::distanceToAABB(point, mNodes[node.child2].aabb);
+            stack.push_back(firstNearer ? node.child2 : node.child1);
+            stack.push_back(firstNearer ? node.child1 : node.child2);
+        }
+    }
+}
+
+#endif
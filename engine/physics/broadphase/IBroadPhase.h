@@ -0,0 +1,74 @@
+#ifndef IBROADPHASE_H
+#define IBROADPHASE_H
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "../../core/ecs/ComponentTypeID.h"
+#include "../Math.h"
+
+/**
+ * @brief A collider as seen by the broad-phase: its owner and world-space bounds.
+ */
+struct BroadPhaseProxy
+{
+    EntityID entity; ///< Entity that owns the collider
+    Math::AABB aabb; ///< World-space bounds of the collider for this tick
+};
+
+/**
+ * @brief A candidate pair handed from the broad-phase to the narrow-phase.
+ */
+struct CollisionPair
+{
+    EntityID entityA; ///< Lower of the two entity IDs
+    EntityID entityB; ///< Higher of the two entity IDs
+};
+
+inline bool operator<(const CollisionPair &lhs, const CollisionPair &rhs)
+{
+    return lhs.entityA < rhs.entityA || (lhs.entityA == rhs.entityA && lhs.entityB < rhs.entityB);
+}
+
+inline bool operator==(const CollisionPair &lhs, const CollisionPair &rhs)
+{
+    return lhs.entityA == rhs.entityA && lhs.entityB == rhs.entityB;
+}
+
+/**
+ * @class IBroadPhase
+ * @brief Interface for the stage that culls collider pairs before narrow-phase testing.
+ *
+ * Each tick the PhysicsManager hands over the current set of proxies, then asks
+ * for every pair whose bounds overlap. Implementations only need to be
+ * conservative: false positives are rejected by the narrow-phase.
+ */
+class IBroadPhase
+{
+public:
+    virtual ~IBroadPhase() = default;
+
+    /** @brief Refresh the structure with this tick's proxies. */
+    virtual void update(const std::vector<BroadPhaseProxy> &proxies) = 0;
+
+    /**
+     * @brief Append every overlapping pair to @p pairs, each reported exactly once
+     * with entityA < entityB. The order of the appended pairs is unspecified.
+     */
+    virtual void findPairs(std::vector<CollisionPair> &pairs) = 0;
+
+    /**
+     * @brief A new, empty broad-phase of the same kind and configuration.
+     * The PhysicsManager uses it to give each collision layer its own structure.
+     */
+    virtual std::unique_ptr<IBroadPhase> createEmpty() const = 0;
+};
+
+/** @brief Build a CollisionPair with its entities in canonical (ascending) order. */
+inline CollisionPair makeCollisionPair(EntityID a, EntityID b)
+{
+    return (a < b) ? CollisionPair{a, b} : CollisionPair{b, a};
+}
+
+#endif
@@ -0,0 +1,123 @@
+#include "SpatialHashBroadPhase.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+SpatialHashBroadPhase::SpatialHashBroadPhase(float cellSize)
+{
+    setCellSize(cellSize);
+}
+
+void SpatialHashBroadPhase::setCellSize(float cellSize)
+{
+    // A zero, negative or NaN size would make toCell() convert inf or NaN to int, or swap min and max cells
+    if (!(cellSize > 0.0f) || std::isinf(cellSize))
+    {
+        throw std::invalid_argument("SpatialHashBroadPhase: cell size must be positive and finite");
+    }
+    mCellSize = cellSize;
+    mInverseCellSize = 1.0f / cellSize;
+}
+
+int32_t SpatialHashBroadPhase::toCell(float coordinate) const
+{
+    // Casting an out-of-range float to int is undefined, so clamp first; NaN bounds overlap nothing anyway
+    float cell = std::floor(coordinate * mInverseCellSize);
+    if (std::isnan(cell))
+        return 0;
+    constexpr float limit = static_cast<float>(CELL_LIMIT);
+    return static_cast<int32_t>(std::clamp(cell, -limit, limit));
+}
+
+uint64_t SpatialHashBroadPhase::makeKey(int32_t cellX, int32_t cellY)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+}
+
+void SpatialHashBroadPhase::update(const std::vector<BroadPhaseProxy> &proxies)
+{
+    mProxies = proxies;
+    mEntries.clear();
+    mOversized.clear();
+    mIsOversized.assign(mProxies.size(), 0);
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(mProxies.size()); ++i)
+    {
+        const Math::AABB &aabb = mProxies[i].aabb;
+        int32_t minX = toCell(aabb.min.x);
+        int32_t minY = toCell(aabb.min.y);
+        int32_t maxX = toCell(aabb.max.x);
+        int32_t maxY = toCell(aabb.max.y);
+
+        int64_t cellCount = (static_cast<int64_t>(maxX) - minX + 1) * (static_cast<int64_t>(maxY) - minY + 1);
+        if (cellCount > MAX_CELLS_PER_PROXY)
+        {
+            mOversized.push_back(i);
+            mIsOversized[i] = 1;
+            continue;
+        }
+
+        for (int32_t x = minX; x <= maxX; ++x)
+        {
+            for (int32_t y = minY; y <= maxY; ++y)
+            {
+                mEntries.push_back({makeKey(x, y), i});
+            }
+        }
+    }
+
+    // Group entries by cell; keeping proxies ascending inside a cell makes the output order stable
+    std::sort(mEntries.begin(), mEntries.end(), [](const CellEntry &a, const CellEntry &b)
+              { return a.key < b.key || (a.key == b.key && a.proxy < b.proxy); });
+}
+
+void SpatialHashBroadPhase::findPairs(std::vector<CollisionPair> &pairs)
+{
+    size_t runStart = 0;
+    while (runStart < mEntries.size())
+    {
+        uint64_t key = mEntries[runStart].key;
+        size_t runEnd = runStart + 1;
+        while (runEnd < mEntries.size() && mEntries[runEnd].key == key)
+        {
+            ++runEnd;
+        }
+
+        for (size_t i = runStart; i < runEnd; ++i)
+        {
+            const BroadPhaseProxy &a = mProxies[mEntries[i].proxy];
+            for (size_t j = i + 1; j < runEnd; ++j)
+            {
+                const BroadPhaseProxy &b = mProxies[mEntries[j].proxy];
+                if (!Math::checkAABBOverlap(a.aabb, b.aabb))
+                    continue;
+
+                // Two proxies can share several cells. Only report the pair from the cell that
+                // holds the min corner of their overlap region, so it is emitted exactly once.
+                int32_t ownerX = toCell(std::max(a.aabb.min.x, b.aabb.min.x));
+                int32_t ownerY = toCell(std::max(a.aabb.min.y, b.aabb.min.y));
+                if (makeKey(ownerX, ownerY) != key)
+                    continue;
+
+                pairs.push_back(makeCollisionPair(a.entity, b.entity));
+            }
+        }
+
+        runStart = runEnd;
+    }
+
+    // Oversized proxies are in no cell, so test each against every proxy. A pair of two
+    // oversized proxies is reported from the lower one only.
+    for (uint32_t o : mOversized)
+    {
+        const BroadPhaseProxy &a = mProxies[o];
+        for (uint32_t i = 0; i < static_cast<uint32_t>(mProxies.size()); ++i)
+        {
+            if (i == o || (mIsOversized[i] && i < o))
+                continue;
+            const BroadPhaseProxy &b = mProxies[i];
+            if (Math::checkAABBOverlap(a.aabb, b.aabb))
+                pairs.push_back(makeCollisionPair(a.entity, b.entity));
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef SPATIALHASHBROADPHASE_H
+#define SPATIALHASHBROADPHASE_H
+
+#pragma once
+
+#include <cstdint>
+#include "IBroadPhase.h"
+
+/**
+ * @class SpatialHashBroadPhase
+ * @brief Uniform-grid broad-phase. Every proxy is registered in each cell its AABB
+ * touches, and only proxies sharing a cell are tested against each other.
+ *
+ * The grid is stored as a flat list of (cell key, proxy) entries sorted by key,
+ * so cells are contiguous runs and no hash table has to be maintained. The cell
+ * size should be close to the size of a typical collider: much smaller and large
+ * colliders span many cells, much larger and each cell holds too many proxies.
+ *
+ * A proxy covering more than MAX_CELLS_PER_PROXY cells is not registered in the
+ * grid at all; it goes to an oversized list that is tested against every proxy.
+ * Cell coordinates are clamped to +-CELL_LIMIT, so huge, infinite or NaN bounds
+ * cannot overflow the grid.
+ */
+class SpatialHashBroadPhase : public IBroadPhase
+{
+public:
+    static constexpr float DEFAULT_CELL_SIZE = 64.0f;
+    static constexpr int64_t MAX_CELLS_PER_PROXY = 64; ///< Proxies covering more cells go to the oversized list
+    static constexpr int32_t CELL_LIMIT = 1 << 30;     ///< Cell coordinates are clamped to [-CELL_LIMIT, CELL_LIMIT]
+
+    /** @throws std::invalid_argument If @p cellSize is not positive and finite, see setCellSize(). */
+    explicit SpatialHashBroadPhase(float cellSize = DEFAULT_CELL_SIZE);
+    ~SpatialHashBroadPhase() override = default;
+
+    void update(const std::vector<BroadPhaseProxy> &proxies) override;
+    void findPairs(std::vector<CollisionPair> &pairs) override;
+    std::unique_ptr<IBroadPhase> createEmpty() const override { return std::make_unique<SpatialHashBroadPhase>(mCellSize); }
+
+    /**
+     * @brief Change the grid cell size. Takes effect on the next update().
+     * @throws std::invalid_argument If @p cellSize is zero, negative, NaN or infinite; the size is left unchanged.
+     */
+    void setCellSize(float cellSize);
+    float getCellSize() const { return mCellSize; }
+
+    /** @brief Number of (cell, proxy) registrations made by the last update(). */
+    size_t getCellEntryCount() const { return mEntries.size(); }
+
+    /** @brief Number of proxies the last update() kept out of the grid for covering too many cells. */
+    size_t getOversizedCount() const { return mOversized.size(); }
+
+private:
+    struct CellEntry
+    {
+        uint64_t key;   ///< Packed cell coordinates, see makeKey()
+        uint32_t proxy; ///< Index into mProxies
+    };
+
+    int32_t toCell(float coordinate) const;
+    static uint64_t makeKey(int32_t cellX, int32_t cellY);
+
+    float mCellSize;                       ///< Edge length of a grid cell in world units
+    float mInverseCellSize;                ///< 1 / mCellSize, cached for the hot path
+    std::vector<BroadPhaseProxy> mProxies; ///< Copy of the proxies passed to the last update()
+    std::vector<CellEntry> mEntries;       ///< (cell, proxy) registrations sorted by cell key
+    std::vector<uint32_t> mOversized;      ///< Proxies left out of the grid, ascending
+    std::vector<uint8_t> mIsOversized;     ///< Per proxy, 1 if it is in mOversized
+};
+
+#endif
@@ -0,0 +1,148 @@
+#include "SweepAndPruneBroadPhase.h"
+#include <algorithm>
+
+bool SweepAndPruneBroadPhase::endpointLess(const Endpoint &a, const Endpoint &b)
+{
+    // On ties, min endpoints sort before max endpoints so touching intervals still overlap
+    return a.value < b.value || (a.value == b.value && !a.isMax && b.isMax);
+}
+
+void SweepAndPruneBroadPhase::insertionSort(size_t count)
+{
+    mLastSwapCount = 0;
+    for (size_t i = 1; i < count; ++i)
+    {
+        Endpoint key = mEndpoints[i];
+        size_t j = i;
+        while (j > 0 && endpointLess(key, mEndpoints[j - 1]))
+        {
+            mEndpoints[j] = mEndpoints[j - 1];
+            --j;
+            ++mLastSwapCount;
+        }
+        mEndpoints[j] = key;
+    }
+}
+
+void SweepAndPruneBroadPhase::update(const std::vector<BroadPhaseProxy> &proxies)
+{
+    ++mStamp;
+    size_t firstNewBox = mBoxes.size();
+    std::vector<uint32_t> newBoxes;
+
+    // Refresh existing boxes and allocate boxes for entities seen for the first time
+    for (const BroadPhaseProxy &proxy : proxies)
+    {
+        uint32_t index = getEntityIndex(proxy.entity);
+        if (index >= mEntityToBox.size())
+        {
+            mEntityToBox.resize(index + 1, INVALID);
+        }
+
+        // An entity reusing a deleted entity's index takes over its box, as if it had moved there
+        uint32_t boxIndex = mEntityToBox[index];
+        if (boxIndex == INVALID)
+        {
+            if (!mFreeBoxes.empty())
+            {
+                boxIndex = mFreeBoxes.back();
+                mFreeBoxes.pop_back();
+            }
+            else
+            {
+                boxIndex = static_cast<uint32_t>(mBoxes.size());
+                mBoxes.emplace_back();
+            }
+            mEntityToBox[index] = boxIndex;
+            newBoxes.push_back(boxIndex);
+        }
+
+        Box &box = mBoxes[boxIndex];
+        box.entity = proxy.entity;
+        box.aabb = proxy.aabb;
+        box.lastSeen = mStamp;
+        box.alive = true;
+    }
+
+    // Release boxes whose entity was not in this update
+    for (uint32_t i = 0; i < static_cast<uint32_t>(firstNewBox); ++i)
+    {
+        Box &box = mBoxes[i];
+        if (box.alive && box.lastSeen != mStamp)
+        {
+            box.alive = false;
+            mEntityToBox[getEntityIndex(box.entity)] = INVALID;
+            mFreeBoxes.push_back(i);
+        }
+    }
+
+    // Drop endpoints of released boxes (keeps the survivors in order) and refresh the rest.
+    // Boxes allocated this tick have no endpoints yet, so they cannot be matched here.
+    size_t kept = 0;
+    for (const Endpoint &endpoint : mEndpoints)
+    {
+        const Box &box = mBoxes[endpoint.box];
+        if (!box.alive || box.lastSeen != mStamp)
+            continue;
+
+        Endpoint refreshed = endpoint;
+        refreshed.value = endpoint.isMax ? sweepMax(box.aabb) : sweepMin(box.aabb);
+        mEndpoints[kept++] = refreshed;
+    }
+    mEndpoints.resize(kept);
+
+    // Frame-to-frame coherence: the surviving endpoints are nearly sorted already
+    insertionSort(mEndpoints.size());
+
+    // New boxes arrive unordered; sort them on their own and merge instead of insertion-sorting them in
+    if (!newBoxes.empty())
+    {
+        size_t oldCount = mEndpoints.size();
+        for (uint32_t boxIndex : newBoxes)
+        {
+            const Box &box = mBoxes[boxIndex];
+            mEndpoints.push_back({sweepMin(box.aabb), boxIndex, false});
+            mEndpoints.push_back({sweepMax(box.aabb), boxIndex, true});
+        }
+        std::sort(mEndpoints.begin() + oldCount, mEndpoints.end(), endpointLess);
+        std::inplace_merge(mEndpoints.begin(), mEndpoints.begin() + oldCount, mEndpoints.end(), endpointLess);
+    }
+}
+
+void SweepAndPruneBroadPhase::findPairs(std::vector<CollisionPair> &pairs)
+{
+    mActive.clear();
+    if (mActiveSlot.size() < mBoxes.size())
+    {
+        mActiveSlot.resize(mBoxes.size(), INVALID);
+    }
+
+    for (const Endpoint &endpoint : mEndpoints)
+    {
+        if (endpoint.isMax)
+        {
+            // Close the interval: swap-remove the box from the active list
+            uint32_t slot = mActiveSlot[endpoint.box];
+            uint32_t last = mActive.back();
+            mActive[slot] = last;
+            mActiveSlot[last] = slot;
+            mActive.pop_back();
+            mActiveSlot[endpoint.box] = INVALID;
+            continue;
+        }
+
+        // Open the interval: every active box overlaps this one on the sweep axis
+        const Box &box = mBoxes[endpoint.box];
+        for (uint32_t other : mActive)
+        {
+            const Box &otherBox = mBoxes[other];
+            if (Math::checkAABBOverlap(box.aabb, otherBox.aabb))
+            {
+                pairs.push_back(makeCollisionPair(box.entity, otherBox.entity));
+            }
+        }
+
+        mActiveSlot[endpoint.box] = static_cast<uint32_t>(mActive.size());
+        mActive.push_back(endpoint.box);
+    }
+}
@@ -0,0 +1,74 @@
+#ifndef SWEEPANDPRUNEBROADPHASE_H
+#define SWEEPANDPRUNEBROADPHASE_H
+
+#pragma once
+
+#include <cstdint>
+#include "IBroadPhase.h"
+
+/**
+ * @class SweepAndPruneBroadPhase
+ * @brief Sort-and-sweep broad-phase over the min/max endpoints of every proxy on one axis.
+ *
+ * The endpoint list persists across ticks and is re-sorted with insertion sort.
+ * Bodies move little from one tick to the next, so the list is almost sorted
+ * already and the sort is close to O(n). Works best when the scene is spread out
+ * along the sweep axis, e.g. a side-scroller swept along X.
+ */
+class SweepAndPruneBroadPhase : public IBroadPhase
+{
+public:
+    enum class Axis
+    {
+        X,
+        Y
+    };
+
+    explicit SweepAndPruneBroadPhase(Axis axis = Axis::X) : mAxis(axis) {};
+    ~SweepAndPruneBroadPhase() override = default;
+
+    void update(const std::vector<BroadPhaseProxy> &proxies) override;
+    void findPairs(std::vector<CollisionPair> &pairs) override;
+    std::unique_ptr<IBroadPhase> createEmpty() const override { return std::make_unique<SweepAndPruneBroadPhase>(mAxis); }
+
+    Axis getAxis() const { return mAxis; }
+
+    /** @brief Number of endpoint swaps performed by the last update() (0 when nothing changed order). */
+    size_t getLastSwapCount() const { return mLastSwapCount; }
+
+private:
+    static constexpr uint32_t INVALID = UINT32_MAX;
+
+    struct Box
+    {
+        EntityID entity;
+        Math::AABB aabb;
+        uint32_t lastSeen; ///< Update stamp of the last update() that contained this entity
+        bool alive;        ///< False while the slot sits in mFreeBoxes
+    };
+
+    struct Endpoint
+    {
+        float value;  ///< Min or max of the box on the sweep axis
+        uint32_t box; ///< Index into mBoxes
+        bool isMax;   ///< False for a min endpoint, true for a max endpoint
+    };
+
+    float sweepMin(const Math::AABB &aabb) const { return mAxis == Axis::X ? aabb.min.x : aabb.min.y; }
+    float sweepMax(const Math::AABB &aabb) const { return mAxis == Axis::X ? aabb.max.x : aabb.max.y; }
+
+    static bool endpointLess(const Endpoint &a, const Endpoint &b);
+    void insertionSort(size_t count);
+
+    Axis mAxis;                          ///< Axis the endpoints are sorted along
+    uint32_t mStamp{0};                  ///< Incremented on every update()
+    size_t mLastSwapCount{0};            ///< Swaps made by the last insertion sort
+    std::vector<Box> mBoxes;             ///< Persistent per-entity boxes (holes are listed in mFreeBoxes)
+    std::vector<uint32_t> mFreeBoxes;    ///< Recycled indices into mBoxes
+    std::vector<uint32_t> mEntityToBox;  ///< getEntityIndex(EntityID) -> index into mBoxes (or INVALID)
+    std::vector<Endpoint> mEndpoints;    ///< Persistent endpoint list, kept sorted between ticks
+    std::vector<uint32_t> mActive;       ///< Scratch list of open boxes used during the sweep
+    std::vector<uint32_t> mActiveSlot;   ///< Box index -> position in mActive, for O(1) removal
+};
+
+#endif
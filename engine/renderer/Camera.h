@@ -19,6 +19,9 @@ public:
     float getZoom() const { return mZoom; };
     void setZoom(float zoom) { mZoom = zoom; };
 
+    int getViewportWidth() const { return mViewportWidth; };
+    int getViewportHeight() const { return mViewportHeight; };
+
     glm::vec2 worldToScreen(const glm::vec2 &worldPos) const;
     glm::vec2 screenToWorld(const glm::vec2 &screenPos) const;
 
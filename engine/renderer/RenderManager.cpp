@@ -7,7 +7,10 @@
 #include "../core/ecs/components/Sprite.h"
 #include "../core/ecs/components/Transform.h"
 #include "../core/ecs/components/Collider.h"
+#include "../core/ecs/components/TileMapCollider.h"
 #include "../core/ecs/ComponentTypeID.h"
+#include "../physics/CollisionDetector.h"
+#include "../physics/TileMap.h"
 
 RenderManager::RenderManager(Window *window, EntityManager *entityManager)
     : mEntityManager(entityManager),
@@ -16,6 +19,7 @@ RenderManager::RenderManager(Window *window, EntityManager *entityManager)
     mRenderer = std::make_unique<Renderer>(window);
     mAssetManager = std::make_unique<AssetManager>(mRenderer.get());
     mSpriteRenderer = std::make_unique<SpriteRenderer>(mRenderer.get(), mAssetManager.get());
+    mColliderShapes = std::make_unique<CollisionDetector>(entityManager);
 }
 
 RenderManager::~RenderManager()
@@ -34,10 +38,8 @@ void RenderManager::render()
 
 void RenderManager::renderSprites()
 {
-    for (EntityID entity : mEntityManager->view<ECS::Sprite, ECS::Transform>())
+    for (auto [entity, sprite, transform] : mEntityManager->view<const ECS::Sprite, const ECS::Transform>().each())
     {
-        const ECS::Sprite &sprite = mEntityManager->getComponent<ECS::Sprite>(entity);
-        const ECS::Transform &transform = mEntityManager->getComponent<ECS::Transform>(entity);
 
         const SDL_Rect *srcRect = nullptr;
         SDL_Rect frameRect;
@@ -68,25 +70,38 @@ void RenderManager::debugDrawColliders()
 {
     mRenderer->setDrawColor(0, 255, 0, 255); // Green outlines
 
-    for (EntityID entity : mEntityManager->view<ECS::Collider, ECS::Transform>())
-    {
-        const auto &collider = mEntityManager->getComponent<ECS::Collider>(entity);
-        const auto &transform = mEntityManager->getComponent<ECS::Transform>(entity);
+    // Every shape is placed from its current Transform, i.e. where the last physics update left it.
+    // The physics world-bounds cache predates the solver, so it is not used here.
+    float zoom = mCamera.getZoom();
 
-        glm::vec2 worldPos = transform.position + collider.offset;
-        glm::vec2 screenPos = mCamera.worldToScreen(worldPos);
-        float zoom = mCamera.getZoom();
+    for (auto [entity, collider, transform] : mEntityManager->view<const ECS::Collider, const ECS::Transform>().each())
+    {
+        // Polygons and rotated boxes are outlined edge by edge
+        Math::Polygon polygon;
+        if (mColliderShapes->getWorldPolygon(entity, collider, polygon))
+        {
+            for (int v = 0; v < polygon.count; ++v)
+            {
+                glm::vec2 from = mCamera.worldToScreen(polygon.vertices[v]);
+                glm::vec2 to = mCamera.worldToScreen(polygon.vertices[(v + 1) % polygon.count]);
+                mRenderer->drawLine(static_cast<int>(from.x), static_cast<int>(from.y), static_cast<int>(to.x), static_cast<int>(to.y));
+            }
+            continue;
+        }
 
         if (collider.type == ECS::ColliderType::Box)
         {
-            int w = static_cast<int>(collider.size.x * zoom);
-            int h = static_cast<int>(collider.size.y * zoom);
-            int x = static_cast<int>(screenPos.x) - w / 2;
-            int y = static_cast<int>(screenPos.y) - h / 2;
+            Math::AABB aabb = mColliderShapes->getColliderAABB(entity, collider);
+            glm::vec2 screenMin = mCamera.worldToScreen(aabb.min);
+            int w = static_cast<int>((aabb.max.x - aabb.min.x) * zoom);
+            int h = static_cast<int>((aabb.max.y - aabb.min.y) * zoom);
+            int x = static_cast<int>(screenMin.x);
+            int y = static_cast<int>(screenMin.y);
             mRenderer->drawRectOutline(x, y, w, h);
         }
         else if (collider.type == ECS::ColliderType::Circle)
         {
+            glm::vec2 screenPos = mCamera.worldToScreen(transform.position + collider.offset);
             int r = static_cast<int>(collider.radius * zoom);
             mRenderer->drawCircleOutline(
                 static_cast<int>(screenPos.x),
@@ -94,13 +109,30 @@ void RenderManager::debugDrawColliders()
                 r);
         }
     }
+
+    // Tile maps outline their merged rectangles, only those on screen
+    Math::AABB view{mCamera.screenToWorld({0.0f, 0.0f}),
+                    mCamera.screenToWorld({static_cast<float>(mCamera.getViewportWidth()), static_cast<float>(mCamera.getViewportHeight())})};
+    const auto &maps = mEntityManager->getComponentPool<ECS::TileMapCollider>();
+    for (size_t i = 0; i < maps.getDense().size(); ++i)
+    {
+        EntityID entity = maps.getDenseToEntity()[i];
+        if (!mEntityManager->hasComponent<ECS::Transform>(entity))
+            continue;
+
+        TileMap::forEachRect(maps.getDense()[i], mEntityManager->getComponent<ECS::Transform>(entity).position, view, [&](const Math::AABB &rect)
+                             {
+            glm::vec2 screenMin = mCamera.worldToScreen(rect.min);
+            int w = static_cast<int>((rect.max.x - rect.min.x) * zoom);
+            int h = static_cast<int>((rect.max.y - rect.min.y) * zoom);
+            mRenderer->drawRectOutline(static_cast<int>(screenMin.x), static_cast<int>(screenMin.y), w, h); });
+    }
 }
 
 void RenderManager::updateAnimations(float dt)
 {
-    for (EntityID entity : mEntityManager->view<ECS::Sprite>())
+    for (auto [entity, sprite] : mEntityManager->view<ECS::Sprite>().each())
     {
-        ECS::Sprite &sprite = mEntityManager->getComponent<ECS::Sprite>(entity);
 
         const SpriteSheetData *sheet = mAssetManager->getSpriteSheet(sprite.textureId);
         if (!sheet || sheet->frameCount <= 1 || !sprite.playing)
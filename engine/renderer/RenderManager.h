@@ -12,6 +12,7 @@ class Renderer;
 class SpriteRenderer;
 class AssetManager;
 class EntityManager;
+class CollisionDetector;
 
 class RenderManager
 {
@@ -39,6 +40,7 @@ private:
     std::unique_ptr<SpriteRenderer> mSpriteRenderer; ///< Unique pointer to the SpriteRenderer, responsible for drawing sprites using the Renderer and AssetManager.
     std::unique_ptr<AssetManager> mAssetManager;     ///< Unique pointer to the AssetManager, responsible for loading and managing textures.
     EntityManager *mEntityManager;                   ///< Pointer to the EntityManager, used to access entities and their components for rendering.
+    std::unique_ptr<CollisionDetector> mColliderShapes; ///< Places collider outlines from the current Transforms for debugDrawColliders().
     Camera mCamera;                                  ///< The Camera instance used for world-to-screen transformations during rendering.
     bool mDrawColliders{false};                       ///< Whether to draw debug collider outlines.
 };
@@ -66,6 +66,11 @@ public:
      */
     void drawRectOutline(int x, int y, int w, int h);
 
+    /**
+     * @brief Draw a line segment
+     */
+    void drawLine(int x1, int y1, int x2, int y2) { SDL_RenderDrawLine(mRenderer, x1, y1, x2, y2); }
+
     /**
      * @brief Draw a circle outline using line segments
      */
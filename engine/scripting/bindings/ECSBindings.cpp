@@ -1,10 +1,15 @@
 #include "ECSBindings.h"
+#include <pybind11/stl.h>
 #include "../EngineBindings.h"
 #include "../../core/ecs/EntityManager.h"
 #include "../../core/ecs/components/Transform.h"
 #include "../../core/ecs/components/RigidBody.h"
 #include "../../core/ecs/components/Collider.h"
+#include "../../core/ecs/components/PolygonShape.h"
 #include "../../core/ecs/components/Sprite.h"
+#include "../../core/ecs/components/TileMapCollider.h"
+#include "../../physics/PhysicsManager.h"
+#include "../../physics/TileMap.h"
 #include "../../renderer/AssetManager.h"
 
 void registerECSBindings(py::module_ &m)
@@ -12,6 +17,12 @@ void registerECSBindings(py::module_ &m)
     m.def("create_entity", []()
           { return EngineBindings::getEntityManager()->createEntity(); }, "Create a new entity and return its unique ID.");
 
+    m.def("delete_entity", [](EntityID entity)
+          { return EngineBindings::getEntityManager()->deleteEntity(entity); }, py::arg("entity"), "Remove every component of an entity and retire its ID. Returns False if the entity was already deleted. The ID's slot is reused by later entities under a new generation, so the old ID stays dead.");
+
+    m.def("is_alive", [](EntityID entity)
+          { return EngineBindings::getEntityManager()->isAlive(entity); }, py::arg("entity"), "Return whether an entity ID still refers to a live entity, i.e. it was created and not deleted since.");
+
     m.def("add_transform", [](EntityID entity, float x, float y)
           {
         ECS::Transform t{};
@@ -25,21 +36,98 @@ void registerECSBindings(py::module_ &m)
         rb.mass = mass;
         EngineBindings::getEntityManager()->addComponent(entity, rb); }, "Add a RigidBody component to an entity.");
 
-    m.def("add_collider_box", [](EntityID entity, float width, float height, float offsetX, float offsetY)
+    m.def("set_body_type", [](EntityID entity, const std::string &body_type)
+          {
+        EntityManager *em = EngineBindings::getEntityManager();
+        if (!em->hasComponent<ECS::RigidBody>(entity))
+            throw std::runtime_error("set_body_type() needs an entity with a RigidBody. Add one first with add_rigidbody().");
+        auto &rb = em->getComponent<ECS::RigidBody>(entity);
+        if (body_type == "static")
+            rb.type = ECS::BodyType::Static;
+        else if (body_type == "kinematic")
+            rb.type = ECS::BodyType::Kinematic;
+        else if (body_type == "dynamic")
+            rb.type = ECS::BodyType::Dynamic;
+        else
+            throw std::runtime_error("Unknown body type: '" + body_type + "'. Expected 'static', 'kinematic' or 'dynamic'.");
+        if (auto *pm = EngineBindings::getPhysicsManager())
+            pm->markStaticDirty(entity); }, py::arg("entity"), py::arg("body_type"), "Set how an entity's RigidBody is simulated: 'static' (never moves), 'kinematic' (moves by its velocity, never pushed) or 'dynamic' (default).");
+
+    m.def("set_continuous", [](EntityID entity, bool enabled)
+          {
+        EntityManager *em = EngineBindings::getEntityManager();
+        if (!em->hasComponent<ECS::RigidBody>(entity))
+            throw std::runtime_error("set_continuous() needs an entity with a RigidBody. Add one first with add_rigidbody().");
+        em->getComponent<ECS::RigidBody>(entity).continuous = enabled; }, py::arg("entity"), py::arg("enabled") = true, "Enable continuous collision detection for a fast dynamic RigidBody: it is swept along its velocity each tick so it cannot pass through static or sleeping colliders.");
+
+    m.def("add_collider_box", [](EntityID entity, float width, float height, float offsetX, float offsetY, uint32_t category, uint32_t mask, bool is_trigger)
           {
     ECS::Collider collider{};
     collider.type = ECS::ColliderType::Box;
     collider.offset = {offsetX, offsetY};
     collider.size = {width, height};
-    EngineBindings::getEntityManager()->addComponent(entity, collider); }, "Add a box Collider component to an entity.", py::arg("entity"), py::arg("width"), py::arg("height"), py::arg("offsetX") = 0.0f, py::arg("offsetY") = 0.0f);
+    collider.category = category;
+    collider.mask = mask;
+    collider.isTrigger = is_trigger;
+    EngineBindings::getEntityManager()->addComponent(entity, collider); }, "Add a box Collider component to an entity. Two colliders only collide if each one's category bits are set in the other's mask. Trigger colliders report overlaps through drain_trigger_events() instead of blocking.", py::arg("entity"), py::arg("width"), py::arg("height"), py::arg("offsetX") = 0.0f, py::arg("offsetY") = 0.0f, py::arg("category") = 1, py::arg("mask") = 0xFFFFFFFF, py::arg("is_trigger") = false);
 
-    m.def("add_collider_circle", [](EntityID entity, float radius, float offsetX, float offsetY)
+    m.def("add_collider_circle", [](EntityID entity, float radius, float offsetX, float offsetY, uint32_t category, uint32_t mask, bool is_trigger)
           {
     ECS::Collider collider{};
     collider.type = ECS::ColliderType::Circle;
     collider.offset = {offsetX, offsetY};
     collider.radius = radius;
-    EngineBindings::getEntityManager()->addComponent(entity, collider); }, "Add a circle Collider component to an entity.", py::arg("entity"), py::arg("radius"), py::arg("offsetX") = 0.0f, py::arg("offsetY") = 0.0f);
+    collider.category = category;
+    collider.mask = mask;
+    collider.isTrigger = is_trigger;
+    EngineBindings::getEntityManager()->addComponent(entity, collider); }, "Add a circle Collider component to an entity. Two colliders only collide if each one's category bits are set in the other's mask. Trigger colliders report overlaps through drain_trigger_events() instead of blocking.", py::arg("entity"), py::arg("radius"), py::arg("offsetX") = 0.0f, py::arg("offsetY") = 0.0f, py::arg("category") = 1, py::arg("mask") = 0xFFFFFFFF, py::arg("is_trigger") = false);
+
+    m.def("add_collider_polygon", [](EntityID entity, const py::list &points, float offsetX, float offsetY, uint32_t category, uint32_t mask, bool is_trigger)
+          {
+    if (points.size() > static_cast<size_t>(Math::MAX_POLYGON_VERTICES))
+        throw std::runtime_error("A polygon collider takes at most " + std::to_string(Math::MAX_POLYGON_VERTICES) + " points.");
+
+    glm::vec2 vertices[Math::MAX_POLYGON_VERTICES];
+    int count = 0;
+    for (const py::handle point : points)
+    {
+        auto xy = point.cast<std::pair<float, float>>();
+        vertices[count++] = {xy.first, xy.second};
+    }
+
+    ECS::PolygonShape shape;
+    if (!Math::makePolygon(vertices, count, shape.polygon))
+        throw std::runtime_error("A polygon collider needs at least 3 points that are not all on one line.");
+
+    ECS::Collider collider{};
+    collider.type = ECS::ColliderType::Polygon;
+    collider.offset = {offsetX, offsetY};
+    collider.category = category;
+    collider.mask = mask;
+    collider.isTrigger = is_trigger;
+    EntityManager *em = EngineBindings::getEntityManager();
+    em->addComponent(entity, shape);
+    em->addComponent(entity, collider); }, py::arg("entity"), py::arg("points"), py::arg("offsetX") = 0.0f, py::arg("offsetY") = 0.0f, py::arg("category") = 1, py::arg("mask") = 0xFFFFFFFF, py::arg("is_trigger") = false, "Add a convex polygon Collider component to an entity, from up to 8 (x, y) points around its position in any order; their convex hull is used. The polygon turns with the Transform's rotation. Two colliders only collide if each one's category bits are set in the other's mask. Trigger colliders report overlaps through drain_trigger_events() instead of blocking.");
+
+    m.def("add_tilemap_collider", [](EntityID entity, const std::vector<std::string> &tiles, float tile_size, uint32_t category, uint32_t mask)
+          {
+    int columns = tiles.empty() ? 0 : static_cast<int>(tiles[0].size());
+    std::vector<uint8_t> solid;
+    solid.reserve(tiles.size() * columns);
+    for (const std::string &row : tiles)
+    {
+        if (static_cast<int>(row.size()) != columns)
+            throw std::runtime_error("Every tile map row must have the same length.");
+        for (char tile : row)
+            solid.push_back(tile != ' ' && tile != '.');
+    }
+
+    ECS::TileMapCollider map{};
+    map.tileSize = tile_size;
+    map.category = category;
+    map.mask = mask;
+    TileMap::build(map, columns, static_cast<int>(tiles.size()), solid);
+    EngineBindings::getEntityManager()->addComponent(entity, map); }, py::arg("entity"), py::arg("tiles"), py::arg("tile_size"), py::arg("category") = 1, py::arg("mask") = 0xFFFFFFFF, "Add a static TileMapCollider to an entity from rows of tiles, first row at the entity's position and each next one tile_size further down. '.' and ' ' are empty, any other character is solid. Solid tiles are merged into rectangles once, here, and bodies only test the tiles under them, so the cost does not grow with the map.");
 
     m.def("get_position", [](EntityID entity) -> py::tuple
           {
@@ -49,7 +137,22 @@ void registerECSBindings(py::module_ &m)
     m.def("set_position", [](EntityID entity, float x, float y)
           {
         auto &t = EngineBindings::getEntityManager()->getComponent<ECS::Transform>(entity);
-        t.position = {x, y}; }, "Set the position of an entity's Transform component.");
+        t.position = {x, y};
+        if (auto *pm = EngineBindings::getPhysicsManager())
+        {
+            pm->wakeBody(entity);
+            pm->markStaticDirty(entity);
+        } }, "Set the position of an entity's Transform component.");
+
+    m.def("set_rotation", [](EntityID entity, float degrees)
+          {
+        auto &t = EngineBindings::getEntityManager()->getComponent<ECS::Transform>(entity);
+        t.rotation = degrees;
+        if (auto *pm = EngineBindings::getPhysicsManager())
+        {
+            pm->wakeBody(entity);
+            pm->markStaticDirty(entity);
+        } }, py::arg("entity"), py::arg("degrees"), "Set the rotation of an entity's Transform component, in degrees. Box colliders turn with it and are then tested as oriented boxes; circle colliders are unaffected.");
 
     m.def("get_velocity", [](EntityID entity) -> py::tuple
           {
@@ -59,7 +162,29 @@ void registerECSBindings(py::module_ &m)
     m.def("set_velocity", [](EntityID entity, float vx, float vy)
           {
         auto &rb = EngineBindings::getEntityManager()->getComponent<ECS::RigidBody>(entity);
-        rb.velocity = {vx, vy}; }, "Set the velocity of an entity's RigidBody component.");
+        rb.velocity = {vx, vy};
+        if (auto *pm = EngineBindings::getPhysicsManager())
+            pm->wakeBody(entity); }, "Set the velocity of an entity's RigidBody component.");
+
+    m.def("apply_force", [](EntityID entity, float fx, float fy)
+          {
+        auto &rb = EngineBindings::getEntityManager()->getComponent<ECS::RigidBody>(entity);
+        rb.force += glm::vec2(fx, fy);
+        if (auto *pm = EngineBindings::getPhysicsManager())
+            pm->wakeBody(entity); }, py::arg("entity"), py::arg("fx"), py::arg("fy"), "Add a force to an entity's dynamic RigidBody for the next physics_update(). Forces accumulate until that update applies them, then reset to zero.");
+
+    m.def("set_damping", [](EntityID entity, float linear_damping, float gravity_scale)
+          {
+        auto &rb = EngineBindings::getEntityManager()->getComponent<ECS::RigidBody>(entity);
+        rb.linearDamping = linear_damping;
+        rb.gravityScale = gravity_scale; }, py::arg("entity"), py::arg("linear_damping") = 0.0f, py::arg("gravity_scale") = 1.0f, "Set how an entity's dynamic RigidBody responds to the world: its velocity is divided by (1 + dt * linear_damping) every tick, and gravity is multiplied by gravity_scale.");
+
+    m.def("is_awake", [](EntityID entity) -> bool
+          {
+        EntityManager *em = EngineBindings::getEntityManager();
+        if (!em->hasComponent<ECS::RigidBody>(entity))
+            throw std::runtime_error("is_awake() needs an entity with a RigidBody. Add one first with add_rigidbody().");
+        return em->getComponent<ECS::RigidBody>(entity).awake; }, py::arg("entity"), "Return False while the physics step has put the entity's RigidBody to sleep.");
 
     m.def("add_sprite", [](EntityID entity, const std::string &textureId, int width, int height)
           {
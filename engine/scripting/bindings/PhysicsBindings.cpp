@@ -1,9 +1,178 @@
 #include "PhysicsBindings.h"
 #include "../EngineBindings.h"
 #include "../../physics/PhysicsManager.h"
+#include "../../physics/ContactSolver.h"
+#include "../../physics/broadphase/AABBTreeBroadPhase.h"
+#include "../../physics/broadphase/BruteForceBroadPhase.h"
+#include "../../physics/broadphase/SpatialHashBroadPhase.h"
+#include "../../physics/broadphase/SweepAndPruneBroadPhase.h"
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+
+namespace
+{
+    /** @brief Query results, reused between calls since scripts run on one thread. */
+    std::vector<EntityID> &queryScratch()
+    {
+        static std::vector<EntityID> entities;
+        entities.clear();
+        return entities;
+    }
+
+    /** @brief One tick's ContactRecords, kept alive by the Python object for as long as views of it exist. */
+    struct ContactBuffer
+    {
+        std::shared_ptr<const std::vector<ContactRecord>> records;
+    };
+
+    // PEP 3118 struct format, so numpy.asarray() gives named fields without a copy
+    constexpr const char *CONTACT_FORMAT = "T{Q:entity_a:Q:entity_b:f:normal_x:f:normal_y:f:penetration:4x}";
+    static_assert(sizeof(ContactRecord) == 32 && offsetof(ContactRecord, penetration) == 24, "CONTACT_FORMAT must match ContactRecord's layout");
+
+    py::list toList(const std::vector<EntityID> &entities)
+    {
+        py::list list(entities.size());
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            list[i] = py::int_(entities[i]);
+        }
+        return list;
+    }
+}
 
 void registerPhysicsBindings(py::module_ &m)
 {
+    m.attr("TRIGGER_ENTER") = py::int_(static_cast<int>(TriggerEventType::Enter));
+    m.attr("TRIGGER_STAY") = py::int_(static_cast<int>(TriggerEventType::Stay));
+    m.attr("TRIGGER_EXIT") = py::int_(static_cast<int>(TriggerEventType::Exit));
+
     m.def("physics_update", [](float dt)
           { EngineBindings::getPhysicsManager()->update(dt); }, "Update the physics simulation by a given time step (dt). This will move all physics-enabled entities according to their velocities and handle collisions.");
-}
\ No newline at end of file
+
+    m.def("set_broad_phase", [](const std::string &name, float cell_size, const std::string &axis, float margin)
+          {
+        auto *pm = EngineBindings::getPhysicsManager();
+        if (name == "spatial_hash")
+        {
+            if (!(cell_size > 0.0f) || std::isinf(cell_size))
+                throw std::runtime_error("Spatial hash cell_size must be positive and finite.");
+            pm->setBroadPhase(std::make_unique<SpatialHashBroadPhase>(cell_size));
+        }
+        else if (name == "sweep_and_prune")
+        {
+            if (axis != "x" && axis != "y")
+                throw std::runtime_error("Unknown sweep axis: '" + axis + "'. Expected 'x' or 'y'.");
+            auto sweepAxis = (axis == "y") ? SweepAndPruneBroadPhase::Axis::Y : SweepAndPruneBroadPhase::Axis::X;
+            pm->setBroadPhase(std::make_unique<SweepAndPruneBroadPhase>(sweepAxis));
+        }
+        else if (name == "aabb_tree")
+        {
+            if (!(margin >= 0.0f) || std::isinf(margin))
+                throw std::runtime_error("AABB tree margin must be 0 or positive and finite.");
+            pm->setBroadPhase(std::make_unique<AABBTreeBroadPhase>(margin));
+        }
+        else if (name == "brute_force")
+            pm->setBroadPhase(std::make_unique<BruteForceBroadPhase>());
+        else
+            throw std::runtime_error("Unknown broad-phase: '" + name + "'. Expected 'spatial_hash', 'sweep_and_prune', 'aabb_tree' or 'brute_force'."); }, py::arg("name"), py::arg("cell_size") = 64.0f, py::arg("axis") = "x", py::arg("margin") = 4.0f, "Select the broad-phase for this scene: 'spatial_hash' (uniform grid, cell_size in world units), 'sweep_and_prune' (sorted along axis 'x' or 'y'), 'aabb_tree' (dynamic BVH, leaves fattened by margin world units) or 'brute_force'.");
+
+    m.def("set_sleep", [](bool enabled, float velocity_threshold, float time_to_sleep)
+          { EngineBindings::getPhysicsManager()->setSleepParameters(enabled, velocity_threshold, time_to_sleep); }, py::arg("enabled"), py::arg("velocity_threshold") = 1.0f, py::arg("time_to_sleep") = 0.5f, "Configure automatic sleeping: bodies in contact fall asleep together once all of them have moved slower than velocity_threshold for time_to_sleep seconds. Disabling sleep wakes every body.");
+
+    m.def("set_physics_threads", [](int count)
+          {
+        if (count < 0)
+            throw std::runtime_error("Physics thread count must be 0 (every hardware thread) or positive.");
+        EngineBindings::getPhysicsManager()->setThreadCount(static_cast<size_t>(count)); }, py::arg("count") = 0, "Split the collision narrow-phase across count threads, including the main thread. 0 uses every hardware thread, 1 keeps physics single-threaded. Results are identical either way.");
+
+    m.def("set_physics_substeps", [](int substeps)
+          { EngineBindings::getPhysicsManager()->setSubsteps(substeps); }, py::arg("substeps") = 1, "Split every physics_update(dt) into substeps steps of dt / substeps, for stiffer contacts and smaller tunnelling distances. Values below 1 are raised to 1.");
+
+    m.def("set_gravity", [](float x, float y)
+          { EngineBindings::getPhysicsManager()->setGravity({x, y}); }, py::arg("x"), py::arg("y"), "Set the acceleration applied to every dynamic body each tick, in world units per second squared, scaled by the body's gravity scale. Defaults to (0, 0).");
+
+    m.def("physics_checksum", []()
+          { return EngineBindings::getPhysicsManager()->getStateChecksum(); }, "Return a 64-bit hash of every rigid body's position, velocity and sleep state. Physics is deterministic, so lockstep peers or a replay that fed the same updates get the same value on every machine; compare it each tick to detect a desync.");
+
+    m.def("physics_stats", []()
+          {
+        py::dict stats;
+        PhysicsTrace::forEachField(EngineBindings::getPhysicsManager()->getStats(), [&](const char *name, const auto &value)
+                                   { stats[name] = value; });
+        return stats; }, "Return the counters of the last physics_update() as a dict: tick, dt, substeps, collider counts (moving_colliders, static_colliders, sleeping_colliders), broad_phase_pairs, narrow_phase_tests, contacts, trigger_overlaps, solver iterations, and wall-clock milliseconds per stage (integrate_ms, broad_phase_ms, continuous_ms, narrow_phase_ms, solver_ms, sleep_ms, total_ms). Collider counts are from the last substep; everything else is summed over substeps.");
+
+    m.def("physics_trace", [](bool enabled)
+          { EngineBindings::getPhysicsManager()->setTraceEnabled(enabled); }, py::arg("enabled") = true, "Start or stop recording physics_stats() after every physics_update(). Starting a stopped trace discards the previous one.");
+
+    m.def("save_physics_trace", [](const std::string &path)
+          {
+        std::ofstream file(path);
+        if (!file)
+            throw std::runtime_error("Could not open physics trace file: '" + path + "'.");
+        const auto &trace = EngineBindings::getPhysicsManager()->getTrace();
+        bool json = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+        if (json)
+            PhysicsTrace::writeJSON(file, trace);
+        else
+            PhysicsTrace::writeCSV(file, trace);
+        EngineBindings::getPhysicsManager()->clearTrace(); }, py::arg("path"), "Write the recorded trace to path, one entry per physics_update(), and clear it. A path ending in .json gets a JSON array of objects; anything else gets CSV with a header row. Field names match physics_stats().");
+
+    m.def("set_solver", [](int velocity_iterations, int position_iterations, bool warm_starting)
+          {
+        auto &solver = EngineBindings::getPhysicsManager()->getContactSolver();
+        solver.setIterations(velocity_iterations, position_iterations);
+        solver.setWarmStarting(warm_starting); }, py::arg("velocity_iterations") = 8, py::arg("position_iterations") = 4, py::arg("warm_starting") = true, "Configure the contact solver: velocity_iterations and position_iterations passes over every contact per tick, and whether persistent contacts start from last tick's impulse (warm_starting).");
+
+    py::class_<ContactBuffer>(m, "ContactBuffer", py::buffer_protocol(), "Contact records of one physics_update(), as returned inside get_contacts().")
+        .def_buffer([](const ContactBuffer &buffer)
+                    {
+        // A buffer cannot point at null, even with no items
+        static const ContactRecord NO_RECORD{};
+        const std::vector<ContactRecord> &records = *buffer.records;
+        const ContactRecord *data = records.empty() ? &NO_RECORD : records.data();
+        return py::buffer_info(const_cast<ContactRecord *>(data), sizeof(ContactRecord), CONTACT_FORMAT, 1,
+                               {static_cast<py::ssize_t>(records.size())},
+                               {static_cast<py::ssize_t>(sizeof(ContactRecord))}, true); });
+
+    m.def("drain_trigger_events", []()
+          {
+        py::list events;
+        for (const TriggerEvent &event : EngineBindings::getPhysicsManager()->drainTriggerEvents())
+        {
+            events.append(py::make_tuple(event.trigger, event.other, static_cast<int>(event.type)));
+        }
+        return events; }, "Return the trigger events queued by physics_update() since the last call, oldest first, and clear the queue. Each event is a (trigger, other, kind) tuple where kind is TRIGGER_ENTER, TRIGGER_STAY or TRIGGER_EXIT. Overlaps with trigger colliders are reported here instead of being resolved.");
+
+    m.def("get_contacts", []()
+          { return py::memoryview(py::cast(ContactBuffer{EngineBindings::getPhysicsManager()->shareContactRecords()})); }, "Return the solid contacts of the last physics_update() as a read-only memoryview over the engine's buffer, without copying it, one 32-byte record per contact: entity_a, entity_b (uint64), normal_x, normal_y (float32, pushing entity_a away from entity_b), penetration (float32) and 4 zero bytes. The view keeps its records alive and unchanged after later physics_update() calls, which then write to a new buffer while it is held. Use numpy.asarray(view) for a structured array, or struct.iter_unpack('QQfff4x', view.cast('B')) without numpy.");
+
+    m.def("raycast", [](float x, float y, float dx, float dy, int max_hits, uint32_t mask)
+          {
+        if (max_hits < 0)
+            throw std::runtime_error("max_hits must be 0 (every hit) or positive.");
+        auto &entities = queryScratch();
+        EngineBindings::getPhysicsManager()->raycast({x, y}, {dx, dy}, entities, static_cast<size_t>(max_hits), mask);
+        return toList(entities); }, py::arg("x"), py::arg("y"), py::arg("dx"), py::arg("dy"), py::arg("max_hits") = 0, py::arg("mask") = 0xFFFFFFFF, "Return the entities whose colliders the segment from (x, y) to (x + dx, y + dy) touches, nearest first. max_hits stops at that many (1 for line of sight); 0 returns every hit. Only colliders whose category shares a bit with mask are tested. Queries see the world as the last physics_update() left it.");
+
+    m.def("query_aabb", [](float min_x, float min_y, float max_x, float max_y, uint32_t mask)
+          {
+        auto &entities = queryScratch();
+        EngineBindings::getPhysicsManager()->queryAABB({{min_x, min_y}, {max_x, max_y}}, entities, mask);
+        return toList(entities); }, py::arg("min_x"), py::arg("min_y"), py::arg("max_x"), py::arg("max_y"), py::arg("mask") = 0xFFFFFFFF, "Return the entities whose colliders overlap or touch the box from (min_x, min_y) to (max_x, max_y), in ascending ID order. Only colliders whose category shares a bit with mask are reported.");
+
+    m.def("query_circle", [](float x, float y, float radius, uint32_t mask)
+          {
+        auto &entities = queryScratch();
+        EngineBindings::getPhysicsManager()->queryCircle({x, y}, radius, entities, mask);
+        return toList(entities); }, py::arg("x"), py::arg("y"), py::arg("radius"), py::arg("mask") = 0xFFFFFFFF, "Return the entities whose colliders overlap or touch the circle of the given radius around (x, y), in ascending ID order. Only colliders whose category shares a bit with mask are reported.");
+
+    m.def("nearest_k", [](float x, float y, int k, float max_distance, uint32_t mask)
+          {
+        if (k < 0)
+            throw std::runtime_error("k must not be negative.");
+        auto &entities = queryScratch();
+        float limit = max_distance < 0.0f ? INFINITY : max_distance;
+        EngineBindings::getPhysicsManager()->queryNearest({x, y}, static_cast<size_t>(k), entities, limit, mask);
+        return toList(entities); }, py::arg("x"), py::arg("y"), py::arg("k"), py::arg("max_distance") = -1.0f, py::arg("mask") = 0xFFFFFFFF, "Return up to k entities whose colliders are closest to (x, y), nearest first, measured to the collider's edge (0 when (x, y) is inside it). max_distance limits the search radius; a negative value means no limit. Only colliders whose category shares a bit with mask are reported.");
+}
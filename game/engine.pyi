@@ -23,6 +23,14 @@ def create_entity() -> int:
     """Create a new entity and return its unique ID."""
     ...
 
+def delete_entity(entity: int) -> bool:
+    """Remove every component of an entity and retire its ID. Returns False if the entity was already deleted. The ID's slot is reused by later entities under a new generation, so the old ID stays dead."""
+    ...
+
+def is_alive(entity: int) -> bool:
+    """Return whether an entity ID still refers to a live entity, i.e. it was created and not deleted since."""
+    ...
+
 def add_transform(entity: int, x: float, y: float) -> None:
     """Add a Transform component to an entity."""
     ...
@@ -31,10 +39,26 @@ def add_rigidbody(entity: int, vx: float, vy: float, mass: float) -> None:
     """Add a RigidBody component to an entity."""
     ...
 
-def add_collider_box(entity: int, width: float, height: float, offsetX: float = 0.0, offsetY: float = 0.0) -> None:
+def set_body_type(entity: int, body_type: str) -> None:
+    """Set how an entity's RigidBody is simulated: 'static' (never moves), 'kinematic' (moves by its velocity, never pushed) or 'dynamic' (default)."""
+    ...
+
+def set_continuous(entity: int, enabled: bool = True) -> None:
+    """Enable continuous collision detection for a fast dynamic RigidBody: it is swept along its velocity each tick so it cannot pass through static or sleeping colliders."""
+    ...
+
+def add_collider_box(entity: int, width: float, height: float, offsetX: float = 0.0, offsetY: float = 0.0, category: int = 1, mask: int = 0xFFFFFFFF, is_trigger: bool = False) -> None:
+    ...
+
+def add_collider_circle(entity: int, radius: float, offsetX: float = 0.0, offsetY: float = 0.0, category: int = 1, mask: int = 0xFFFFFFFF, is_trigger: bool = False) -> None:
     ...
 
-def add_collider_circle(entity: int, radius: float, offsetX: float = 0.0, offsetY: float = 0.0) -> None:
+def add_collider_polygon(entity: int, points: list[Tuple[float, float]], offsetX: float = 0.0, offsetY: float = 0.0, category: int = 1, mask: int = 0xFFFFFFFF, is_trigger: bool = False) -> None:
+    """Add a convex polygon Collider component to an entity, from up to 8 (x, y) points around its position in any order; their convex hull is used. The polygon turns with the Transform's rotation. Two colliders only collide if each one's category bits are set in the other's mask. Trigger colliders report overlaps through drain_trigger_events() instead of blocking."""
+    ...
+
+def add_tilemap_collider(entity: int, tiles: list[str], tile_size: float, category: int = 1, mask: int = 0xFFFFFFFF) -> None:
+    """Add a static TileMapCollider to an entity from rows of tiles, first row at the entity's position and each next one tile_size further down. '.' and ' ' are empty, any other character is solid. Solid tiles are merged into rectangles once, here, and bodies only test the tiles under them, so the cost does not grow with the map."""
     ...
 
 def get_position(entity: int) -> Tuple[float, float]:
@@ -45,6 +69,10 @@ def set_position(entity: int, x: float, y: float) -> None:
     """Set the position of an entity's Transform component."""
     ...
 
+def set_rotation(entity: int, degrees: float) -> None:
+    """Set the rotation of an entity's Transform component, in degrees. Box colliders turn with it and are then tested as oriented boxes; circle colliders are unaffected."""
+    ...
+
 def get_velocity(entity: int) -> Tuple[float, float]:
     """Get the velocity of an entity's RigidBody component."""
     ...
@@ -53,6 +81,18 @@ def set_velocity(entity: int, vx: float, vy: float) -> None:
     """Set the velocity of an entity's RigidBody component."""
     ...
 
+def apply_force(entity: int, fx: float, fy: float) -> None:
+    """Add a force to an entity's dynamic RigidBody for the next physics_update(). Forces accumulate until that update applies them, then reset to zero."""
+    ...
+
+def set_damping(entity: int, linear_damping: float = 0.0, gravity_scale: float = 1.0) -> None:
+    """Set how an entity's dynamic RigidBody responds to the world: its velocity is divided by (1 + dt * linear_damping) every tick, and gravity is multiplied by gravity_scale."""
+    ...
+
+def is_awake(entity: int) -> bool:
+    """Return False while the physics step has put the entity's RigidBody to sleep."""
+    ...
+
 def add_sprite(entity: int, textureId: str, width: int = 0, height: int = 0) -> None:
     ...
 
@@ -145,6 +185,74 @@ def physics_update(dt: float) -> None:
     """Update the physics simulation by a given time step (dt). This will move all physics-enabled entities according to their velocities and handle collisions."""
     ...
 
+def set_broad_phase(name: str, cell_size: float = 64.0, axis: str = "x", margin: float = 4.0) -> None:
+    """Select the broad-phase for this scene: 'spatial_hash' (uniform grid, cell_size in world units), 'sweep_and_prune' (sorted along axis 'x' or 'y'), 'aabb_tree' (dynamic BVH, leaves fattened by margin world units) or 'brute_force'."""
+    ...
+
+def set_sleep(enabled: bool, velocity_threshold: float = 1.0, time_to_sleep: float = 0.5) -> None:
+    """Configure automatic sleeping: bodies in contact fall asleep together once all of them have moved slower than velocity_threshold for time_to_sleep seconds. Disabling sleep wakes every body."""
+    ...
+
+def set_physics_threads(count: int = 0) -> None:
+    """Split the collision narrow-phase across count threads, including the main thread. 0 uses every hardware thread, 1 keeps physics single-threaded. Results are identical either way."""
+    ...
+
+def set_physics_substeps(substeps: int = 1) -> None:
+    """Split every physics_update(dt) into substeps steps of dt / substeps, for stiffer contacts and smaller tunnelling distances. Values below 1 are raised to 1."""
+    ...
+
+def set_gravity(x: float, y: float) -> None:
+    """Set the acceleration applied to every dynamic body each tick, in world units per second squared, scaled by the body's gravity scale. Defaults to (0, 0)."""
+    ...
+
+def physics_checksum() -> int:
+    """Return a 64-bit hash of every rigid body's position, velocity and sleep state. Physics is deterministic, so lockstep peers or a replay that fed the same updates get the same value on every machine; compare it each tick to detect a desync."""
+    ...
+
+def physics_stats() -> dict[str, float]:
+    """Return the counters of the last physics_update() as a dict: tick, dt, substeps, collider counts (moving_colliders, static_colliders, sleeping_colliders), broad_phase_pairs, narrow_phase_tests, contacts, trigger_overlaps, solver iterations, and wall-clock milliseconds per stage (integrate_ms, broad_phase_ms, continuous_ms, narrow_phase_ms, solver_ms, sleep_ms, total_ms). Collider counts are from the last substep; everything else is summed over substeps."""
+    ...
+
+def physics_trace(enabled: bool = True) -> None:
+    """Start or stop recording physics_stats() after every physics_update(). Starting a stopped trace discards the previous one."""
+    ...
+
+def save_physics_trace(path: str) -> None:
+    """Write the recorded trace to path, one entry per physics_update(), and clear it. A path ending in .json gets a JSON array of objects; anything else gets CSV with a header row. Field names match physics_stats()."""
+    ...
+
+def set_solver(velocity_iterations: int = 8, position_iterations: int = 4, warm_starting: bool = True) -> None:
+    """Configure the contact solver: velocity_iterations and position_iterations passes over every contact per tick, and whether persistent contacts start from last tick's impulse (warm_starting)."""
+    ...
+
+def drain_trigger_events() -> list[Tuple[int, int, int]]:
+    """Return the trigger events queued by physics_update() since the last call, oldest first, and clear the queue. Each event is a (trigger, other, kind) tuple where kind is TRIGGER_ENTER, TRIGGER_STAY or TRIGGER_EXIT. Overlaps with trigger colliders are reported here instead of being resolved."""
+    ...
+
+def get_contacts() -> memoryview:
+    """Return the solid contacts of the last physics_update() as a read-only memoryview over the engine's buffer, without copying it, one 32-byte record per contact: entity_a, entity_b (uint64), normal_x, normal_y (float32, pushing entity_a away from entity_b), penetration (float32) and 4 zero bytes. The view keeps its records alive and unchanged after later physics_update() calls, which then write to a new buffer while it is held. Use numpy.asarray(view) for a structured array, or struct.iter_unpack('QQfff4x', view.cast('B')) without numpy."""
+    ...
+
+def raycast(x: float, y: float, dx: float, dy: float, max_hits: int = 0, mask: int = 0xFFFFFFFF) -> list[int]:
+    """Return the entities whose colliders the segment from (x, y) to (x + dx, y + dy) touches, nearest first. max_hits stops at that many (1 for line of sight); 0 returns every hit. Only colliders whose category shares a bit with mask are tested. Queries see the world as the last physics_update() left it."""
+    ...
+
+def query_aabb(min_x: float, min_y: float, max_x: float, max_y: float, mask: int = 0xFFFFFFFF) -> list[int]:
+    """Return the entities whose colliders overlap or touch the box from (min_x, min_y) to (max_x, max_y), in ascending ID order. Only colliders whose category shares a bit with mask are reported."""
+    ...
+
+def query_circle(x: float, y: float, radius: float, mask: int = 0xFFFFFFFF) -> list[int]:
+    """Return the entities whose colliders overlap or touch the circle of the given radius around (x, y), in ascending ID order. Only colliders whose category shares a bit with mask are reported."""
+    ...
+
+def nearest_k(x: float, y: float, k: int, max_distance: float = -1.0, mask: int = 0xFFFFFFFF) -> list[int]:
+    """Return up to k entities whose colliders are closest to (x, y), nearest first, measured to the collider's edge (0 when (x, y) is inside it). max_distance limits the search radius; a negative value means no limit. Only colliders whose category shares a bit with mask are reported."""
+    ...
+
+TRIGGER_ENTER: int
+TRIGGER_STAY: int
+TRIGGER_EXIT: int
+
 # -- Render -------------------------------------------------
 
 def render() -> None:
@@ -20,12 +20,12 @@ class GameObject:
         engine.add_rigidbody(self.id, vx, vy, mass)
         return self
 
-    def add_box_collider(self, width, height, ox=0.0, oy=0.0):
-        engine.add_collider_box(self.id, width, height, ox, oy)
+    def add_box_collider(self, width, height, ox=0.0, oy=0.0, category=1, mask=0xFFFFFFFF, trigger=False):
+        engine.add_collider_box(self.id, width, height, ox, oy, category, mask, trigger)
         return self
 
-    def add_circle_collider(self, radius, ox=0.0, oy=0.0):
-        engine.add_collider_circle(self.id, radius, ox, oy)
+    def add_circle_collider(self, radius, ox=0.0, oy=0.0, category=1, mask=0xFFFFFFFF, trigger=False):
+        engine.add_collider_circle(self.id, radius, ox, oy, category, mask, trigger)
         return self
 
     def play_animation(self, tag_name):
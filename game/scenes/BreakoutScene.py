@@ -28,6 +28,7 @@ paddle: Optional[GameObject] = None
 ball: Optional[GameObject] = None
 bricks: list[GameObject] = []
 brick_alive: list[bool] = []
+brick_index: dict[int, int] = {}  # entity id -> index into bricks
 
 ball_vx: float = 0.0
 ball_vy: float = 0.0
@@ -40,7 +41,7 @@ game_won: bool = False
 
 
 def init():
-    global paddle, ball, bricks, brick_alive
+    global paddle, ball, bricks, brick_alive, brick_index
     global ball_vx, ball_vy, ball_launched, score, lives, game_over, game_won
 
     # Load assets — you'll create these sprites to match:
@@ -69,14 +70,17 @@ def init():
     paddle.add_sprite("paddle", PADDLE_W, PADDLE_H)
     paddle.add_box_collider(PADDLE_W, PADDLE_H)
 
-    # Ball — starts sitting on the paddle
+    # Ball — starts sitting on the paddle. Moved by hand, its trigger collider reports paddle and brick hits
     ball = GameObject(0.0, PADDLE_Y - PADDLE_H)
     ball.add_sprite("ball", BALL_SIZE, BALL_SIZE)
-    ball.add_box_collider(BALL_SIZE, BALL_SIZE)
+    ball.add_rigidbody()
+    engine.set_body_type(ball.id, "kinematic")
+    ball.add_box_collider(BALL_SIZE, BALL_SIZE, trigger=True)
 
     # Bricks
     bricks = []
     brick_alive = []
+    brick_index = {}
     row_textures = ["brick_red", "brick_red", "brick_orange", "brick_orange", "brick_green"]
 
     for row in range(BRICK_ROWS):
@@ -86,6 +90,7 @@ def init():
             brick = GameObject(bx, by)
             brick.add_sprite(row_textures[row], BRICK_W, BRICK_H)
             brick.add_box_collider(BRICK_W, BRICK_H)
+            brick_index[brick.id] = len(bricks)
             bricks.append(brick)
             brick_alive.append(True)
 
@@ -172,36 +177,44 @@ def update(dt):
             _reset_ball()
         return
 
-    # --- Paddle collision ---
-    if ball_vy > 0:  # only when falling
-        if _box_overlap(bx, by, BALL_SIZE, BALL_SIZE, new_px, PADDLE_Y, PADDLE_W, PADDLE_H):
-            by = PADDLE_Y - PADDLE_H / 2 - half_ball
-            ball_vy = -abs(ball_vy)
-            # Angle based on where ball hits paddle
-            hit_offset = (bx - new_px) / (PADDLE_W / 2)  # -1 to 1
-            ball_vx = BALL_SPEED * hit_offset * 1.2
-
-    # --- Brick collision ---
-    for i, brick in enumerate(bricks):
-        if not brick_alive[i]:
+    ball.set_position(bx, by)
+
+    # --- Paddle and brick hits, reported once per frame by the ball's trigger ---
+    engine.physics_update(dt)
+    hit_brick = False
+    for _, other, kind in engine.drain_trigger_events():
+        if kind == engine.TRIGGER_EXIT:
             continue
-        brx, bry = brick.get_position()
-        if _box_overlap(bx, by, BALL_SIZE, BALL_SIZE, brx, bry, BRICK_W, BRICK_H):
-            # Destroy brick
-            brick_alive[i] = False
-            brick.set_position(9999.0, 9999.0)  # move offscreen
-            score += 10
-
-            # Bounce — determine which side was hit
-            dx = bx - brx
-            dy = by - bry
-            if abs(dx) / BRICK_W > abs(dy) / BRICK_H:
-                ball_vx = -ball_vx
-            else:
-                ball_vy = -ball_vy
-            break  # one collision per frame
 
-    ball.set_position(bx, by)
+        if other == paddle.id:
+            if ball_vy > 0:  # only when falling
+                by = PADDLE_Y - PADDLE_H / 2 - half_ball
+                ball_vy = -abs(ball_vy)
+                # Angle based on where ball hits paddle
+                hit_offset = (bx - new_px) / (PADDLE_W / 2)  # -1 to 1
+                ball_vx = BALL_SPEED * hit_offset * 1.2
+                ball.set_position(bx, by)
+            continue
+
+        i = brick_index.get(other)
+        if i is None or not brick_alive[i] or hit_brick:
+            continue  # one brick per frame
+
+        # Destroy brick
+        brick = bricks[i]
+        brick_alive[i] = False
+        brx, bry = brick.get_position()
+        brick.set_position(9999.0, 9999.0)  # move offscreen
+        score += 10
+        hit_brick = True
+
+        # Bounce — determine which side was hit
+        dx = bx - brx
+        dy = by - bry
+        if abs(dx) / BRICK_W > abs(dy) / BRICK_H:
+            ball_vx = -ball_vx
+        else:
+            ball_vy = -ball_vy
 
     # Win check
     if all(not alive for alive in brick_alive):
@@ -218,12 +231,6 @@ def cleanup():
 
 # --- Helpers ---
 
-def _box_overlap(ax, ay, aw, ah, bx, by, bw, bh):
-    """AABB overlap check (center-based coordinates)."""
-    return (abs(ax - bx) < (aw + bw) / 2 and
-            abs(ay - by) < (ah + bh) / 2)
-
-
 def _reset_ball():
     global ball_vx, ball_vy, ball_launched
     assert paddle is not None
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+#include "../../engine/core/JobPool.h"
+
+TEST(JobPoolTest, ZeroThreadsUsesHardwareConcurrency)
+{
+    JobPool pool(0);
+    EXPECT_GE(pool.getThreadCount(), 1u);
+}
+
+TEST(JobPoolTest, EveryIndexIsVisitedOnce)
+{
+    JobPool pool(4);
+    std::vector<int> visits(10000, 0);
+
+    pool.parallelFor(visits.size(), 1, [&](size_t begin, size_t end, size_t)
+                     {
+        for (size_t i = begin; i < end; ++i)
+            ++visits[i]; });
+
+    for (int count : visits)
+    {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(JobPoolTest, SlicesAreContiguousAndOrderedByThread)
+{
+    JobPool pool(4);
+    std::vector<std::pair<size_t, size_t>> slices(pool.getThreadCount(), {0, 0});
+
+    pool.parallelFor(1000, 1, [&](size_t begin, size_t end, size_t thread)
+                     { slices[thread] = {begin, end}; });
+
+    size_t expectedBegin = 0;
+    for (const auto &slice : slices)
+    {
+        EXPECT_EQ(slice.first, expectedBegin);
+        EXPECT_GT(slice.second, slice.first);
+        expectedBegin = slice.second;
+    }
+    EXPECT_EQ(expectedBegin, 1000u);
+}
+
+TEST(JobPoolTest, SmallRangeRunsInlineOnCaller)
+{
+    JobPool pool(4);
+    std::atomic<int> calls{0};
+    size_t seenThread = 99;
+
+    pool.parallelFor(10, 100, [&](size_t begin, size_t end, size_t thread)
+                     {
+        ++calls;
+        seenThread = thread;
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 10u); });
+
+    EXPECT_EQ(calls.load(), 1);
+    EXPECT_EQ(seenThread, 0u);
+}
+
+TEST(JobPoolTest, EmptyRangeRunsNothing)
+{
+    JobPool pool(4);
+    bool called = false;
+
+    pool.parallelFor(0, 1, [&](size_t, size_t, size_t)
+                     { called = true; });
+
+    EXPECT_FALSE(called);
+}
+
+TEST(JobPoolTest, PoolIsReusableAcrossJobs)
+{
+    JobPool pool(3);
+    std::atomic<size_t> total{0};
+
+    for (int job = 0; job < 100; ++job)
+    {
+        pool.parallelFor(300, 1, [&](size_t begin, size_t end, size_t)
+                         { total += end - begin; });
+    }
+
+    EXPECT_EQ(total.load(), 30000u);
+}
@@ -185,3 +185,126 @@ TEST(ComponentPoolTest, StructComponent)
     pool.get(0).x = 5.0f;
     EXPECT_FLOAT_EQ(pool.get(0).x, 5.0f);
 }
+
+TEST(ComponentPoolTest, VersionChangesOnAddAndRemoveOnly)
+{
+    ComponentPool<int> pool;
+    uint64_t initial = pool.getVersion();
+
+    pool.add(0, 10);
+    uint64_t afterAdd = pool.getVersion();
+    EXPECT_NE(afterAdd, initial);
+
+    pool.get(0) = 20;
+    pool.remove(5); // Not in the pool
+    EXPECT_EQ(pool.getVersion(), afterAdd);
+
+    pool.remove(0);
+    EXPECT_NE(pool.getVersion(), afterAdd);
+}
+
+TEST(ComponentPoolTest, StaleGenerationIsNotFound)
+{
+    ComponentPool<int> pool;
+    EntityID old = makeEntityID(3, 0);
+    EntityID reused = makeEntityID(3, 1);
+
+    pool.add(old, 10);
+    EXPECT_FALSE(pool.has(reused));
+
+    pool.remove(old);
+    pool.add(reused, 20);
+    EXPECT_FALSE(pool.has(old));
+    EXPECT_FALSE(pool.remove(old));
+    EXPECT_TRUE(pool.has(reused));
+    EXPECT_EQ(pool.get(reused), 20);
+
+    // Indexed by slot, so the sparse array does not grow with the generation
+    EXPECT_EQ(pool.getSparsePageCount(), 1u);
+}
+
+TEST(ComponentPoolTest, SparsePagesAreAllocatedOnDemandAndFreedWhenEmpty)
+{
+    using Pool = ComponentPool<int>;
+    Pool pool;
+    EXPECT_EQ(pool.getSparsePageCount(), 0u);
+
+    // One entity far out allocates one page, not an array up to its index
+    EntityID far = makeEntityID(10 * Pool::SPARSE_PAGE_SIZE + 7, 0);
+    pool.add(far, 1);
+    EXPECT_EQ(pool.getSparsePageCount(), 1u);
+    EXPECT_LT(pool.getSparseMemory(), 2 * Pool::SPARSE_PAGE_SIZE * sizeof(uint32_t));
+    EXPECT_FALSE(pool.has(far - 1));
+    EXPECT_FALSE(pool.has(makeEntityID(3, 0))); // Page never allocated
+
+    pool.add(0, 2);
+    pool.add(1, 3);
+    EXPECT_EQ(pool.getSparsePageCount(), 2u);
+
+    // Removing swaps the last component into place across pages
+    pool.remove(0);
+    EXPECT_EQ(pool.get(far), 1);
+    EXPECT_EQ(pool.get(1), 3);
+    EXPECT_EQ(pool.getSparsePageCount(), 2u);
+
+    pool.remove(1);
+    EXPECT_EQ(pool.getSparsePageCount(), 1u);
+    EXPECT_FALSE(pool.has(1));
+    pool.remove(far);
+    EXPECT_EQ(pool.getSparsePageCount(), 0u);
+    EXPECT_EQ(pool.size(), 0u);
+
+    // A freed page comes back on the next add
+    pool.add(far, 4);
+    EXPECT_EQ(pool.get(far), 4);
+}
+
+TEST(ComponentPoolTest, SwapDenseKeepsLookupsValid)
+{
+    ComponentPool<int> pool;
+    for (EntityID e = 0; e < 4; ++e)
+        pool.add(e, static_cast<int>(e) * 10);
+
+    uint64_t before = pool.getVersion();
+    pool.swapDense(3, 0);
+    EXPECT_NE(pool.getVersion(), before);
+
+    EXPECT_EQ(pool.getDenseToEntity()[0], 3u);
+    EXPECT_EQ(pool.getDenseToEntity()[3], 0u);
+    EXPECT_EQ(pool.getDenseIndex(3), 0u);
+    EXPECT_EQ(pool.getDenseIndex(0), 3u);
+    for (EntityID e = 0; e < 4; ++e)
+        EXPECT_EQ(pool.get(e), static_cast<int>(e) * 10);
+}
+
+TEST(ComponentPoolTest, MissingComponentHasInvalidDenseIndex)
+{
+    using Pool = ComponentPool<int>;
+    Pool pool;
+    EntityID present = makeEntityID(5, 0);
+    pool.add(present, 7);
+
+    // A page past the table, an unused slot on an allocated page, and a stale generation
+    EXPECT_EQ(pool.getDenseIndex(makeEntityID(3 * Pool::SPARSE_PAGE_SIZE, 0)), Pool::INVALID);
+    EXPECT_EQ(pool.getDenseIndex(makeEntityID(6, 0)), Pool::INVALID);
+    EXPECT_EQ(pool.getDenseIndex(makeEntityID(5, 1)), Pool::INVALID);
+    EXPECT_EQ(pool.getDenseIndex(present), 0u);
+}
+
+TEST(ComponentPoolTest, TryGetReturnsNullForMissing)
+{
+    ComponentPool<int> pool;
+    EXPECT_EQ(pool.tryGet(0), nullptr);
+
+    pool.add(0, 7);
+    ASSERT_NE(pool.tryGet(0), nullptr);
+    *pool.tryGet(0) = 8;
+    EXPECT_EQ(pool.get(0), 8);
+
+    const ComponentPool<int> &constPool = pool;
+    EXPECT_EQ(*constPool.tryGet(0), 8);
+    EXPECT_EQ(constPool.tryGet(makeEntityID(0, 1)), nullptr);
+
+    pool.remove(0);
+    EXPECT_EQ(pool.tryGet(0), nullptr);
+}
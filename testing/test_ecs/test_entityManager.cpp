@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+
+#include <vector>
+
 #include "engine/core/ecs/EntityManager.h"
 #include "engine/core/ecs/components/Transform.h"
 #include "engine/core/ecs/components/RigidBody.h"
@@ -194,3 +197,164 @@ TEST(EntityManagerTest, ColliderComponent)
     EXPECT_FLOAT_EQ(retrieved.radius, 2.5f);
     EXPECT_TRUE(retrieved.isTrigger);
 }
+
+// =============================================================================
+// Entity recycling
+// =============================================================================
+
+namespace
+{
+    /** @brief Create @p count entities, then delete them all, oldest first. */
+    std::vector<EntityID> spawnAndDelete(EntityManager &em, size_t count)
+    {
+        std::vector<EntityID> entities;
+        for (size_t i = 0; i < count; ++i)
+        {
+            entities.push_back(em.createEntity());
+        }
+        for (EntityID e : entities)
+        {
+            em.deleteEntity(e);
+        }
+        return entities;
+    }
+}
+
+TEST(EntityManagerTest, DeletedIndicesAreReusedWithANewGeneration)
+{
+    EntityManager em;
+
+    // Below the reuse threshold every entity still gets a fresh index
+    std::vector<EntityID> deleted = spawnAndDelete(em, 1000);
+    EXPECT_EQ(getEntityIndex(em.createEntity()), 1000u);
+
+    // Past it, indices wait in a queue, so the oldest deleted index comes back first
+    spawnAndDelete(em, 100);
+    EntityID reused = em.createEntity();
+    EXPECT_EQ(getEntityIndex(reused), getEntityIndex(deleted[0]));
+    EXPECT_EQ(getEntityGeneration(reused), getEntityGeneration(deleted[0]) + 1);
+    EXPECT_NE(reused, deleted[0]);
+
+    // Steady create/delete churn stays within the indices already handed out
+    for (int i = 0; i < 10000; ++i)
+    {
+        EntityID e = em.createEntity();
+        EXPECT_LE(getEntityIndex(e), 1100u);
+        em.deleteEntity(e);
+    }
+}
+
+TEST(EntityManagerTest, StaleHandlesAreDetected)
+{
+    EntityManager em;
+    EntityID e = em.createEntity();
+    em.addComponent<ECS::Transform>(e, ECS::Transform{{1.0f, 0.0f}});
+    EXPECT_TRUE(em.isAlive(e));
+    EXPECT_EQ(em.getEntityCount(), 1u);
+
+    EXPECT_TRUE(em.deleteEntity(e));
+    EXPECT_FALSE(em.isAlive(e));
+    EXPECT_FALSE(em.deleteEntity(e));
+    EXPECT_EQ(em.getEntityCount(), 0u);
+
+    // Enough deletions queued behind it that its index is handed out again
+    spawnAndDelete(em, 1100);
+    EntityID reused = em.createEntity();
+    ASSERT_EQ(getEntityIndex(reused), getEntityIndex(e));
+    em.addComponent<ECS::Transform>(reused, ECS::Transform{{2.0f, 0.0f}});
+
+    // The old handle sees none of the new entity's state
+    EXPECT_TRUE(em.isAlive(reused));
+    EXPECT_FALSE(em.isAlive(e));
+    EXPECT_FALSE(em.hasComponent<ECS::Transform>(e));
+    EXPECT_FALSE(em.deleteEntity(e));
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(reused).position.x, 2.0f);
+    EXPECT_EQ(em.getEntityCount(), 1u);
+}
+
+TEST(EntityManagerTest, NeverCreatedHandlesAreNotAlive)
+{
+    EntityManager em;
+    EntityID e = em.createEntity();
+
+    EXPECT_FALSE(em.isAlive(e + 1));
+    EXPECT_FALSE(em.isAlive(makeEntityID(getEntityIndex(e), 1)));
+    EXPECT_FALSE(em.deleteEntity(e + 1));
+}
+
+TEST(EntityManagerTest, IndicesCoverMillionsOfEntities)
+{
+    // Millions of live entities, the scale the paged component pools are sized for
+    constexpr uint32_t COUNT = 4000000;
+    EntityManager em;
+    EntityID last = 0;
+    for (uint32_t i = 0; i < COUNT; ++i)
+    {
+        last = em.createEntity();
+    }
+
+    EXPECT_EQ(getEntityIndex(last), COUNT - 1);
+    EXPECT_EQ(getEntityGeneration(last), 0u);
+    EXPECT_TRUE(em.isAlive(0));
+    EXPECT_EQ(em.getEntityCount(), static_cast<size_t>(COUNT));
+}
+
+TEST(EntityManagerTest, GenerationUsesTheHighHalf)
+{
+    EntityID entity = makeEntityID(0xFFFFFFFEu, 0xFFFFFFFFu);
+    EXPECT_EQ(getEntityIndex(entity), 0xFFFFFFFEu);
+    EXPECT_EQ(getEntityGeneration(entity), 0xFFFFFFFFu);
+    EXPECT_EQ(entity, 0xFFFFFFFFFFFFFFFEull);
+}
+
+// =============================================================================
+// Component signatures
+// =============================================================================
+
+TEST(EntityManagerTest, HasAllComponentsMatchesTheSignature)
+{
+    EntityManager em;
+    EntityID e = em.createEntity();
+    em.addComponent<ECS::Transform>(e, ECS::Transform{});
+    em.addComponent<ECS::RigidBody>(e, ECS::RigidBody{});
+
+    EXPECT_TRUE((em.hasAllComponents<ECS::Transform, ECS::RigidBody>(e)));
+    EXPECT_TRUE(em.hasAllComponents<ECS::RigidBody>(e));
+    EXPECT_FALSE((em.hasAllComponents<ECS::Transform, ECS::Collider>(e)));
+    EXPECT_EQ(em.getSignature(e), (EntityManager::makeSignature<ECS::Transform, ECS::RigidBody>()));
+
+    // Removing straight from the pool keeps the signature in step
+    em.getComponentPool<ECS::RigidBody>().remove(e);
+    EXPECT_FALSE((em.hasAllComponents<ECS::Transform, ECS::RigidBody>(e)));
+    EXPECT_TRUE(em.hasAllComponents<ECS::Transform>(e));
+
+    em.deleteEntity(e);
+    EXPECT_FALSE(em.hasAllComponents<ECS::Transform>(e));
+    EXPECT_TRUE(em.getSignature(e).none());
+}
+
+TEST(EntityManagerTest, DeleteEntityOnlyTouchesItsOwnPools)
+{
+    EntityManager em;
+    EntityID a = em.createEntity();
+    EntityID b = em.createEntity();
+    em.addComponent<ECS::Transform>(a, ECS::Transform{});
+    em.addComponent<ECS::Collider>(a, ECS::Collider{});
+    em.addComponent<ECS::RigidBody>(b, ECS::RigidBody{});
+
+    uint64_t bodyVersion = em.getComponentPool<ECS::RigidBody>().getVersion();
+    uint64_t transformVersion = em.getComponentPool<ECS::Transform>().getVersion();
+    EXPECT_TRUE(em.deleteEntity(a));
+
+    EXPECT_EQ(em.getComponentPool<ECS::RigidBody>().getVersion(), bodyVersion);
+    EXPECT_NE(em.getComponentPool<ECS::Transform>().getVersion(), transformVersion);
+    EXPECT_EQ(em.getComponentPool<ECS::Transform>().size(), 0u);
+    EXPECT_EQ(em.getComponentPool<ECS::Collider>().size(), 0u);
+
+    // An entity reusing the index starts with an empty signature
+    spawnAndDelete(em, 1100);
+    EntityID reused = em.createEntity();
+    ASSERT_EQ(getEntityIndex(reused), getEntityIndex(a));
+    EXPECT_TRUE(em.getSignature(reused).none());
+    EXPECT_TRUE(em.hasAllComponents<ECS::RigidBody>(b));
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include "engine/core/ecs/EntityManager.h"
+#include "engine/core/ecs/components/Transform.h"
+#include "engine/core/ecs/components/RigidBody.h"
+#include "engine/core/ecs/components/Sprite.h"
+
+namespace
+{
+    /** @brief Both pools start with the same size() entities, which are exactly those with both components. */
+    void expectPacked(EntityManager &em, const Group<ECS::Transform, ECS::RigidBody> &group)
+    {
+        const auto &transforms = em.getComponentPool<ECS::Transform>().getDenseToEntity();
+        const auto &bodies = em.getComponentPool<ECS::RigidBody>().getDenseToEntity();
+        ASSERT_LE(group.size(), transforms.size());
+        ASSERT_LE(group.size(), bodies.size());
+
+        for (size_t i = 0; i < group.size(); ++i)
+        {
+            EXPECT_EQ(transforms[i], bodies[i]) << "at " << i;
+        }
+        for (size_t i = group.size(); i < transforms.size(); ++i)
+        {
+            EXPECT_FALSE(em.hasComponent<ECS::RigidBody>(transforms[i])) << transforms[i] << " has both but is outside the group";
+        }
+        for (size_t i = group.size(); i < bodies.size(); ++i)
+        {
+            EXPECT_FALSE(em.hasComponent<ECS::Transform>(bodies[i])) << bodies[i] << " has both but is outside the group";
+        }
+    }
+}
+
+// ===========================================================================
+// Packing
+// ===========================================================================
+
+TEST(GroupTest, RegisteringPacksExistingEntities)
+{
+    EntityManager em;
+    std::vector<EntityID> both;
+    for (int i = 0; i < 20; ++i)
+    {
+        EntityID e = em.createEntity();
+        if (i % 2 == 0)
+            em.addComponent<ECS::Transform>(e, ECS::Transform{{static_cast<float>(i), 0.0f}});
+        if (i % 3 == 0)
+            em.addComponent<ECS::RigidBody>(e, ECS::RigidBody{{static_cast<float>(i), 0.0f}, 1.0f});
+        if (i % 6 == 0)
+            both.push_back(e);
+    }
+
+    auto group = em.group<ECS::Transform, ECS::RigidBody>();
+    EXPECT_EQ(group.size(), both.size());
+    expectPacked(em, group);
+
+    std::vector<EntityID> members(group.begin(), group.end());
+    std::sort(members.begin(), members.end());
+    EXPECT_EQ(members, both);
+}
+
+TEST(GroupTest, AddAndRemoveKeepThePoolsPacked)
+{
+    EntityManager em;
+    auto group = em.group<ECS::Transform, ECS::RigidBody>();
+
+    std::mt19937 rng(7);
+    std::vector<EntityID> entities;
+    for (int i = 0; i < 2000; ++i)
+    {
+        int action = static_cast<int>(rng() % 6);
+        if (action == 0 || entities.empty())
+        {
+            entities.push_back(em.createEntity());
+            continue;
+        }
+
+        size_t pick = rng() % entities.size();
+        EntityID e = entities[pick];
+        if (action == 1 && !em.hasComponent<ECS::Transform>(e))
+            em.addComponent<ECS::Transform>(e, ECS::Transform{{static_cast<float>(e), 0.0f}});
+        else if (action == 2 && !em.hasComponent<ECS::RigidBody>(e))
+            em.addComponent<ECS::RigidBody>(e, ECS::RigidBody{{static_cast<float>(e), 0.0f}, 1.0f});
+        else if (action == 3)
+            em.getComponentPool<ECS::Transform>().remove(e);
+        else if (action == 4)
+            em.getComponentPool<ECS::RigidBody>().remove(e);
+        else if (action == 5)
+        {
+            em.deleteEntity(e);
+            entities.erase(entities.begin() + static_cast<std::ptrdiff_t>(pick));
+        }
+    }
+
+    expectPacked(em, group);
+    for (auto [entity, transform, body] : group.each())
+    {
+        // Swaps moved the components with their entities
+        EXPECT_FLOAT_EQ(transform.position.x, static_cast<float>(entity));
+        EXPECT_FLOAT_EQ(body.velocity.x, static_cast<float>(entity));
+    }
+}
+
+TEST(GroupTest, AddReturnsTheMovedComponent)
+{
+    EntityManager em;
+    em.group<ECS::Transform, ECS::RigidBody>();
+
+    EntityID loner = em.createEntity();
+    em.addComponent<ECS::RigidBody>(loner, ECS::RigidBody{});
+    EntityID e = em.createEntity();
+    em.addComponent<ECS::Transform>(e, ECS::Transform{});
+
+    // Completing the set swaps the new body in front of the loner's
+    ECS::RigidBody &body = em.addComponent<ECS::RigidBody>(e, ECS::RigidBody{{3.0f, 0.0f}, 1.0f});
+    EXPECT_EQ(&body, &em.getComponent<ECS::RigidBody>(e));
+    EXPECT_FLOAT_EQ(body.velocity.x, 3.0f);
+    EXPECT_EQ(em.getComponentPool<ECS::RigidBody>().getDenseIndex(e), 0u);
+}
+
+// ===========================================================================
+// Iteration
+// ===========================================================================
+
+TEST(GroupTest, EachAndDataWalkTheSameEntities)
+{
+    EntityManager em;
+    for (int i = 0; i < 10; ++i)
+    {
+        EntityID e = em.createEntity();
+        em.addComponent<ECS::Transform>(e, ECS::Transform{{static_cast<float>(i), 0.0f}});
+        if (i != 4)
+            em.addComponent<ECS::RigidBody>(e, ECS::RigidBody{{static_cast<float>(i), 0.0f}, 1.0f});
+    }
+
+    auto group = em.group<ECS::RigidBody, ECS::Transform>();
+    ASSERT_EQ(group.size(), 9u);
+
+    ECS::Transform *transforms = group.data<ECS::Transform>();
+    ECS::RigidBody *bodies = group.data<ECS::RigidBody>();
+    size_t i = 0;
+    for (auto [entity, body, transform] : group.each())
+    {
+        EXPECT_EQ(entity, group.begin()[i]);
+        EXPECT_EQ(&body, &bodies[i]);
+        EXPECT_EQ(&transform, &transforms[i]);
+        EXPECT_FLOAT_EQ(body.velocity.x, transform.position.x);
+        ++i;
+    }
+    EXPECT_EQ(i, 9u);
+}
+
+TEST(GroupTest, RegisteringAgainReturnsTheSameGroup)
+{
+    EntityManager em;
+    EntityID e = em.createEntity();
+    em.addComponent<ECS::Transform>(e, ECS::Transform{});
+    em.addComponent<ECS::RigidBody>(e, ECS::RigidBody{});
+
+    auto first = em.group<ECS::Transform, ECS::RigidBody>();
+    auto second = em.group<ECS::RigidBody, ECS::Transform>();
+    EXPECT_EQ(first.size(), 1u);
+    EXPECT_EQ(second.size(), 1u);
+
+    EntityID other = em.createEntity();
+    em.addComponent<ECS::RigidBody>(other, ECS::RigidBody{});
+    em.addComponent<ECS::Transform>(other, ECS::Transform{});
+    EXPECT_EQ(first.size(), 2u);
+    EXPECT_EQ(second.size(), 2u);
+    EXPECT_EQ(em.getComponentPool<ECS::Sprite>().getGroup(), nullptr);
+}
@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 #include "engine/core/ecs/EntityManager.h"
 #include "engine/core/ecs/components/Transform.h"
 #include "engine/core/ecs/components/RigidBody.h"
@@ -408,3 +411,91 @@ TEST(ViewTest, LargeScaleView)
     }
     EXPECT_EQ(count, 500);
 }
+
+// ===========================================================================
+// Component tuples
+// ===========================================================================
+
+TEST(ViewTest, EachYieldsEntityWithItsComponents)
+{
+    EntityManager em;
+    for (int i = 0; i < 10; ++i)
+    {
+        EntityID e = em.createEntity();
+        em.addComponent<ECS::Transform>(e, ECS::Transform{{static_cast<float>(i), 0.0f}});
+        if (i % 3 == 0)
+            em.addComponent<ECS::RigidBody>(e, ECS::RigidBody{{static_cast<float>(i), 0.0f}, 1.0f});
+    }
+
+    // Either pool order must pair each entity with its own components, whichever pool drives
+    int count = 0;
+    for (auto [entity, transform, body] : em.view<ECS::Transform, ECS::RigidBody>().each())
+    {
+        EXPECT_EQ(&transform, &em.getComponent<ECS::Transform>(entity));
+        EXPECT_EQ(&body, &em.getComponent<ECS::RigidBody>(entity));
+        EXPECT_FLOAT_EQ(transform.position.x, body.velocity.x);
+        count++;
+    }
+    EXPECT_EQ(count, 4);
+
+    count = 0;
+    for (auto [entity, body, transform] : em.view<ECS::RigidBody, ECS::Transform>().each())
+    {
+        EXPECT_EQ(&transform, &em.getComponent<ECS::Transform>(entity));
+        EXPECT_FLOAT_EQ(transform.position.x, body.velocity.x);
+        count++;
+    }
+    EXPECT_EQ(count, 4);
+}
+
+TEST(ViewTest, EachWritesThroughAndConstComponentsAreReadOnly)
+{
+    EntityManager em;
+    EntityID e0 = em.createEntity();
+    em.addComponent<ECS::Transform>(e0, ECS::Transform{{1.0f, 2.0f}});
+
+    for (auto [entity, transform] : em.view<ECS::Transform>().each())
+        transform.position.x += 10.0f;
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(e0).position.x, 11.0f);
+
+    using ConstTuple = decltype(*em.view<const ECS::Transform>().each().begin());
+    static_assert(std::is_same_v<std::tuple_element_t<1, ConstTuple>, const ECS::Transform &>);
+
+    const EntityManager &constEm = em;
+    using FromConstManager = decltype(*constEm.view<ECS::Transform>().each().begin());
+    static_assert(std::is_same_v<std::tuple_element_t<1, FromConstManager>, const ECS::Transform &>);
+}
+
+TEST(ViewTest, EachIsEmptyWhenAPoolIsMissing)
+{
+    EntityManager em;
+    EntityID e0 = em.createEntity();
+    em.addComponent<ECS::Transform>(e0, ECS::Transform{});
+
+    int count = 0;
+    for (auto [entity, transform, sprite] : em.view<ECS::Transform, ECS::Sprite>().each())
+    {
+        (void)entity;
+        count++;
+    }
+    EXPECT_EQ(count, 0);
+}
+
+TEST(ViewTest, EachSkipsEntitiesThatLostAComponent)
+{
+    EntityManager em;
+    EntityID e0 = em.createEntity();
+    EntityID e1 = em.createEntity();
+    for (EntityID e : {e0, e1})
+    {
+        em.addComponent<ECS::Transform>(e, ECS::Transform{});
+        em.addComponent<ECS::Collider>(e, ECS::Collider{});
+    }
+    em.getComponentPool<ECS::Collider>().remove(e0);
+
+    std::vector<EntityID> seen;
+    for (auto [entity, transform, collider] : em.view<ECS::Transform, ECS::Collider>().each())
+        seen.push_back(entity);
+    ASSERT_EQ(seen.size(), 1u);
+    EXPECT_EQ(seen[0], e1);
+}
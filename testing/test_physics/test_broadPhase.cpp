@@ -0,0 +1,548 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+
+#include "engine/physics/broadphase/AABBTreeBroadPhase.h"
+#include "engine/physics/broadphase/BruteForceBroadPhase.h"
+#include "engine/physics/broadphase/SpatialHashBroadPhase.h"
+#include "engine/physics/broadphase/SweepAndPruneBroadPhase.h"
+#include "engine/physics/PhysicsManager.h"
+#include "engine/core/ecs/EntityManager.h"
+#include "engine/core/ecs/components/Transform.h"
+#include "engine/core/ecs/components/RigidBody.h"
+#include "engine/core/ecs/components/Collider.h"
+
+namespace
+{
+    BroadPhaseProxy makeProxy(EntityID entity, glm::vec2 center, glm::vec2 size)
+    {
+        return {entity, {center - size * 0.5f, center + size * 0.5f}};
+    }
+
+    std::vector<CollisionPair> collectPairs(IBroadPhase &broadPhase, const std::vector<BroadPhaseProxy> &proxies)
+    {
+        std::vector<CollisionPair> pairs;
+        broadPhase.update(proxies);
+        broadPhase.findPairs(pairs);
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+
+    std::vector<BroadPhaseProxy> makeRandomProxies(size_t count, float worldSize, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-worldSize, worldSize);
+        std::uniform_real_distribution<float> size(1.0f, 40.0f);
+
+        std::vector<BroadPhaseProxy> proxies;
+        for (size_t i = 0; i < count; ++i)
+        {
+            proxies.push_back(makeProxy(static_cast<EntityID>(i), {position(rng), position(rng)}, {size(rng), size(rng)}));
+        }
+        return proxies;
+    }
+
+    // One factory per IBroadPhase implementation (and per configuration worth covering) for the shared cases
+    struct BruteForceFactory
+    {
+        static std::unique_ptr<IBroadPhase> make() { return std::make_unique<BruteForceBroadPhase>(); }
+    };
+
+    struct SpatialHashFactory
+    {
+        static std::unique_ptr<IBroadPhase> make() { return std::make_unique<SpatialHashBroadPhase>(16.0f); }
+    };
+
+    struct SweepAndPruneXFactory
+    {
+        static std::unique_ptr<IBroadPhase> make() { return std::make_unique<SweepAndPruneBroadPhase>(SweepAndPruneBroadPhase::Axis::X); }
+    };
+
+    struct SweepAndPruneYFactory
+    {
+        static std::unique_ptr<IBroadPhase> make() { return std::make_unique<SweepAndPruneBroadPhase>(SweepAndPruneBroadPhase::Axis::Y); }
+    };
+
+    struct AABBTreeFactory
+    {
+        static std::unique_ptr<IBroadPhase> make() { return std::make_unique<AABBTreeBroadPhase>(2.0f); }
+    };
+}
+
+// =============================================================================
+// Every IBroadPhase
+// =============================================================================
+
+template <typename Factory>
+class BroadPhaseContractTest : public ::testing::Test
+{
+protected:
+    std::unique_ptr<IBroadPhase> broadPhase = Factory::make();
+};
+
+using BroadPhaseFactories = ::testing::Types<BruteForceFactory, SpatialHashFactory, SweepAndPruneXFactory, SweepAndPruneYFactory, AABBTreeFactory>;
+TYPED_TEST_SUITE(BroadPhaseContractTest, BroadPhaseFactories);
+
+TYPED_TEST(BroadPhaseContractTest, OverlappingProxiesProduceOnePair)
+{
+    auto pairs = collectPairs(*this->broadPhase, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                                                  makeProxy(1, {1.0f, 1.0f}, {4.0f, 4.0f})});
+
+    ASSERT_EQ(pairs.size(), 1u);
+    EXPECT_EQ(pairs[0].entityA, 0u);
+    EXPECT_EQ(pairs[0].entityB, 1u);
+}
+
+TYPED_TEST(BroadPhaseContractTest, DistantProxiesProduceNoPair)
+{
+    auto pairs = collectPairs(*this->broadPhase, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                                                  makeProxy(1, {100.0f, 0.0f}, {4.0f, 4.0f}),
+                                                  makeProxy(2, {0.0f, 100.0f}, {4.0f, 4.0f})});
+
+    EXPECT_TRUE(pairs.empty());
+}
+
+TYPED_TEST(BroadPhaseContractTest, PairOrderedByEntityID)
+{
+    auto pairs = collectPairs(*this->broadPhase, {makeProxy(9, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                                                  makeProxy(2, {1.0f, 0.0f}, {4.0f, 4.0f})});
+
+    ASSERT_EQ(pairs.size(), 1u);
+    EXPECT_EQ(pairs[0].entityA, 2u);
+    EXPECT_EQ(pairs[0].entityB, 9u);
+}
+
+TYPED_TEST(BroadPhaseContractTest, NegativeCoordinatesAcrossOrigin)
+{
+    auto pairs = collectPairs(*this->broadPhase, {makeProxy(0, {-1.0f, -1.0f}, {3.0f, 3.0f}),
+                                                  makeProxy(1, {1.0f, 1.0f}, {3.0f, 3.0f})});
+
+    EXPECT_EQ(pairs.size(), 1u);
+}
+
+TYPED_TEST(BroadPhaseContractTest, TouchingEdgesStillReported)
+{
+    // Narrow-phase decides whether touching counts; the broad-phase must not drop it
+    auto pairs = collectPairs(*this->broadPhase, {makeProxy(0, {0.0f, 0.0f}, {2.0f, 2.0f}),
+                                                  makeProxy(1, {2.0f, 0.0f}, {2.0f, 2.0f})});
+
+    EXPECT_EQ(pairs.size(), 1u);
+}
+
+TYPED_TEST(BroadPhaseContractTest, MatchesBruteForceOnRandomScene)
+{
+    auto proxies = makeRandomProxies(500, 300.0f, 7);
+    BruteForceBroadPhase bruteForce;
+
+    EXPECT_EQ(collectPairs(*this->broadPhase, proxies), collectPairs(bruteForce, proxies));
+}
+
+TYPED_TEST(BroadPhaseContractTest, MatchesBruteForceAcrossMovingTicks)
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> step(-3.0f, 3.0f);
+    std::vector<BroadPhaseProxy> proxies = makeRandomProxies(300, 150.0f, 9);
+    BruteForceBroadPhase bruteForce;
+
+    for (int tick = 0; tick < 30; ++tick)
+    {
+        // A third of the proxies move, a few drop out and come back, and one new entity joins every few ticks
+        std::vector<BroadPhaseProxy> frame;
+        for (BroadPhaseProxy &proxy : proxies)
+        {
+            if (proxy.entity % 3 == 0)
+            {
+                glm::vec2 offset{step(rng), step(rng)};
+                proxy.aabb.min += offset;
+                proxy.aabb.max += offset;
+            }
+            if ((proxy.entity + tick) % 17 != 0)
+                frame.push_back(proxy);
+        }
+        if (tick % 5 == 4)
+            proxies.push_back(makeProxy(static_cast<EntityID>(1000 + tick), {tick * 10.0f - 150.0f, 20.0f}, {30.0f, 30.0f}));
+
+        ASSERT_EQ(collectPairs(*this->broadPhase, frame), collectPairs(bruteForce, frame)) << "tick " << tick;
+    }
+}
+
+TYPED_TEST(BroadPhaseContractTest, RemovedEntitiesNoLongerPair)
+{
+    collectPairs(*this->broadPhase, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                                     makeProxy(1, {1.0f, 0.0f}, {4.0f, 4.0f}),
+                                     makeProxy(2, {2.0f, 0.0f}, {4.0f, 4.0f})});
+
+    auto pairs = collectPairs(*this->broadPhase, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                                                  makeProxy(2, {2.0f, 0.0f}, {4.0f, 4.0f})});
+
+    ASSERT_EQ(pairs.size(), 1u);
+    EXPECT_EQ(pairs[0].entityA, 0u);
+    EXPECT_EQ(pairs[0].entityB, 2u);
+}
+
+TYPED_TEST(BroadPhaseContractTest, ReusedEntityIndexPairsUnderItsNewID)
+{
+    collectPairs(*this->broadPhase, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                                     makeProxy(1, {1.0f, 0.0f}, {4.0f, 4.0f}),
+                                     makeProxy(2, {20.0f, 0.0f}, {4.0f, 4.0f})});
+
+    // Entity 1 was deleted and a new entity given its index, somewhere else
+    EntityID reused = makeEntityID(1, 1);
+    auto pairs = collectPairs(*this->broadPhase, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                                                  makeProxy(reused, {21.0f, 0.0f}, {4.0f, 4.0f}),
+                                                  makeProxy(2, {20.0f, 0.0f}, {4.0f, 4.0f})});
+
+    ASSERT_EQ(pairs.size(), 1u);
+    EXPECT_EQ(pairs[0], makeCollisionPair(2, reused));
+}
+
+TYPED_TEST(BroadPhaseContractTest, EmptyUpdateClearsEverything)
+{
+    collectPairs(*this->broadPhase, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                                     makeProxy(1, {1.0f, 0.0f}, {4.0f, 4.0f})});
+
+    EXPECT_TRUE(collectPairs(*this->broadPhase, {}).empty());
+    EXPECT_TRUE(collectPairs(*this->broadPhase, {makeProxy(1, {1.0f, 0.0f}, {4.0f, 4.0f})}).empty());
+}
+
+TYPED_TEST(BroadPhaseContractTest, CreateEmptyStartsWithoutProxies)
+{
+    collectPairs(*this->broadPhase, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                                     makeProxy(1, {1.0f, 1.0f}, {4.0f, 4.0f})});
+
+    std::unique_ptr<IBroadPhase> copy = this->broadPhase->createEmpty();
+    ASSERT_NE(copy, nullptr);
+    EXPECT_EQ(typeid(*copy), typeid(*this->broadPhase));
+
+    std::vector<CollisionPair> pairs;
+    copy->findPairs(pairs);
+    EXPECT_TRUE(pairs.empty());
+}
+
+// =============================================================================
+// SpatialHashBroadPhase
+// =============================================================================
+
+TEST(SpatialHashBroadPhaseTest, SameCellButNotOverlappingProducesNoPair)
+{
+    SpatialHashBroadPhase grid(100.0f);
+    auto pairs = collectPairs(grid, {makeProxy(0, {10.0f, 10.0f}, {4.0f, 4.0f}),
+                                     makeProxy(1, {50.0f, 50.0f}, {4.0f, 4.0f})});
+
+    EXPECT_TRUE(pairs.empty());
+}
+
+TEST(SpatialHashBroadPhaseTest, PairSpanningManyCellsReportedOnce)
+{
+    // Both proxies cover a 5x5 block of cells, so they share 25 cells
+    SpatialHashBroadPhase grid(1.0f);
+    auto pairs = collectPairs(grid, {makeProxy(3, {0.0f, 0.0f}, {5.0f, 5.0f}),
+                                     makeProxy(7, {0.5f, 0.5f}, {5.0f, 5.0f})});
+
+    ASSERT_EQ(pairs.size(), 1u);
+    EXPECT_EQ(pairs[0].entityA, 3u);
+    EXPECT_EQ(pairs[0].entityB, 7u);
+}
+
+TEST(SpatialHashBroadPhaseTest, HugeProxyKeptOutOfTheGrid)
+{
+    // 1e6 x 1e6 world units at 1-unit cells would be 10^12 cell entries
+    SpatialHashBroadPhase grid(1.0f);
+    auto pairs = collectPairs(grid, {makeProxy(0, {0.0f, 0.0f}, {1.0e6f, 1.0e6f}),
+                                     makeProxy(1, {100.0f, 100.0f}, {2.0f, 2.0f}),
+                                     makeProxy(2, {1.0e6f, 1.0e6f}, {2.0f, 2.0f})});
+
+    EXPECT_EQ(grid.getOversizedCount(), 1u);
+    EXPECT_EQ(grid.getCellEntryCount(), 18u); // 3x3 cells for each small proxy
+    ASSERT_EQ(pairs.size(), 1u);
+    EXPECT_EQ(pairs[0], makeCollisionPair(0, 1));
+}
+
+TEST(SpatialHashBroadPhaseTest, InfiniteAndNaNBoundsAreClamped)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::nanf("");
+
+    SpatialHashBroadPhase grid(16.0f);
+    auto pairs = collectPairs(grid, {{0, {{-inf, -inf}, {inf, inf}}},
+                                     {1, {{nan, nan}, {nan, nan}}},
+                                     {2, {{3.0e38f, -3.0e38f}, {3.0e38f, -3.0e38f}}},
+                                     makeProxy(3, {0.0f, 0.0f}, {4.0f, 4.0f})});
+
+    // The infinite proxy overlaps the finite ones; NaN bounds overlap nothing
+    EXPECT_EQ(grid.getOversizedCount(), 1u);
+    EXPECT_EQ(pairs, (std::vector<CollisionPair>{makeCollisionPair(0, 2), makeCollisionPair(0, 3)}));
+}
+
+TEST(SpatialHashBroadPhaseTest, OversizedProxiesMatchBruteForce)
+{
+    auto proxies = makeRandomProxies(200, 200.0f, 5);
+    proxies.push_back(makeProxy(200, {0.0f, 0.0f}, {300.0f, 300.0f}));
+    proxies.push_back(makeProxy(201, {50.0f, -50.0f}, {500.0f, 80.0f}));
+    proxies.push_back(makeProxy(202, {-100.0f, 20.0f}, {120.0f, 400.0f}));
+
+    SpatialHashBroadPhase grid(8.0f);
+    BruteForceBroadPhase bruteForce;
+    auto gridPairs = collectPairs(grid, proxies);
+
+    EXPECT_GE(grid.getOversizedCount(), 3u);
+    EXPECT_EQ(gridPairs, collectPairs(bruteForce, proxies));
+}
+
+TEST(SpatialHashBroadPhaseTest, CellSizeDoesNotChangeResult)
+{
+    auto proxies = makeRandomProxies(300, 200.0f, 11);
+
+    SpatialHashBroadPhase grid(4.0f);
+    auto smallCells = collectPairs(grid, proxies);
+    grid.setCellSize(256.0f);
+    auto largeCells = collectPairs(grid, proxies);
+
+    EXPECT_FLOAT_EQ(grid.getCellSize(), 256.0f);
+    EXPECT_EQ(smallCells, largeCells);
+}
+
+TEST(SpatialHashBroadPhaseTest, CreateEmptyKeepsCellSize)
+{
+    SpatialHashBroadPhase grid(12.0f);
+    grid.update({makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}), makeProxy(1, {1.0f, 1.0f}, {4.0f, 4.0f})});
+
+    std::unique_ptr<IBroadPhase> copy = grid.createEmpty();
+    auto *copyGrid = dynamic_cast<SpatialHashBroadPhase *>(copy.get());
+    ASSERT_NE(copyGrid, nullptr);
+    EXPECT_FLOAT_EQ(copyGrid->getCellSize(), 12.0f);
+    EXPECT_EQ(copyGrid->getCellEntryCount(), 0u);
+}
+
+TEST(SpatialHashBroadPhaseTest, NonPositiveCellSizeThrows)
+{
+    EXPECT_THROW(SpatialHashBroadPhase(0.0f), std::invalid_argument);
+    EXPECT_THROW(SpatialHashBroadPhase(-8.0f), std::invalid_argument);
+
+    SpatialHashBroadPhase broadPhase(16.0f);
+    EXPECT_THROW(broadPhase.setCellSize(std::nanf("")), std::invalid_argument);
+    EXPECT_THROW(broadPhase.setCellSize(std::numeric_limits<float>::infinity()), std::invalid_argument);
+    EXPECT_FLOAT_EQ(broadPhase.getCellSize(), 16.0f);
+}
+
+// =============================================================================
+// SweepAndPruneBroadPhase
+// =============================================================================
+
+TEST(SweepAndPruneBroadPhaseTest, OverlapOnSweepAxisOnlyProducesNoPair)
+{
+    // Same X range, far apart on Y
+    SweepAndPruneBroadPhase sap(SweepAndPruneBroadPhase::Axis::X);
+    auto pairs = collectPairs(sap, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                                    makeProxy(1, {0.0f, 50.0f}, {4.0f, 4.0f})});
+
+    EXPECT_TRUE(pairs.empty());
+}
+
+TEST(SweepAndPruneBroadPhaseTest, CoherentMotionNeedsFewSwaps)
+{
+    std::vector<BroadPhaseProxy> proxies;
+    for (EntityID e = 0; e < 1000; ++e)
+    {
+        proxies.push_back(makeProxy(e, {static_cast<float>(e) * 16.0f, 0.0f}, {12.0f, 12.0f}));
+    }
+
+    SweepAndPruneBroadPhase sap;
+    collectPairs(sap, proxies);
+
+    // Everything drifts right together: order is unchanged, so no swaps at all
+    for (auto &proxy : proxies)
+    {
+        proxy.aabb.min.x += 1.0f;
+        proxy.aabb.max.x += 1.0f;
+    }
+    collectPairs(sap, proxies);
+    EXPECT_EQ(sap.getLastSwapCount(), 0u);
+
+    // One body overtakes a single neighbour: only its two endpoints move past two others
+    proxies[10].aabb.min.x += 17.0f;
+    proxies[10].aabb.max.x += 17.0f;
+    collectPairs(sap, proxies);
+    EXPECT_LE(sap.getLastSwapCount(), 4u);
+}
+
+// =============================================================================
+// AABBTreeBroadPhase
+// =============================================================================
+
+TEST(AABBTreeBroadPhaseTest, FatOverlapWithoutTightOverlapIsNotReported)
+{
+    // Fat boxes overlap (margin 4), tight boxes are 2 units apart
+    AABBTreeBroadPhase tree(4.0f);
+    auto pairs = collectPairs(tree, {makeProxy(0, {0.0f, 0.0f}, {2.0f, 2.0f}),
+                                     makeProxy(1, {4.0f, 0.0f}, {2.0f, 2.0f})});
+
+    EXPECT_TRUE(pairs.empty());
+}
+
+TEST(AABBTreeBroadPhaseTest, StaticProxiesAreNotReinserted)
+{
+    std::vector<BroadPhaseProxy> proxies;
+    for (EntityID i = 0; i < 100; ++i)
+    {
+        proxies.push_back(makeProxy(i, {static_cast<float>(i % 10) * 5.0f, static_cast<float>(i / 10) * 5.0f}, {6.0f, 6.0f}));
+    }
+
+    AABBTreeBroadPhase tree;
+    auto first = collectPairs(tree, proxies);
+    EXPECT_EQ(tree.getLastMovedCount(), 100u);
+
+    auto second = collectPairs(tree, proxies);
+    EXPECT_EQ(tree.getLastMovedCount(), 0u);
+    EXPECT_EQ(first, second);
+}
+
+TEST(AABBTreeBroadPhaseTest, TreeStaysValidAsProxiesMoveAndDropOut)
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> step(-3.0f, 3.0f);
+    std::vector<BroadPhaseProxy> proxies = makeRandomProxies(300, 150.0f, 5);
+    AABBTreeBroadPhase tree(2.0f);
+
+    for (int tick = 0; tick < 30; ++tick)
+    {
+        std::vector<BroadPhaseProxy> frame;
+        for (BroadPhaseProxy &proxy : proxies)
+        {
+            if (proxy.entity % 3 == 0)
+            {
+                glm::vec2 offset{step(rng), step(rng)};
+                proxy.aabb.min += offset;
+                proxy.aabb.max += offset;
+            }
+            if ((proxy.entity + tick) % 17 != 0)
+                frame.push_back(proxy);
+        }
+
+        collectPairs(tree, frame);
+        ASSERT_TRUE(tree.getTree().validate()) << "tick " << tick;
+        ASSERT_EQ(tree.getTree().getProxyCount(), frame.size());
+    }
+}
+
+TEST(AABBTreeBroadPhaseTest, ReusedEntityIndexReplacesTheStaleProxy)
+{
+    AABBTreeBroadPhase tree(1.0f);
+    collectPairs(tree, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                        makeProxy(1, {1.0f, 0.0f}, {4.0f, 4.0f}),
+                        makeProxy(2, {20.0f, 0.0f}, {4.0f, 4.0f})});
+
+    // Entity 1 was deleted and a new entity given its index, somewhere else
+    EntityID reused = makeEntityID(1, 1);
+    collectPairs(tree, {makeProxy(0, {0.0f, 0.0f}, {4.0f, 4.0f}),
+                        makeProxy(reused, {21.0f, 0.0f}, {4.0f, 4.0f}),
+                        makeProxy(2, {20.0f, 0.0f}, {4.0f, 4.0f})});
+    EXPECT_EQ(tree.getTree().getProxyCount(), 3u);
+
+    std::vector<EntityID> found;
+    tree.queryAABB(makeProxy(0, {1.0f, 0.0f}, {1.0f, 1.0f}).aabb, found);
+    EXPECT_EQ(found, std::vector<EntityID>{0});
+    EXPECT_TRUE(tree.getTree().validate());
+}
+
+TEST(AABBTreeBroadPhaseTest, RegionQueryAndRaycastUseTightBounds)
+{
+    AABBTreeBroadPhase tree(4.0f);
+    tree.update({makeProxy(0, {0.0f, 0.0f}, {2.0f, 2.0f}),
+                 makeProxy(1, {10.0f, 0.0f}, {2.0f, 2.0f}),
+                 makeProxy(2, {20.0f, 0.0f}, {2.0f, 2.0f})});
+
+    std::vector<EntityID> inRegion;
+    tree.queryAABB(makeProxy(0, {10.0f, 0.0f}, {4.0f, 4.0f}).aabb, inRegion);
+    EXPECT_EQ(inRegion, (std::vector<EntityID>{1}));
+
+    std::vector<EntityID> alongRay;
+    tree.raycast({30.0f, 0.0f}, {-40.0f, 0.0f}, alongRay);
+    EXPECT_EQ(alongRay, (std::vector<EntityID>{2, 1, 0}));
+}
+
+// =============================================================================
+// PhysicsManager integration
+// =============================================================================
+
+TEST(BroadPhasePhysicsTest, CircleBoundsUseRadius)
+{
+    // Circle of radius 3 at x=4 overlaps a 2x2 box at the origin; the collider's
+    // default box size (1x1) must not be used to cull this pair
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID box = em.createEntity();
+    em.addComponent(box, ECS::Transform{{0.0f, 0.0f}});
+    ECS::Collider boxCollider;
+    boxCollider.size = {2.0f, 2.0f};
+    em.addComponent(box, boxCollider);
+
+    EntityID circle = em.createEntity();
+    em.addComponent(circle, ECS::Transform{{3.5f, 0.0f}});
+    em.addComponent(circle, ECS::RigidBody{{0.0f, 0.0f}});
+    ECS::Collider circleCollider;
+    circleCollider.type = ECS::ColliderType::Circle;
+    circleCollider.radius = 3.0f;
+    em.addComponent(circle, circleCollider);
+
+    pm.update(0.0f);
+
+    ASSERT_EQ(pm.getCandidatePairs().size(), 1u);
+    EXPECT_GT(em.getComponent<ECS::Transform>(circle).position.x, 3.5f);
+}
+
+TEST(BroadPhasePhysicsTest, BruteForceAndSpatialHashResolveIdentically)
+{
+    auto buildScene = [](EntityManager &em)
+    {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        for (int i = 0; i < 60; ++i)
+        {
+            EntityID e = em.createEntity();
+            em.addComponent(e, ECS::Transform{{position(rng), position(rng)}});
+            em.addComponent(e, ECS::RigidBody{{position(rng), position(rng)}});
+            ECS::Collider c;
+            c.size = {8.0f, 8.0f};
+            em.addComponent(e, c);
+        }
+    };
+
+    EntityManager emGrid;
+    EntityManager emBrute;
+    buildScene(emGrid);
+    buildScene(emBrute);
+
+    PhysicsManager pmGrid(&emGrid);
+    PhysicsManager pmBrute(&emBrute);
+    pmBrute.setBroadPhase(std::make_unique<BruteForceBroadPhase>());
+
+    for (int tick = 0; tick < 30; ++tick)
+    {
+        pmGrid.update(1.0f / 60.0f);
+        pmBrute.update(1.0f / 60.0f);
+        ASSERT_EQ(pmGrid.getCandidatePairs(), pmBrute.getCandidatePairs());
+    }
+
+    for (EntityID e = 0; e < 60; ++e)
+    {
+        EXPECT_FLOAT_EQ(emGrid.getComponent<ECS::Transform>(e).position.x, emBrute.getComponent<ECS::Transform>(e).position.x);
+        EXPECT_FLOAT_EQ(emGrid.getComponent<ECS::Transform>(e).position.y, emBrute.getComponent<ECS::Transform>(e).position.y);
+    }
+}
+
+TEST(BroadPhasePhysicsTest, SetNullBroadPhaseRestoresDefault)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    pm.setBroadPhase(nullptr);
+
+    EXPECT_NE(dynamic_cast<SpatialHashBroadPhase *>(pm.getBroadPhase()), nullptr);
+}
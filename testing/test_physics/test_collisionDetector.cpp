@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "engine/core/ecs/components/Collider.h"
+#include "engine/core/ecs/components/PolygonShape.h"
 #include "engine/core/ecs/components/Transform.h"
 #include "engine/physics/CollisionDetector.h"
 #include "engine/core/ecs/EntityManager.h"
@@ -307,3 +308,149 @@ TEST_F(CollisionTest, BoxBoxWithOffset)
 
     EXPECT_TRUE(cd->checkCollision(a, b).isColliding);
 }
+
+// ---- World AABB cache ----
+
+TEST_F(CollisionTest, WorldAABBsFollowColliderDenseOrder)
+{
+    EntityID box = createBoxEntity({1.0f, 2.0f}, {2.0f, 4.0f}, {2.0f, 1.0f});
+    EntityID circle = createCircleEntity({-3.0f, 0.0f}, 0.5f);
+
+    cd->updateWorldAABBs(em.getComponentPool<ECS::Collider>());
+
+    ASSERT_EQ(cd->getWorldAABBs().size(), 2u);
+    EXPECT_EQ(cd->getWorldAABBEntities()[0], box);
+    EXPECT_EQ(cd->getWorldAABBEntities()[1], circle);
+
+    const Math::AABB &boxAABB = cd->getWorldAABBs()[0];
+    EXPECT_FLOAT_EQ(boxAABB.min.x, -1.0f);
+    EXPECT_FLOAT_EQ(boxAABB.min.y, 0.0f);
+    EXPECT_FLOAT_EQ(boxAABB.max.x, 3.0f);
+    EXPECT_FLOAT_EQ(boxAABB.max.y, 4.0f);
+
+    const Math::AABB &circleAABB = cd->getWorldAABB(circle);
+    EXPECT_FLOAT_EQ(circleAABB.min.x, -3.5f);
+    EXPECT_FLOAT_EQ(circleAABB.max.x, -2.5f);
+    EXPECT_FLOAT_EQ(cd->getWorldCenter(circle).x, -3.0f);
+}
+
+TEST_F(CollisionTest, CachedCollisionMatchesUncached)
+{
+    std::vector<EntityID> entities = {
+        createBoxEntity({0.0f, 0.0f}, {2.0f, 2.0f}),
+        createBoxEntity({1.5f, 0.5f}, {2.0f, 2.0f}, {1.5f, 1.0f}),
+        createCircleEntity({0.5f, 1.5f}, 1.0f),
+        createCircleEntity({-1.0f, -0.5f}, 0.75f),
+        createBoxEntity({0.0f, 0.0f}, {0.5f, 0.5f}),
+    };
+
+    cd->updateWorldAABBs(em.getComponentPool<ECS::Collider>());
+
+    for (EntityID a : entities)
+    {
+        for (EntityID b : entities)
+        {
+            if (a == b)
+                continue;
+
+            auto cached = cd->checkCachedCollision(a, b);
+            auto uncached = cd->checkCollision(a, b);
+            EXPECT_EQ(cached.isColliding, uncached.isColliding);
+            EXPECT_EQ(cached.normal, uncached.normal);
+            EXPECT_EQ(cached.penetration, uncached.penetration);
+        }
+    }
+}
+
+TEST_F(CollisionTest, RefreshWorldAABBFollowsMovedEntity)
+{
+    EntityID a = createBoxEntity({0.0f, 0.0f}, {2.0f, 2.0f});
+    EntityID b = createBoxEntity({5.0f, 0.0f}, {2.0f, 2.0f});
+    cd->updateWorldAABBs(em.getComponentPool<ECS::Collider>());
+    EXPECT_FALSE(cd->checkCachedCollision(a, b).isColliding);
+
+    em.getComponent<ECS::Transform>(b).position = {1.5f, 0.0f};
+    EXPECT_FALSE(cd->checkCachedCollision(a, b).isColliding); // Still the bounds from the last pass
+
+    cd->refreshWorldAABB(b);
+    EXPECT_TRUE(cd->checkCachedCollision(a, b).isColliding);
+    EXPECT_FLOAT_EQ(cd->getWorldAABB(b).min.x, 0.5f);
+}
+
+// ---- Oriented shapes ----
+
+TEST_F(CollisionTest, RotatedBoxBoundsAndWorldPolygon)
+{
+    EntityID box = createBoxEntity({0.0f, 0.0f}, {4.0f, 2.0f});
+    em.getComponent<ECS::Transform>(box).rotation = 90.0f;
+    const auto &collider = em.getComponent<ECS::Collider>(box);
+
+    Math::AABB aabb = cd->getColliderAABB(box, collider);
+    EXPECT_NEAR(aabb.min.x, -1.0f, 1e-5f);
+    EXPECT_NEAR(aabb.max.y, 2.0f, 1e-5f);
+
+    Math::Polygon polygon;
+    EXPECT_TRUE(cd->getWorldPolygon(box, collider, polygon));
+    EXPECT_EQ(polygon.count, 4);
+
+    em.getComponent<ECS::Transform>(box).rotation = 0.0f;
+    EXPECT_FALSE(cd->getWorldPolygon(box, collider, polygon)); // Unrotated boxes keep the AABB path
+}
+
+TEST_F(CollisionTest, RotatedBoxMissesWhereItsBoundsWouldHit)
+{
+    EntityID diamond = createBoxEntity({0.0f, 0.0f}, {2.0f, 2.0f});
+    em.getComponent<ECS::Transform>(diamond).rotation = 45.0f;
+    EntityID box = createBoxEntity({2.0f, 1.1f}, {1.4f, 1.4f});
+    EntityID circle = createCircleEntity({1.2f, 1.2f}, 0.3f);
+
+    EXPECT_FALSE(cd->checkCollision(diamond, box).isColliding);
+    EXPECT_FALSE(cd->checkCollision(diamond, circle).isColliding);
+
+    em.getComponent<ECS::Transform>(box).position = {2.0f, 0.0f};
+    auto result = cd->checkCollision(diamond, box);
+    ASSERT_TRUE(result.isColliding);
+    EXPECT_NEAR(result.normal.x, -1.0f, 1e-5f); // Pushes the diamond away from the box
+    EXPECT_NEAR(result.penetration, std::sqrt(2.0f) - 1.3f, 1e-5f);
+}
+
+TEST_F(CollisionTest, PolygonCircleNormalFlipsWithOrder)
+{
+    EntityID triangle = em.createEntity();
+    em.addComponent<ECS::Transform>(triangle, ECS::Transform{});
+    ECS::Collider c;
+    c.type = ECS::ColliderType::Polygon;
+    glm::vec2 points[] = {{-1.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}};
+    ECS::PolygonShape shape;
+    ASSERT_TRUE(Math::makePolygon(points, 3, shape.polygon));
+    em.addComponent(triangle, shape);
+    em.addComponent<ECS::Collider>(triangle, c);
+    EntityID circle = createCircleEntity({0.0f, -0.4f}, 0.5f);
+
+    auto polygonFirst = cd->checkCollision(triangle, circle);
+    auto circleFirst = cd->checkCollision(circle, triangle);
+    ASSERT_TRUE(polygonFirst.isColliding);
+    EXPECT_NEAR(polygonFirst.normal.y, 1.0f, 1e-6f);
+    EXPECT_NEAR(circleFirst.normal.y, -1.0f, 1e-6f);
+    EXPECT_NEAR(polygonFirst.penetration, 0.1f, 1e-6f);
+
+    cd->updateWorldAABBs(em.getComponentPool<ECS::Collider>());
+    auto cached = cd->checkCachedCollision(triangle, circle);
+    EXPECT_EQ(cached.normal, polygonFirst.normal);
+    EXPECT_EQ(cached.penetration, polygonFirst.penetration);
+}
+
+TEST_F(CollisionTest, PolygonWithoutShapeIsItsBox)
+{
+    EntityID polygon = em.createEntity();
+    em.addComponent<ECS::Transform>(polygon, ECS::Transform{});
+    ECS::Collider c;
+    c.type = ECS::ColliderType::Polygon;
+    c.size = {2.0f, 2.0f};
+    em.addComponent<ECS::Collider>(polygon, c);
+
+    Math::Polygon world;
+    ASSERT_TRUE(cd->getWorldPolygon(polygon, em.getComponent<ECS::Collider>(polygon), world));
+    EXPECT_EQ(world.count, 4);
+    EXPECT_TRUE(cd->checkCollision(polygon, createBoxEntity({1.5f, 0.0f}, {2.0f, 2.0f})).isColliding);
+}
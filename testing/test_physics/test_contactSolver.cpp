@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+
+#include "engine/core/ecs/components/Transform.h"
+#include "engine/core/ecs/components/RigidBody.h"
+#include "engine/core/ecs/components/Collider.h"
+#include "engine/physics/ContactSolver.h"
+#include "engine/physics/PhysicsManager.h"
+#include "engine/core/ecs/EntityManager.h"
+
+class ContactSolverTest : public ::testing::Test
+{
+protected:
+    EntityManager em;
+    std::unique_ptr<ContactSolver> solver;
+
+    void SetUp() override
+    {
+        solver = std::make_unique<ContactSolver>(&em);
+    }
+
+    EntityID createEntity(glm::vec2 position, glm::vec2 velocity, float mass = 1.0f, float restitution = 0.0f)
+    {
+        EntityID e = em.createEntity();
+        ECS::Transform t;
+        t.position = position;
+        em.addComponent<ECS::Transform>(e, t);
+
+        ECS::RigidBody rb;
+        rb.velocity = velocity;
+        rb.mass = mass;
+        rb.restitution = restitution;
+        em.addComponent<ECS::RigidBody>(e, rb);
+
+        return e;
+    }
+
+    EntityID createStaticEntity(glm::vec2 position)
+    {
+        EntityID e = em.createEntity();
+        ECS::Transform t;
+        t.position = position;
+        em.addComponent<ECS::Transform>(e, t);
+        return e;
+    }
+
+    /** Contact between a and b whose normal pushes a away from b, flipped if the pair stores them the other way round. */
+    static Contact makeContact(EntityID a, EntityID b, glm::vec2 normal, float penetration)
+    {
+        Math::CollisionResult result;
+        result.isColliding = true;
+        result.normal = (a < b) ? normal : -normal;
+        result.penetration = penetration;
+        return {makeCollisionPair(a, b), result};
+    }
+};
+
+// =============================================================================
+// Velocity iterations
+// =============================================================================
+
+TEST_F(ContactSolverTest, HeadOnElasticCollisionSwapsVelocities)
+{
+    EntityID a = createEntity({0.0f, 0.0f}, {2.0f, 0.0f}, 1.0f, 1.0f);
+    EntityID b = createEntity({1.0f, 0.0f}, {-2.0f, 0.0f}, 1.0f, 1.0f);
+
+    solver->solve({makeContact(a, b, {-1.0f, 0.0f}, 0.0f)});
+
+    EXPECT_NEAR(em.getComponent<ECS::RigidBody>(a).velocity.x, -2.0f, 1e-4f);
+    EXPECT_NEAR(em.getComponent<ECS::RigidBody>(b).velocity.x, 2.0f, 1e-4f);
+}
+
+TEST_F(ContactSolverTest, SeparatingContactGetsNoImpulse)
+{
+    EntityID a = createEntity({0.0f, 0.0f}, {-1.0f, 0.0f});
+    EntityID b = createEntity({1.0f, 0.0f}, {1.0f, 0.0f});
+
+    solver->solve({makeContact(a, b, {-1.0f, 0.0f}, 0.0f)});
+
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(a).velocity.x, -1.0f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(b).velocity.x, 1.0f);
+    EXPECT_FLOAT_EQ(solver->getCachedImpulse(makeCollisionPair(a, b)), 0.0f);
+}
+
+TEST_F(ContactSolverTest, StaticColliderStopsBodyWithoutRestitution)
+{
+    EntityID wall = createStaticEntity({0.0f, 0.0f});
+    EntityID body = createEntity({1.0f, 0.0f}, {-5.0f, 0.0f});
+
+    // Normal pushes the wall (A) away from the body (B)
+    solver->solve({makeContact(wall, body, {-1.0f, 0.0f}, 0.0f)});
+
+    EXPECT_NEAR(em.getComponent<ECS::RigidBody>(body).velocity.x, 0.0f, 1e-5f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(wall).position.x, 0.0f);
+}
+
+TEST_F(ContactSolverTest, SlowApproachDoesNotBounce)
+{
+    EntityID a = createEntity({0.0f, 0.0f}, {0.25f, 0.0f}, 1.0f, 1.0f);
+    EntityID b = createEntity({1.0f, 0.0f}, {-0.25f, 0.0f}, 1.0f, 1.0f);
+
+    solver->solve({makeContact(a, b, {-1.0f, 0.0f}, 0.0f)});
+
+    // Below the restitution threshold the approach is only cancelled
+    EXPECT_NEAR(em.getComponent<ECS::RigidBody>(a).velocity.x, 0.0f, 1e-5f);
+    EXPECT_NEAR(em.getComponent<ECS::RigidBody>(b).velocity.x, 0.0f, 1e-5f);
+}
+
+TEST_F(ContactSolverTest, KinematicBodyIsNotPushed)
+{
+    EntityID platform = createEntity({0.0f, 0.0f}, {2.0f, 0.0f});
+    em.getComponent<ECS::RigidBody>(platform).type = ECS::BodyType::Kinematic;
+    EntityID crate = createEntity({1.0f, 0.0f}, {0.0f, 0.0f});
+
+    solver->solve({makeContact(platform, crate, {-1.0f, 0.0f}, 0.5f)});
+
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(platform).velocity.x, 2.0f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(platform).position.x, 0.0f);
+    EXPECT_NEAR(em.getComponent<ECS::RigidBody>(crate).velocity.x, 2.0f, 1e-5f);
+    EXPECT_GT(em.getComponent<ECS::Transform>(crate).position.x, 1.45f);
+}
+
+// =============================================================================
+// Position iterations
+// =============================================================================
+
+TEST_F(ContactSolverTest, PositionIterationsRemovePenetrationDownToSlop)
+{
+    EntityID a = createEntity({0.0f, 0.0f}, {0.0f, 0.0f});
+    EntityID b = createEntity({1.0f, 0.0f}, {0.0f, 0.0f});
+
+    solver->solve({makeContact(a, b, {-1.0f, 0.0f}, 0.5f)});
+
+    float moved = em.getComponent<ECS::Transform>(b).position.x - em.getComponent<ECS::Transform>(a).position.x - 1.0f;
+    EXPECT_LE(moved, 0.5f);
+    EXPECT_GE(moved, 0.5f - 2.0f * ContactSolver::DEFAULT_SLOP);
+}
+
+TEST_F(ContactSolverTest, UnequalMassesSplitCorrectionByInverseMass)
+{
+    EntityID light = createEntity({0.0f, 0.0f}, {0.0f, 0.0f}, 1.0f);
+    EntityID heavy = createEntity({1.0f, 0.0f}, {0.0f, 0.0f}, 3.0f);
+
+    solver->setIterations(1, 1);
+    solver->solve({makeContact(light, heavy, {-1.0f, 0.0f}, 1.0f)});
+
+    float lightMoved = -em.getComponent<ECS::Transform>(light).position.x;
+    float heavyMoved = em.getComponent<ECS::Transform>(heavy).position.x - 1.0f;
+    EXPECT_NEAR(lightMoved, 3.0f * heavyMoved, 1e-5f);
+}
+
+TEST_F(ContactSolverTest, IterationsAreClampedToOne)
+{
+    solver->setIterations(0, -3);
+    EXPECT_EQ(solver->getVelocityIterations(), 1);
+    EXPECT_EQ(solver->getPositionIterations(), 1);
+}
+
+// =============================================================================
+// Warm starting
+// =============================================================================
+
+TEST_F(ContactSolverTest, PersistentContactCachesImpulse)
+{
+    EntityID ground = createStaticEntity({0.0f, 1.0f});
+    EntityID box = createEntity({0.0f, 0.0f}, {0.0f, 3.0f});
+
+    solver->solve({makeContact(box, ground, {0.0f, -1.0f}, 0.0f)});
+
+    EXPECT_NEAR(solver->getCachedImpulse(makeCollisionPair(box, ground)), 3.0f, 1e-5f);
+}
+
+TEST_F(ContactSolverTest, WarmStartAppliesCachedImpulseFirst)
+{
+    EntityID ground = createStaticEntity({0.0f, 1.0f});
+    EntityID box = createEntity({0.0f, 0.0f}, {0.0f, 3.0f});
+    Contact contact = makeContact(box, ground, {0.0f, -1.0f}, 0.0f);
+
+    solver->solve({contact});
+
+    // Same push next tick: one iteration has nothing left to do after the warm start
+    em.getComponent<ECS::RigidBody>(box).velocity = {0.0f, 3.0f};
+    solver->setIterations(1, 1);
+    solver->solve({contact});
+
+    EXPECT_NEAR(em.getComponent<ECS::RigidBody>(box).velocity.y, 0.0f, 1e-5f);
+    EXPECT_NEAR(solver->getCachedImpulse(makeCollisionPair(box, ground)), 3.0f, 1e-5f);
+}
+
+TEST_F(ContactSolverTest, DisablingWarmStartDropsCache)
+{
+    EntityID ground = createStaticEntity({0.0f, 1.0f});
+    EntityID box = createEntity({0.0f, 0.0f}, {0.0f, 3.0f});
+
+    solver->solve({makeContact(box, ground, {0.0f, -1.0f}, 0.0f)});
+    solver->setWarmStarting(false);
+
+    EXPECT_FLOAT_EQ(solver->getCachedImpulse(makeCollisionPair(box, ground)), 0.0f);
+}
+
+TEST_F(ContactSolverTest, ContactThatEndsLeavesCache)
+{
+    EntityID ground = createStaticEntity({0.0f, 1.0f});
+    EntityID box = createEntity({0.0f, 0.0f}, {0.0f, 3.0f});
+
+    solver->solve({makeContact(box, ground, {0.0f, -1.0f}, 0.0f)});
+    solver->solve({});
+
+    EXPECT_FLOAT_EQ(solver->getCachedImpulse(makeCollisionPair(box, ground)), 0.0f);
+}
+
+// =============================================================================
+// Stacking through PhysicsManager
+// =============================================================================
+
+namespace
+{
+    /** Run a column of boxes resting on static ground under gravity and return the deepest final overlap. */
+    float settleStack(int boxes, int velocityIterations, bool warmStarting)
+    {
+        EntityManager em;
+        PhysicsManager pm(&em);
+        pm.setSleepParameters(false);
+        pm.getContactSolver().setIterations(velocityIterations, 2);
+        pm.getContactSolver().setWarmStarting(warmStarting);
+
+        EntityID ground = em.createEntity();
+        em.addComponent(ground, ECS::Transform{{0.0f, 1.0f}});
+        ECS::Collider groundCollider;
+        groundCollider.size = {20.0f, 2.0f};
+        em.addComponent(ground, groundCollider);
+
+        std::vector<EntityID> stack;
+        for (int i = 0; i < boxes; ++i)
+        {
+            EntityID e = em.createEntity();
+            em.addComponent(e, ECS::Transform{{0.0f, -0.5f - static_cast<float>(i)}});
+            ECS::RigidBody rb;
+            rb.restitution = 0.0f;
+            em.addComponent(e, rb);
+            em.addComponent(e, ECS::Collider{});
+            stack.push_back(e);
+        }
+
+        const float dt = 1.0f / 60.0f;
+        const glm::vec2 gravity{0.0f, 10.0f};
+        for (int tick = 0; tick < 180; ++tick)
+        {
+            for (EntityID e : stack)
+            {
+                em.getComponent<ECS::RigidBody>(e).velocity += gravity * dt;
+            }
+            pm.update(dt);
+        }
+
+        float deepest = 0.0f;
+        float below = 0.0f; // Top of the ground
+        for (EntityID e : stack)
+        {
+            float bottom = em.getComponent<ECS::Transform>(e).position.y + 0.5f;
+            deepest = std::max(deepest, bottom - below);
+            below = bottom - 1.0f;
+        }
+        return deepest;
+    }
+}
+
+TEST(ContactSolverStackTest, StackRestsOnGround)
+{
+    EXPECT_LT(settleStack(5, ContactSolver::DEFAULT_VELOCITY_ITERATIONS, true), 0.05f);
+}
+
+TEST(ContactSolverStackTest, WarmStartingSettlesStackWithFewIterations)
+{
+    float warm = settleStack(8, 2, true);
+    float cold = settleStack(8, 2, false);
+
+    EXPECT_LT(warm, cold);
+}
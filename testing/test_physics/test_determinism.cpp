@@ -0,0 +1,280 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "engine/core/ecs/components/Transform.h"
+#include "engine/core/ecs/components/RigidBody.h"
+#include "engine/core/ecs/components/Collider.h"
+#include "engine/physics/PhysicsManager.h"
+#include "engine/core/ecs/EntityManager.h"
+
+// =============================================================================
+// Determinism harness
+// =============================================================================
+
+namespace
+{
+    constexpr float TICK = 1.0f / 60.0f;
+    constexpr int PADDLE_PERIOD = 120; ///< Ticks between reversals of the kinematic paddle
+    constexpr int KICK_PERIOD = 50;    ///< Ticks between kicks of one of the dynamic bodies
+
+    /** @brief How components are added, which decides the dense order of every pool. */
+    enum class PoolOrder
+    {
+        Creation, ///< Entity by entity, in creation order
+        Shuffled  ///< Pool by pool in different orders, with removals and re-adds in between
+    };
+
+    struct BodySpec
+    {
+        ECS::Transform transform;
+        ECS::Collider collider;
+        bool hasBody{false};
+        ECS::RigidBody body;
+    };
+
+    /** @brief Values in [lo, hi) from raw mt19937 output; the std distributions differ between standard libraries. */
+    float uniform(std::mt19937 &rng, float lo, float hi)
+    {
+        return lo + (hi - lo) * static_cast<float>(rng() % 10000u) / 10000.0f;
+    }
+
+    /**
+     * @brief An arena of static walls holding boxes and circles on a few layers, a trigger zone,
+     * a continuous bullet and a kinematic paddle (the last spec) that the harness moves back and forth.
+     */
+    std::vector<BodySpec> makeSpecs()
+    {
+        std::vector<BodySpec> specs;
+        std::mt19937 rng(2024);
+
+        auto addWall = [&](glm::vec2 center, glm::vec2 size)
+        {
+            BodySpec spec;
+            spec.transform.position = center;
+            spec.collider.size = size;
+            specs.push_back(spec);
+        };
+        addWall({50.0f, -10.0f}, {140.0f, 20.0f});
+        addWall({50.0f, 110.0f}, {140.0f, 20.0f});
+        addWall({-10.0f, 50.0f}, {20.0f, 140.0f});
+        addWall({110.0f, 50.0f}, {20.0f, 140.0f});
+
+        BodySpec zone;
+        zone.transform.position = {50.0f, 50.0f};
+        zone.collider.size = {20.0f, 20.0f};
+        zone.collider.isTrigger = true;
+        specs.push_back(zone);
+
+        for (int i = 0; i < 40; ++i)
+        {
+            BodySpec spec;
+            spec.transform.position = {uniform(rng, 10.0f, 90.0f), uniform(rng, 20.0f, 90.0f)};
+            if (i % 2 == 0)
+            {
+                spec.collider.type = ECS::ColliderType::Circle;
+                spec.collider.radius = uniform(rng, 1.0f, 2.0f);
+            }
+            else
+            {
+                spec.collider.size = {uniform(rng, 2.0f, 4.0f), uniform(rng, 2.0f, 4.0f)};
+            }
+            if (i % 5 == 0)
+                spec.collider.category = 0x0002;
+            if (i % 7 == 0)
+                spec.collider.mask = ~0x0002u;
+
+            spec.hasBody = true;
+            spec.body.velocity = {uniform(rng, -20.0f, 20.0f), uniform(rng, -20.0f, 20.0f)};
+            spec.body.mass = uniform(rng, 0.5f, 3.0f);
+            spec.body.restitution = uniform(rng, 0.2f, 0.9f);
+            specs.push_back(spec);
+        }
+
+        BodySpec bullet;
+        bullet.transform.position = {20.0f, 15.0f};
+        bullet.collider.type = ECS::ColliderType::Circle;
+        bullet.collider.radius = 0.5f;
+        bullet.hasBody = true;
+        bullet.body.velocity = {300.0f, 170.0f};
+        bullet.body.restitution = 1.0f;
+        bullet.body.continuous = true;
+        specs.push_back(bullet);
+
+        BodySpec paddle;
+        paddle.transform.position = {30.0f, 30.0f};
+        paddle.collider.size = {12.0f, 2.0f};
+        paddle.hasBody = true;
+        paddle.body.type = ECS::BodyType::Kinematic;
+        paddle.body.velocity = {20.0f, 0.0f};
+        specs.push_back(paddle);
+
+        return specs;
+    }
+
+    /** @brief Create one entity per spec, IDs in spec order, and add their components in @p order. */
+    std::vector<EntityID> buildScene(EntityManager &em, const std::vector<BodySpec> &specs, PoolOrder order)
+    {
+        std::vector<EntityID> entities;
+        for (size_t i = 0; i < specs.size(); ++i)
+        {
+            entities.push_back(em.createEntity());
+        }
+
+        if (order == PoolOrder::Creation)
+        {
+            for (size_t i = 0; i < specs.size(); ++i)
+            {
+                em.addComponent(entities[i], specs[i].transform);
+                em.addComponent(entities[i], specs[i].collider);
+                if (specs[i].hasBody)
+                    em.addComponent(entities[i], specs[i].body);
+            }
+            return entities;
+        }
+
+        std::vector<size_t> indices(specs.size());
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            indices[i] = i;
+        }
+
+        std::reverse(indices.begin(), indices.end());
+        for (size_t i : indices)
+        {
+            em.addComponent(entities[i], specs[i].transform);
+        }
+
+        std::shuffle(indices.begin(), indices.end(), std::mt19937(99));
+        for (size_t i : indices)
+        {
+            em.addComponent(entities[i], specs[i].collider);
+            if (specs[i].hasBody)
+                em.addComponent(entities[i], specs[i].body);
+        }
+
+        // Swap-and-pop churn: every third body leaves the pool and comes back at its end
+        auto &bodies = em.getComponentPool<ECS::RigidBody>();
+        for (size_t i = 0; i < specs.size(); i += 3)
+        {
+            if (!specs[i].hasBody)
+                continue;
+            bodies.remove(entities[i]);
+            em.addComponent(entities[i], specs[i].body);
+        }
+        return entities;
+    }
+
+    /** @brief Set a new velocity on one of the dynamic bodies, picked and aimed from the tick number alone. */
+    void kick(EntityManager &em, PhysicsManager &pm, const std::vector<EntityID> &entities, int tick)
+    {
+        constexpr size_t FIRST_DYNAMIC = 5; // After the four walls and the trigger zone
+        constexpr size_t DYNAMIC_COUNT = 40;
+
+        int kickIndex = tick / KICK_PERIOD;
+        EntityID entity = entities[FIRST_DYNAMIC + static_cast<size_t>(kickIndex * 7) % DYNAMIC_COUNT];
+        float x = (kickIndex % 2 ? 1.0f : -1.0f) * 25.0f;
+        float y = (kickIndex % 3 ? 1.0f : -1.0f) * 25.0f;
+        em.getComponent<ECS::RigidBody>(entity).velocity = {x, y};
+        pm.wakeBody(entity);
+    }
+
+    /** @brief Run @p ticks updates of the arena and return the state checksum after each one. */
+    std::vector<uint64_t> runArena(PoolOrder order, size_t threads, int ticks)
+    {
+        EntityManager em;
+        PhysicsManager pm(&em);
+        pm.setThreadCount(threads);
+
+        std::vector<BodySpec> specs = makeSpecs();
+        std::vector<EntityID> entities = buildScene(em, specs, order);
+        EntityID paddle = entities.back();
+
+        std::vector<uint64_t> checksums;
+        checksums.reserve(ticks);
+        for (int tick = 0; tick < ticks; ++tick)
+        {
+            if (tick % PADDLE_PERIOD == 0 && tick > 0)
+                em.getComponent<ECS::RigidBody>(paddle).velocity.x *= -1.0f;
+
+            // Stand-in for player input, so the arena never settles for good
+            if (tick % KICK_PERIOD == 0)
+                kick(em, pm, entities, tick);
+
+            pm.update(TICK);
+            checksums.push_back(pm.getStateChecksum());
+        }
+        return checksums;
+    }
+
+    /** @brief First tick at which the two runs disagree, or -1. */
+    long firstDivergence(const std::vector<uint64_t> &a, const std::vector<uint64_t> &b)
+    {
+        auto mismatch = std::mismatch(a.begin(), a.end(), b.begin(), b.end());
+        return mismatch.first == a.end() && mismatch.second == b.end() ? -1 : static_cast<long>(mismatch.first - a.begin());
+    }
+}
+
+TEST(PhysicsDeterminismTest, ChecksumsMatchOver100kTicksAcrossPoolOrderAndThreads)
+{
+    constexpr int TICKS = 100000;
+
+    std::vector<uint64_t> reference = runArena(PoolOrder::Creation, 1, TICKS);
+    std::vector<uint64_t> shuffled = runArena(PoolOrder::Shuffled, 4, TICKS);
+
+    EXPECT_EQ(firstDivergence(reference, shuffled), -1);
+
+    // Guard against a harness that proves nothing because the arena came to rest
+    EXPECT_NE(reference[TICKS - 2], reference[TICKS - 1]);
+}
+
+TEST(PhysicsDeterminismTest, SubstepsMatchSmallerUpdates)
+{
+    std::vector<BodySpec> specs = makeSpecs();
+
+    EntityManager emSubstepped;
+    PhysicsManager pmSubstepped(&emSubstepped);
+    pmSubstepped.setSubsteps(4);
+    buildScene(emSubstepped, specs, PoolOrder::Creation);
+
+    EntityManager emSplit;
+    PhysicsManager pmSplit(&emSplit);
+    buildScene(emSplit, specs, PoolOrder::Creation);
+
+    for (int tick = 0; tick < 600; ++tick)
+    {
+        pmSubstepped.update(TICK);
+        for (int substep = 0; substep < 4; ++substep)
+        {
+            pmSplit.update(TICK / 4.0f);
+        }
+        ASSERT_EQ(pmSubstepped.getStateChecksum(), pmSplit.getStateChecksum()) << "tick " << tick;
+    }
+}
+
+TEST(PhysicsDeterminismTest, SubstepsBelowOneAreRaised)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    pm.setSubsteps(0);
+    EXPECT_EQ(pm.getSubsteps(), 1);
+}
+
+TEST(PhysicsDeterminismTest, ChecksumSeesOneUlpChange)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    std::vector<EntityID> entities = buildScene(em, makeSpecs(), PoolOrder::Creation);
+    pm.update(TICK);
+
+    uint64_t before = pm.getStateChecksum();
+    float &x = em.getComponent<ECS::Transform>(entities.back()).position.x;
+    x = std::nextafter(x, INFINITY);
+
+    EXPECT_NE(pm.getStateChecksum(), before);
+}
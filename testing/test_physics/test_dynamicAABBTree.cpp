@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "engine/physics/broadphase/DynamicAABBTree.h"
+
+namespace
+{
+    Math::AABB makeBox(glm::vec2 center, glm::vec2 size)
+    {
+        return {center - size * 0.5f, center + size * 0.5f};
+    }
+
+    std::vector<EntityID> queryEntities(const DynamicAABBTree &tree, const Math::AABB &region)
+    {
+        std::vector<EntityID> found;
+        tree.query(region, [&](int32_t proxyId)
+                   {
+            found.push_back(tree.getEntity(proxyId));
+            return true; });
+        std::sort(found.begin(), found.end());
+        return found;
+    }
+}
+
+TEST(DynamicAABBTreeTest, EmptyTreeIsValid)
+{
+    DynamicAABBTree tree;
+    EXPECT_EQ(tree.getRoot(), DynamicAABBTree::NULL_NODE);
+    EXPECT_EQ(tree.getHeight(), 0);
+    EXPECT_TRUE(tree.validate());
+    EXPECT_TRUE(queryEntities(tree, makeBox({0.0f, 0.0f}, {100.0f, 100.0f})).empty());
+}
+
+TEST(DynamicAABBTreeTest, FatAABBAddsMargin)
+{
+    DynamicAABBTree tree(2.0f);
+    int32_t proxy = tree.createProxy(makeBox({0.0f, 0.0f}, {4.0f, 4.0f}), 7);
+
+    const Math::AABB &fat = tree.getFatAABB(proxy);
+    EXPECT_FLOAT_EQ(fat.min.x, -4.0f);
+    EXPECT_FLOAT_EQ(fat.max.y, 4.0f);
+    EXPECT_EQ(tree.getEntity(proxy), 7u);
+}
+
+TEST(DynamicAABBTreeTest, QueryFindsOnlyOverlappingLeaves)
+{
+    DynamicAABBTree tree(0.0f);
+    tree.createProxy(makeBox({0.0f, 0.0f}, {2.0f, 2.0f}), 0);
+    tree.createProxy(makeBox({10.0f, 0.0f}, {2.0f, 2.0f}), 1);
+    tree.createProxy(makeBox({20.0f, 0.0f}, {2.0f, 2.0f}), 2);
+
+    auto found = queryEntities(tree, makeBox({5.0f, 0.0f}, {12.0f, 1.0f}));
+    EXPECT_EQ(found, (std::vector<EntityID>{0, 1}));
+}
+
+TEST(DynamicAABBTreeTest, DestroyRemovesLeaf)
+{
+    DynamicAABBTree tree(0.0f);
+    int32_t a = tree.createProxy(makeBox({0.0f, 0.0f}, {2.0f, 2.0f}), 0);
+    tree.createProxy(makeBox({1.0f, 0.0f}, {2.0f, 2.0f}), 1);
+
+    tree.destroyProxy(a);
+
+    EXPECT_EQ(tree.getProxyCount(), 1u);
+    EXPECT_TRUE(tree.validate());
+    EXPECT_EQ(queryEntities(tree, makeBox({0.0f, 0.0f}, {4.0f, 4.0f})), (std::vector<EntityID>{1}));
+}
+
+TEST(DynamicAABBTreeTest, SmallMoveStaysInsideFatAABB)
+{
+    DynamicAABBTree tree(2.0f);
+    int32_t proxy = tree.createProxy(makeBox({0.0f, 0.0f}, {4.0f, 4.0f}), 0);
+
+    EXPECT_FALSE(tree.moveProxy(proxy, makeBox({1.5f, -1.5f}, {4.0f, 4.0f})));
+    EXPECT_TRUE(tree.moveProxy(proxy, makeBox({3.0f, 0.0f}, {4.0f, 4.0f})));
+    EXPECT_FLOAT_EQ(tree.getFatAABB(proxy).min.x, -1.0f);
+    EXPECT_TRUE(tree.validate());
+}
+
+TEST(DynamicAABBTreeTest, StaysBalancedForSortedInsertion)
+{
+    // Inserting along a line is the worst case for an unbalanced tree
+    DynamicAABBTree tree(0.0f);
+    for (EntityID i = 0; i < 1024; ++i)
+    {
+        tree.createProxy(makeBox({static_cast<float>(i) * 3.0f, 0.0f}, {2.0f, 2.0f}), i);
+    }
+
+    EXPECT_TRUE(tree.validate());
+    EXPECT_LE(tree.getHeight(), 20);
+}
+
+TEST(DynamicAABBTreeTest, RaycastVisitsLeavesAlongSegment)
+{
+    DynamicAABBTree tree(0.0f);
+    tree.createProxy(makeBox({10.0f, 0.0f}, {2.0f, 2.0f}), 0);
+    tree.createProxy(makeBox({20.0f, 0.0f}, {2.0f, 2.0f}), 1);
+    tree.createProxy(makeBox({15.0f, 10.0f}, {2.0f, 2.0f}), 2);
+
+    std::vector<EntityID> hit;
+    tree.raycast({0.0f, 0.0f}, {30.0f, 0.0f}, 1.0f, [&](int32_t proxyId, float maxFraction)
+                 {
+        hit.push_back(tree.getEntity(proxyId));
+        return maxFraction; });
+    std::sort(hit.begin(), hit.end());
+
+    EXPECT_EQ(hit, (std::vector<EntityID>{0, 1}));
+}
+
+TEST(DynamicAABBTreeTest, RaycastClippingSkipsFartherLeaves)
+{
+    DynamicAABBTree tree(0.0f);
+    tree.createProxy(makeBox({10.0f, 0.0f}, {2.0f, 2.0f}), 0);
+    tree.createProxy(makeBox({20.0f, 0.0f}, {2.0f, 2.0f}), 1);
+
+    // Closest-hit query: clip the ray at each hit
+    float closest = 1.0f;
+    EntityID closestEntity = 99;
+    glm::vec2 origin{0.0f, 0.0f};
+    glm::vec2 delta{30.0f, 0.0f};
+    tree.raycast(origin, delta, 1.0f, [&](int32_t proxyId, float maxFraction)
+                 {
+        float fraction = 0.0f;
+        if (Math::raycastAABB(origin, delta, tree.getFatAABB(proxyId), maxFraction, fraction) && fraction < closest)
+        {
+            closest = fraction;
+            closestEntity = tree.getEntity(proxyId);
+        }
+        return closest; });
+
+    EXPECT_EQ(closestEntity, 0u);
+    EXPECT_NEAR(closest, 9.0f / 30.0f, 1e-5f);
+}
+
+TEST(DynamicAABBTreeTest, NearestPrunesBeyondShrinkingBound)
+{
+    DynamicAABBTree tree(0.0f);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+    std::vector<Math::AABB> boxes;
+    for (EntityID e = 0; e < 200; ++e)
+    {
+        boxes.push_back(makeBox({coord(rng), coord(rng)}, {1.0f, 1.0f}));
+        tree.createProxy(boxes.back(), e);
+    }
+
+    // Closest leaf: shrink the bound to each better distance
+    glm::vec2 point{3.0f, -7.0f};
+    float closest = INFINITY;
+    EntityID closestEntity = 999;
+    size_t visited = 0;
+    tree.nearest(point, INFINITY, [&](int32_t proxyId, float maxDistance)
+                 {
+        // The bound handed over is the best distance returned so far, and only leaves within it are visited
+        EXPECT_EQ(maxDistance, closest);
+        ++visited;
+        float distance = Math::distanceToAABB(point, tree.getFatAABB(proxyId));
+        EXPECT_LE(distance, maxDistance);
+        if (distance < closest)
+        {
+            closest = distance;
+            closestEntity = tree.getEntity(proxyId);
+        }
+        return closest; });
+
+    EntityID expected = 0;
+    for (EntityID e = 1; e < boxes.size(); ++e)
+    {
+        if (Math::distanceToAABB(point, boxes[e]) < Math::distanceToAABB(point, boxes[expected]))
+            expected = e;
+    }
+    EXPECT_EQ(closestEntity, expected);
+    EXPECT_LT(visited, boxes.size() / 4);
+}
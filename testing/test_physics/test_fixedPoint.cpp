@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include "engine/physics/FixedPoint.h"
+#include "engine/physics/Math.h"
+#include "engine/core/ecs/components/Transform.h"
+#include "engine/core/ecs/components/RigidBody.h"
+
+using Fixed = Fixed16_16;
+using FixedVec = Math::Vec2<Fixed>;
+
+// =============================================================================
+// Arithmetic
+// =============================================================================
+
+TEST(FixedPointTest, IntegersAreExact)
+{
+    EXPECT_EQ(Fixed(3).raw(), 3 * 65536);
+    EXPECT_EQ(Fixed(-2).raw(), -2 * 65536);
+    EXPECT_EQ(static_cast<float>(Fixed(7) + Fixed(5)), 12.0f);
+    EXPECT_EQ(static_cast<float>(Fixed(7) - Fixed(9)), -2.0f);
+}
+
+TEST(FixedPointTest, FloatConversionRoundsToNearest)
+{
+    EXPECT_EQ(Fixed(0.5f).raw(), 32768);
+    EXPECT_EQ(Fixed(1.0f / 131072.0f).raw(), 1);   // Half an epsilon rounds away from zero
+    EXPECT_EQ(Fixed(-1.0f / 131072.0f).raw(), -1);
+    EXPECT_EQ(Fixed(1.0f / 262144.0f).raw(), 0);   // A quarter rounds to zero
+}
+
+TEST(FixedPointTest, MultiplyAndDivide)
+{
+    EXPECT_EQ(Fixed(1.5f) * Fixed(2.5f), Fixed(3.75f));
+    EXPECT_EQ(Fixed(-1.5f) * Fixed(2), Fixed(-3));
+    EXPECT_EQ(Fixed(-1.5f) * Fixed(-1.5f), Fixed(2.25f));
+    EXPECT_EQ(Fixed(3) / Fixed(4), Fixed(0.75f));
+    EXPECT_EQ(Fixed(-3) / Fixed(4), Fixed(-0.75f));
+}
+
+TEST(FixedPointTest, ProductRoundsTowardNegativeInfinity)
+{
+    Fixed tiny = Fixed::epsilon();
+    Fixed half(0.5f);
+
+    EXPECT_EQ((tiny * half).raw(), 0);
+    EXPECT_EQ((-tiny * half).raw(), -1);
+}
+
+TEST(FixedPointTest, AdditionWrapsOnOverflow)
+{
+    EXPECT_EQ(Fixed::max() + Fixed::epsilon(), Fixed::lowest());
+    EXPECT_EQ(Fixed::lowest() - Fixed::epsilon(), Fixed::max());
+}
+
+TEST(FixedPointTest, SqrtOfSquaresIsExact)
+{
+    EXPECT_EQ(sqrt(Fixed(9)), Fixed(3));
+    EXPECT_EQ(sqrt(Fixed(0.25f)), Fixed(0.5f));
+    EXPECT_EQ(sqrt(Fixed(0)), Fixed(0));
+    EXPECT_EQ(sqrt(Fixed(-4)), Fixed(0));
+    EXPECT_NEAR(static_cast<float>(sqrt(Fixed(2))), 1.41421356f, 1.0f / 65536.0f);
+}
+
+TEST(FixedPointTest, ComparisonsAndAbs)
+{
+    EXPECT_LT(Fixed(-1), Fixed(0.5f));
+    EXPECT_GE(Fixed(2), Fixed(2));
+    EXPECT_EQ(abs(Fixed(-2.5f)), Fixed(2.5f));
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(FixedPointTest, Fixed32_32KeepsPrecisionAndRange)
+{
+    EXPECT_EQ(Fixed32_32(1.0 / 4294967296.0).raw(), 1);
+    EXPECT_EQ(Fixed32_32(100000) * Fixed32_32(10000), Fixed32_32(1000000000));
+    EXPECT_NEAR(static_cast<double>(sqrt(Fixed32_32(2))), 1.4142135623730951, 1e-9);
+}
+#endif
+
+// =============================================================================
+// Math.h on fixed point
+// =============================================================================
+
+TEST(FixedPointMathTest, AABBOverlapMatchesFloat)
+{
+    Math::BasicAABB<Fixed> a{{Fixed(-1), Fixed(-1)}, {Fixed(1), Fixed(1)}};
+    Math::BasicAABB<Fixed> b{{Fixed(0.5f), Fixed(-1)}, {Fixed(2.5f), Fixed(1)}};
+
+    auto result = Math::resolveAABBCollision(a, b);
+    ASSERT_TRUE(result.isColliding);
+    EXPECT_EQ(result.normal, FixedVec(Fixed(-1), Fixed(0)));
+    EXPECT_EQ(result.penetration, Fixed(0.5f));
+}
+
+TEST(FixedPointMathTest, CircleResolutionCloseToFloat)
+{
+    auto fixedResult = Math::resolveCircleCollision(FixedVec(Fixed(0), Fixed(0)), Fixed(1),
+                                                    FixedVec(Fixed(1.2f), Fixed(0.9f)), Fixed(1));
+    auto floatResult = Math::resolveCircleCollision(glm::vec2(0.0f, 0.0f), 1.0f, glm::vec2(1.2f, 0.9f), 1.0f);
+
+    ASSERT_TRUE(fixedResult.isColliding);
+    ASSERT_TRUE(floatResult.isColliding);
+    EXPECT_NEAR(static_cast<float>(fixedResult.penetration), floatResult.penetration, 1e-4f);
+    EXPECT_NEAR(static_cast<float>(fixedResult.normal.x), floatResult.normal.x, 1e-4f);
+    EXPECT_NEAR(static_cast<float>(fixedResult.normal.y), floatResult.normal.y, 1e-4f);
+}
+
+TEST(FixedPointMathTest, AABBCircleResolutionCloseToFloat)
+{
+    Math::BasicAABB<Fixed> box{{Fixed(0), Fixed(0)}, {Fixed(4), Fixed(2)}};
+    auto fixedResult = Math::resolveAABBCircleCollision(box, FixedVec(Fixed(4.5f), Fixed(2.5f)), Fixed(1));
+    auto floatResult = Math::resolveAABBCircleCollision(Math::AABB{{0.0f, 0.0f}, {4.0f, 2.0f}}, glm::vec2(4.5f, 2.5f), 1.0f);
+
+    ASSERT_TRUE(fixedResult.isColliding);
+    EXPECT_NEAR(static_cast<float>(fixedResult.penetration), floatResult.penetration, 1e-4f);
+}
+
+TEST(FixedPointMathTest, SweepCircleFindsTimeOfImpact)
+{
+    Fixed fraction;
+    FixedVec normal;
+    bool hit = Math::sweepCircle(FixedVec(Fixed(0), Fixed(0)), Fixed(1), FixedVec(Fixed(10), Fixed(0)),
+                                 FixedVec(Fixed(6), Fixed(0)), Fixed(1), fraction, normal);
+
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(static_cast<float>(fraction), 0.4f, 1e-4f);
+    EXPECT_NEAR(static_cast<float>(normal.x), -1.0f, 1e-4f);
+    EXPECT_EQ(normal.y, Fixed(0));
+}
+
+TEST(FixedPointMathTest, RaycastAABBFindsEntry)
+{
+    Math::BasicAABB<Fixed> box{{Fixed(2), Fixed(-1)}, {Fixed(4), Fixed(1)}};
+    Fixed fraction;
+
+    ASSERT_TRUE(Math::raycastAABB(FixedVec(Fixed(0), Fixed(0)), FixedVec(Fixed(8), Fixed(0)), box, Fixed(1), fraction));
+    EXPECT_EQ(fraction, Fixed(0.25f));
+}
+
+TEST(FixedPointMathTest, ComponentsDefaultLikeFloat)
+{
+    ECS::BasicTransform<Fixed> transform;
+    ECS::BasicRigidBody<Fixed> body;
+
+    EXPECT_EQ(transform.scale, FixedVec(Fixed(1), Fixed(1)));
+    EXPECT_EQ(body.mass, Fixed(1));
+    EXPECT_EQ(body.restitution, Fixed(0.5f));
+    EXPECT_TRUE(body.awake);
+}
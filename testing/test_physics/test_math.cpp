@@ -212,3 +212,149 @@ TEST(MathResolveAABBCircle, CircleCenterInsideNearLeftEdge)
     EXPECT_FLOAT_EQ(result.normal.x, -1.0f);
     EXPECT_FLOAT_EQ(result.normal.y, 0.0f);
 }
+
+// =============================================================================
+// sweepAABB
+// =============================================================================
+
+TEST(MathSweepAABB, HitsThinWallAtTimeOfImpact)
+{
+    Math::AABB box{{-1.0f, -1.0f}, {1.0f, 1.0f}};
+    Math::AABB wall{{9.0f, -5.0f}, {9.5f, 5.0f}};
+    float fraction = -1.0f;
+    glm::vec2 normal;
+
+    ASSERT_TRUE(Math::sweepAABB(box, {20.0f, 0.0f}, wall, fraction, normal));
+    EXPECT_FLOAT_EQ(fraction, 0.4f); // Right edge travels 8 of 20
+    EXPECT_FLOAT_EQ(normal.x, -1.0f);
+    EXPECT_FLOAT_EQ(normal.y, 0.0f);
+}
+
+TEST(MathSweepAABB, MissWhenPathPassesBeside)
+{
+    Math::AABB box{{-1.0f, -1.0f}, {1.0f, 1.0f}};
+    Math::AABB target{{5.0f, 3.0f}, {6.0f, 4.0f}};
+    float fraction = -1.0f;
+    glm::vec2 normal;
+
+    EXPECT_FALSE(Math::sweepAABB(box, {20.0f, 0.0f}, target, fraction, normal));
+}
+
+TEST(MathSweepAABB, MissWhenOutOfReach)
+{
+    Math::AABB box{{-1.0f, -1.0f}, {1.0f, 1.0f}};
+    Math::AABB target{{30.0f, -1.0f}, {31.0f, 1.0f}};
+    float fraction = -1.0f;
+    glm::vec2 normal;
+
+    EXPECT_FALSE(Math::sweepAABB(box, {20.0f, 0.0f}, target, fraction, normal));
+}
+
+TEST(MathSweepAABB, OverlappingAtStartIsNotReported)
+{
+    Math::AABB box{{-1.0f, -1.0f}, {1.0f, 1.0f}};
+    Math::AABB target{{0.5f, -1.0f}, {2.0f, 1.0f}};
+    float fraction = -1.0f;
+    glm::vec2 normal;
+
+    EXPECT_FALSE(Math::sweepAABB(box, {5.0f, 0.0f}, target, fraction, normal));
+}
+
+TEST(MathSweepAABB, TouchingAndMovingInHitsAtZero)
+{
+    Math::AABB box{{-1.0f, 0.0f}, {1.0f, 2.0f}};
+    Math::AABB floor{{-5.0f, 2.0f}, {5.0f, 3.0f}};
+    float fraction = -1.0f;
+    glm::vec2 normal;
+
+    ASSERT_TRUE(Math::sweepAABB(box, {0.0f, 1.0f}, floor, fraction, normal));
+    EXPECT_FLOAT_EQ(fraction, 0.0f);
+    EXPECT_FLOAT_EQ(normal.y, -1.0f);
+}
+
+TEST(MathSweepAABB, TouchingAndMovingAwayIsNotReported)
+{
+    Math::AABB box{{-1.0f, 0.0f}, {1.0f, 2.0f}};
+    Math::AABB floor{{-5.0f, 2.0f}, {5.0f, 3.0f}};
+    float fraction = -1.0f;
+    glm::vec2 normal;
+
+    EXPECT_FALSE(Math::sweepAABB(box, {0.0f, -1.0f}, floor, fraction, normal));
+}
+
+// =============================================================================
+// sweepCircle
+// =============================================================================
+
+TEST(MathSweepCircle, HeadOnTimeOfImpact)
+{
+    float fraction = -1.0f;
+    glm::vec2 normal;
+
+    ASSERT_TRUE(Math::sweepCircle({0.0f, 0.0f}, 1.0f, {10.0f, 0.0f}, {6.0f, 0.0f}, 1.0f, fraction, normal));
+    EXPECT_FLOAT_EQ(fraction, 0.4f);
+    EXPECT_FLOAT_EQ(normal.x, -1.0f);
+    EXPECT_NEAR(normal.y, 0.0f, 1e-6f);
+}
+
+TEST(MathSweepCircle, MissWhenPassingBeside)
+{
+    float fraction = -1.0f;
+    glm::vec2 normal;
+
+    EXPECT_FALSE(Math::sweepCircle({0.0f, 0.0f}, 1.0f, {10.0f, 0.0f}, {5.0f, 3.0f}, 1.0f, fraction, normal));
+}
+
+TEST(MathSweepCircle, MovingAwayIsNotReported)
+{
+    float fraction = -1.0f;
+    glm::vec2 normal;
+
+    EXPECT_FALSE(Math::sweepCircle({0.0f, 0.0f}, 1.0f, {-10.0f, 0.0f}, {3.0f, 0.0f}, 1.0f, fraction, normal));
+}
+
+TEST(MathSweepCircle, OverlappingAtStartIsNotReported)
+{
+    float fraction = -1.0f;
+    glm::vec2 normal;
+
+    EXPECT_FALSE(Math::sweepCircle({0.0f, 0.0f}, 1.0f, {10.0f, 0.0f}, {1.0f, 0.0f}, 1.0f, fraction, normal));
+}
+
+// =============================================================================
+// raycastCircle / distanceToAABB
+// =============================================================================
+
+TEST(MathRaycastCircle, HitsNearSide)
+{
+    float fraction = -1.0f;
+
+    ASSERT_TRUE(Math::raycastCircle({0.0f, 0.0f}, {10.0f, 0.0f}, {6.0f, 0.0f}, 1.0f, 1.0f, fraction));
+    EXPECT_FLOAT_EQ(fraction, 0.5f);
+}
+
+TEST(MathRaycastCircle, OriginInsideHitsAtZero)
+{
+    float fraction = -1.0f;
+
+    ASSERT_TRUE(Math::raycastCircle({6.5f, 0.0f}, {10.0f, 0.0f}, {6.0f, 0.0f}, 1.0f, 1.0f, fraction));
+    EXPECT_FLOAT_EQ(fraction, 0.0f);
+}
+
+TEST(MathRaycastCircle, MissWhenPassingBesideOrOutOfReach)
+{
+    float fraction = -1.0f;
+
+    EXPECT_FALSE(Math::raycastCircle({0.0f, 2.0f}, {10.0f, 0.0f}, {6.0f, 0.0f}, 1.0f, 1.0f, fraction));
+    EXPECT_FALSE(Math::raycastCircle({0.0f, 0.0f}, {10.0f, 0.0f}, {6.0f, 0.0f}, 1.0f, 0.4f, fraction));
+    EXPECT_FALSE(Math::raycastCircle({0.0f, 0.0f}, {-10.0f, 0.0f}, {6.0f, 0.0f}, 1.0f, 1.0f, fraction));
+}
+
+TEST(MathDistanceToAABB, ZeroInsideAndEuclideanOutside)
+{
+    Math::AABB box{{0.0f, 0.0f}, {2.0f, 2.0f}};
+
+    EXPECT_FLOAT_EQ(Math::distanceToAABB({1.0f, 1.0f}, box), 0.0f);
+    EXPECT_FLOAT_EQ(Math::distanceToAABB({5.0f, 1.0f}, box), 3.0f);
+    EXPECT_FLOAT_EQ(Math::distanceToAABB({5.0f, 6.0f}, box), 5.0f);
+}
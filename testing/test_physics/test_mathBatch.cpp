@@ -0,0 +1,310 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "engine/physics/MathBatch.h"
+
+namespace
+{
+    // Bit-for-bit comparison, so signed zeros and rounding differences are caught
+    void expectSameBits(const Math::CollisionResult &batch, const Math::CollisionResult &scalar, size_t index)
+    {
+        EXPECT_EQ(batch.isColliding, scalar.isColliding) << "candidate " << index;
+        EXPECT_EQ(std::memcmp(&batch.normal.x, &scalar.normal.x, sizeof(float)), 0) << "candidate " << index << " normal.x";
+        EXPECT_EQ(std::memcmp(&batch.normal.y, &scalar.normal.y, sizeof(float)), 0) << "candidate " << index << " normal.y";
+        EXPECT_EQ(std::memcmp(&batch.penetration, &scalar.penetration, sizeof(float)), 0) << "candidate " << index << " penetration";
+    }
+
+    struct Boxes
+    {
+        std::vector<float> minX, minY, maxX, maxY;
+
+        void add(const Math::AABB &aabb)
+        {
+            minX.push_back(aabb.min.x);
+            minY.push_back(aabb.min.y);
+            maxX.push_back(aabb.max.x);
+            maxY.push_back(aabb.max.y);
+        }
+        Math::AABB get(size_t i) const { return {{minX[i], minY[i]}, {maxX[i], maxY[i]}}; }
+        Math::AABBSoA soa() const { return {minX.data(), minY.data(), maxX.data(), maxY.data()}; }
+        size_t size() const { return minX.size(); }
+    };
+
+    struct Circles
+    {
+        std::vector<float> x, y, radius;
+
+        void add(glm::vec2 center, float r)
+        {
+            x.push_back(center.x);
+            y.push_back(center.y);
+            radius.push_back(r);
+        }
+        Math::CircleSoA soa() const { return {x.data(), y.data(), radius.data()}; }
+        size_t size() const { return x.size(); }
+    };
+
+    // 37 candidates: not a multiple of 4 or 8, so the scalar tail runs too
+    constexpr size_t RANDOM_COUNT = 37;
+
+    Boxes randomBoxes(std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> position(-4.0f, 4.0f);
+        std::uniform_real_distribution<float> size(0.1f, 3.0f);
+        Boxes boxes;
+        for (size_t i = 0; i < RANDOM_COUNT; ++i)
+        {
+            glm::vec2 min{position(rng), position(rng)};
+            boxes.add({min, min + glm::vec2(size(rng), size(rng))});
+        }
+        return boxes;
+    }
+
+    Circles randomCircles(std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> position(-4.0f, 4.0f);
+        std::uniform_real_distribution<float> radius(0.1f, 2.0f);
+        Circles circles;
+        for (size_t i = 0; i < RANDOM_COUNT; ++i)
+        {
+            circles.add({position(rng), position(rng)}, radius(rng));
+        }
+        return circles;
+    }
+}
+
+// =============================================================================
+// overlapAABBBatch
+// =============================================================================
+
+TEST(MathBatchOverlapAABB, MatchesScalar)
+{
+    std::mt19937 rng(1);
+    Math::AABB box{{-1.0f, -1.0f}, {1.5f, 0.5f}};
+
+    for (int round = 0; round < 20; ++round)
+    {
+        Boxes boxes = randomBoxes(rng);
+        std::vector<uint8_t> overlaps(boxes.size());
+        Math::overlapAABBBatch(box, boxes.soa(), boxes.size(), overlaps.data());
+
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            EXPECT_EQ(overlaps[i] != 0, Math::checkAABBOverlap(box, boxes.get(i))) << "candidate " << i;
+        }
+    }
+}
+
+TEST(MathBatchOverlapAABB, TouchingCountsAsOverlap)
+{
+    Boxes boxes;
+    for (int i = 0; i < 8; ++i)
+    {
+        boxes.add({{1.0f, 0.0f}, {2.0f, 1.0f}}); // Shares the x = 1 edge
+    }
+    std::vector<uint8_t> overlaps(boxes.size());
+
+    Math::overlapAABBBatch({{0.0f, 0.0f}, {1.0f, 1.0f}}, boxes.soa(), boxes.size(), overlaps.data());
+
+    for (uint8_t overlap : overlaps)
+    {
+        EXPECT_EQ(overlap, 1);
+    }
+}
+
+TEST(MathBatchOverlapAABB, EmptyBatchWritesNothing)
+{
+    Boxes boxes;
+    uint8_t sentinel = 7;
+    Math::overlapAABBBatch({{0.0f, 0.0f}, {1.0f, 1.0f}}, boxes.soa(), 0, &sentinel);
+    EXPECT_EQ(sentinel, 7);
+}
+
+// =============================================================================
+// resolveAABBBatch
+// =============================================================================
+
+TEST(MathBatchResolveAABB, BitIdenticalToScalar)
+{
+    std::mt19937 rng(2);
+    Math::AABB box{{-1.0f, -1.0f}, {1.5f, 0.5f}};
+
+    for (int round = 0; round < 20; ++round)
+    {
+        Boxes boxes = randomBoxes(rng);
+        std::vector<Math::CollisionResult> results(boxes.size());
+        Math::resolveAABBBatch(box, boxes.soa(), boxes.size(), results.data());
+
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            expectSameBits(results[i], Math::resolveAABBCollision(box, boxes.get(i)), i);
+        }
+    }
+}
+
+TEST(MathBatchResolveAABB, EdgeCasesBitIdenticalToScalar)
+{
+    Math::AABB box{{0.0f, 0.0f}, {2.0f, 2.0f}};
+    Boxes boxes;
+    boxes.add({{2.0f, 0.0f}, {3.0f, 2.0f}});   // Touching: not colliding
+    boxes.add({{0.0f, 0.0f}, {2.0f, 2.0f}});   // Identical: equal overlaps on both axes
+    boxes.add({{1.0f, 1.0f}, {3.0f, 3.0f}});   // Equal overlap on X and Y
+    boxes.add({{0.5f, -1.0f}, {1.5f, 3.0f}});  // Contained on X, spanning Y
+    boxes.add({{-1.0f, 1.9f}, {3.0f, 4.0f}});  // Shallow from below
+    boxes.add({{-3.0f, -3.0f}, {-1.0f, -1.0f}}); // Separated
+    boxes.add({{1.9f, 0.5f}, {4.0f, 1.5f}});   // Shallow from the right
+    boxes.add({{-0.0f, -0.0f}, {0.0f, 0.0f}}); // Degenerate, at the corner
+    boxes.add({{0.25f, 0.25f}, {0.75f, 0.75f}}); // Fully inside
+
+    std::vector<Math::CollisionResult> results(boxes.size());
+    Math::resolveAABBBatch(box, boxes.soa(), boxes.size(), results.data());
+
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        expectSameBits(results[i], Math::resolveAABBCollision(box, boxes.get(i)), i);
+    }
+}
+
+// =============================================================================
+// resolveCircleBatch
+// =============================================================================
+
+TEST(MathBatchResolveCircle, BitIdenticalToScalar)
+{
+    std::mt19937 rng(3);
+    glm::vec2 center{0.3f, -0.2f};
+    float radius = 1.25f;
+
+    for (int round = 0; round < 20; ++round)
+    {
+        Circles circles = randomCircles(rng);
+        std::vector<Math::CollisionResult> results(circles.size());
+        Math::resolveCircleBatch(center, radius, circles.soa(), circles.size(), results.data());
+
+        for (size_t i = 0; i < circles.size(); ++i)
+        {
+            expectSameBits(results[i], Math::resolveCircleCollision(center, radius, {circles.x[i], circles.y[i]}, circles.radius[i]), i);
+        }
+    }
+}
+
+TEST(MathBatchResolveCircle, ConcentricAndTouchingBitIdenticalToScalar)
+{
+    glm::vec2 center{1.0f, 1.0f};
+    Circles circles;
+    circles.add({1.0f, 1.0f}, 0.5f);  // Concentric
+    circles.add({3.0f, 1.0f}, 1.0f);  // Exactly touching
+    circles.add({1.0f, 2.5f}, 1.0f);  // Vertical overlap
+    circles.add({9.0f, 9.0f}, 1.0f);  // Far away
+    circles.add({1.0f, 1.0f}, 2.0f);  // Concentric, larger
+    circles.add({0.0f, 0.0f}, 1.0f);  // Diagonal overlap
+    circles.add({1.0f, -0.5f}, 0.5f); // Exactly touching below
+    circles.add({1.5f, 1.0f}, 0.1f);  // Small, inside
+
+    std::vector<Math::CollisionResult> results(circles.size());
+    Math::resolveCircleBatch(center, 1.0f, circles.soa(), circles.size(), results.data());
+
+    for (size_t i = 0; i < circles.size(); ++i)
+    {
+        expectSameBits(results[i], Math::resolveCircleCollision(center, 1.0f, {circles.x[i], circles.y[i]}, circles.radius[i]), i);
+    }
+}
+
+// =============================================================================
+// resolveAABBCircleBatch
+// =============================================================================
+
+TEST(MathBatchResolveAABBCircle, BitIdenticalToScalar)
+{
+    std::mt19937 rng(4);
+    Math::AABB box{{-1.0f, -0.5f}, {1.0f, 1.5f}};
+
+    for (int round = 0; round < 20; ++round)
+    {
+        Circles circles = randomCircles(rng);
+        std::vector<Math::CollisionResult> results(circles.size());
+        Math::resolveAABBCircleBatch(box, circles.soa(), circles.size(), results.data());
+
+        for (size_t i = 0; i < circles.size(); ++i)
+        {
+            expectSameBits(results[i], Math::resolveAABBCircleCollision(box, {circles.x[i], circles.y[i]}, circles.radius[i]), i);
+        }
+    }
+}
+
+TEST(MathBatchResolveAABBCircle, CentersInsideAndOnEdgesBitIdenticalToScalar)
+{
+    Math::AABB box{{0.0f, 0.0f}, {4.0f, 2.0f}};
+    Circles circles;
+    circles.add({3.9f, 1.0f}, 0.5f);  // Inside, near right
+    circles.add({0.1f, 1.0f}, 0.5f);  // Inside, near left
+    circles.add({2.0f, 0.1f}, 0.5f);  // Inside, near top
+    circles.add({2.0f, 1.9f}, 0.5f);  // Inside, near bottom
+    circles.add({2.0f, 1.0f}, 0.5f);  // Inside, equidistant from top and bottom
+    circles.add({-0.0f, 1.0f}, 0.5f); // On the left edge, negative zero
+    circles.add({4.5f, 2.5f}, 1.0f);  // Outside, at the corner
+    circles.add({5.0f, 1.0f}, 1.0f);  // Exactly touching the right edge
+    circles.add({0.0f, 0.0f}, 0.5f);  // On the corner
+    circles.add({9.0f, 9.0f}, 1.0f);  // Far away
+
+    std::vector<Math::CollisionResult> results(circles.size());
+    Math::resolveAABBCircleBatch(box, circles.soa(), circles.size(), results.data());
+
+    for (size_t i = 0; i < circles.size(); ++i)
+    {
+        expectSameBits(results[i], Math::resolveAABBCircleCollision(box, {circles.x[i], circles.y[i]}, circles.radius[i]), i);
+    }
+}
+
+// =============================================================================
+// integrateVelocitiesBatch / integratePositionsBatch
+// =============================================================================
+
+TEST(MathBatchIntegrate, BitIdenticalToScalar)
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> value(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> positive(0.1f, 3.0f);
+
+    // Odd count, so the scalar tail runs after the lanes
+    const size_t count = 37;
+    std::vector<float> px(count), py(count), vx(count), vy(count), fx(count), fy(count), inverseMass(count), gravityScale(count), damping(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        px[i] = value(rng);
+        py[i] = value(rng);
+        vx[i] = value(rng);
+        vy[i] = value(rng);
+        fx[i] = value(rng);
+        fy[i] = value(rng);
+        inverseMass[i] = 1.0f / positive(rng);
+        gravityScale[i] = positive(rng);
+        damping[i] = i % 4 == 0 ? 0.0f : positive(rng);
+    }
+    std::vector<float> expectedX = px, expectedY = py, expectedVX = vx, expectedVY = vy;
+
+    const glm::vec2 gravity{0.5f, -9.81f};
+    const float dt = 1.0f / 60.0f;
+    Math::BodySoA bodies{px.data(), py.data(), vx.data(), vy.data(), fx.data(), fy.data(), inverseMass.data(), gravityScale.data(), damping.data()};
+    Math::integrateVelocitiesBatch(bodies, count, gravity, dt);
+    Math::integratePositionsBatch(bodies, count, dt);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        float accelerationX = gravity.x * gravityScale[i] + fx[i] * inverseMass[i];
+        float accelerationY = gravity.y * gravityScale[i] + fy[i] * inverseMass[i];
+        float divisor = 1.0f + dt * damping[i];
+        expectedVX[i] = (expectedVX[i] + accelerationX * dt) / divisor;
+        expectedVY[i] = (expectedVY[i] + accelerationY * dt) / divisor;
+        expectedX[i] += expectedVX[i] * dt;
+        expectedY[i] += expectedVY[i] * dt;
+
+        EXPECT_EQ(std::memcmp(&vx[i], &expectedVX[i], sizeof(float)), 0) << "body " << i;
+        EXPECT_EQ(std::memcmp(&vy[i], &expectedVY[i], sizeof(float)), 0) << "body " << i;
+        EXPECT_EQ(std::memcmp(&px[i], &expectedX[i], sizeof(float)), 0) << "body " << i;
+        EXPECT_EQ(std::memcmp(&py[i], &expectedY[i], sizeof(float)), 0) << "body " << i;
+    }
+}
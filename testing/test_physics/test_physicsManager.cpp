@@ -1,9 +1,18 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
 #include "engine/core/ecs/components/Transform.h"
 #include "engine/core/ecs/components/RigidBody.h"
 #include "engine/core/ecs/components/Collider.h"
+#include "engine/core/ecs/components/PolygonShape.h"
+#include "engine/core/ecs/components/TileMapCollider.h"
 #include "engine/physics/PhysicsManager.h"
+#include "engine/physics/TileMap.h"
 #include "engine/core/ecs/EntityManager.h"
 
 // =============================================================================
@@ -185,6 +194,138 @@ TEST(PhysicsManagerTest, SmallDeltaTimePrecision)
     EXPECT_NEAR(t.position.x, 60.0f, 0.01f);
 }
 
+// =============================================================================
+// Gravity, forces and damping
+// =============================================================================
+
+TEST(PhysicsManagerTest, GravityAcceleratesDynamicBodiesBeforeMovingThem)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setGravity({0.0f, 10.0f});
+
+    EntityID e = em.createEntity();
+    em.addComponent(e, ECS::Transform{{0.0f, 0.0f}});
+    em.addComponent(e, ECS::RigidBody{});
+
+    pm.update(0.5f);
+
+    // Semi-implicit Euler: the new velocity moves the body in the same step
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(e).velocity.y, 5.0f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(e).position.y, 2.5f);
+}
+
+TEST(PhysicsManagerTest, GravityIgnoresKinematicBodiesAndScalesPerBody)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setGravity({0.0f, 10.0f});
+
+    EntityID kinematic = em.createEntity();
+    em.addComponent(kinematic, ECS::Transform{{0.0f, 0.0f}});
+    ECS::RigidBody kinematicBody;
+    kinematicBody.type = ECS::BodyType::Kinematic;
+    kinematicBody.velocity = {1.0f, 0.0f};
+    em.addComponent(kinematic, kinematicBody);
+
+    EntityID floating = em.createEntity();
+    em.addComponent(floating, ECS::Transform{{0.0f, 0.0f}});
+    ECS::RigidBody floatingBody;
+    floatingBody.gravityScale = 0.0f;
+    em.addComponent(floating, floatingBody);
+
+    EntityID heavy = em.createEntity();
+    em.addComponent(heavy, ECS::Transform{{0.0f, 0.0f}});
+    ECS::RigidBody heavyBody;
+    heavyBody.gravityScale = 2.0f;
+    em.addComponent(heavy, heavyBody);
+
+    pm.update(1.0f);
+
+    EXPECT_EQ(em.getComponent<ECS::RigidBody>(kinematic).velocity, glm::vec2(1.0f, 0.0f));
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(kinematic).position.x, 1.0f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(floating).velocity.y, 0.0f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(heavy).velocity.y, 20.0f);
+}
+
+TEST(PhysicsManagerTest, ForceAppliesOverOneUpdateThenClears)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSubsteps(4);
+
+    EntityID e = em.createEntity();
+    em.addComponent(e, ECS::Transform{{0.0f, 0.0f}});
+    ECS::RigidBody body;
+    body.mass = 2.0f;
+    em.addComponent(e, body);
+
+    em.getComponent<ECS::RigidBody>(e).force = {8.0f, 0.0f};
+    pm.update(1.0f);
+
+    // a = F / m = 4 over every substep of the update
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(e).velocity.x, 4.0f);
+    EXPECT_EQ(em.getComponent<ECS::RigidBody>(e).force, glm::vec2(0.0f, 0.0f));
+
+    pm.update(1.0f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(e).velocity.x, 4.0f);
+}
+
+TEST(PhysicsManagerTest, LinearDampingSlowsBody)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID e = em.createEntity();
+    em.addComponent(e, ECS::Transform{{0.0f, 0.0f}});
+    ECS::RigidBody body;
+    body.velocity = {10.0f, 0.0f};
+    body.linearDamping = 1.0f;
+    em.addComponent(e, body);
+
+    pm.update(1.0f);
+
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(e).velocity.x, 5.0f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(e).position.x, 5.0f);
+}
+
+TEST(PhysicsManagerTest, IntegrationFollowsPoolChanges)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    std::vector<EntityID> entities;
+    for (int i = 0; i < 20; ++i)
+    {
+        EntityID e = em.createEntity();
+        em.addComponent(e, ECS::Transform{{static_cast<float>(i), 0.0f}});
+        em.addComponent(e, ECS::RigidBody{{5.0f, 0.0f}});
+        entities.push_back(e);
+    }
+    pm.update(1.0f);
+
+    // Reorder both pools and leave one body without a Transform
+    auto &transforms = em.getComponentPool<ECS::Transform>();
+    for (size_t i = 0; i < entities.size(); i += 3)
+    {
+        ECS::Transform transform = transforms.get(entities[i]);
+        transforms.remove(entities[i]);
+        em.addComponent(entities[i], transform);
+    }
+    em.getComponentPool<ECS::RigidBody>().remove(entities[4]);
+    em.addComponent(entities[4], ECS::RigidBody{{5.0f, 0.0f}});
+    transforms.remove(entities[7]);
+
+    pm.update(1.0f);
+
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        if (i == 7)
+            continue;
+        EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(entities[i]).position.x, static_cast<float>(i) + 10.0f) << "entity " << i;
+    }
+}
+
 // =============================================================================
 // Collision detection + resolution integration
 // =============================================================================
@@ -360,3 +501,1513 @@ TEST(PhysicsManagerTest, CircleCollisionInUpdateLoop)
     float distance = tB.position.x - tA.position.x;
     EXPECT_GE(distance, 1.99f); // should be ~2.0 (sum of radii)
 }
+
+// =============================================================================
+// Static / kinematic / dynamic partitioning
+// =============================================================================
+
+namespace
+{
+    EntityID addBox(EntityManager &em, glm::vec2 position, glm::vec2 size)
+    {
+        EntityID e = em.createEntity();
+        em.addComponent(e, ECS::Transform{position});
+        ECS::Collider c;
+        c.type = ECS::ColliderType::Box;
+        c.size = size;
+        em.addComponent(e, c);
+        return e;
+    }
+
+    EntityID addBody(EntityManager &em, glm::vec2 position, glm::vec2 velocity, ECS::BodyType type)
+    {
+        EntityID e = addBox(em, position, {2.0f, 2.0f});
+        ECS::RigidBody rb;
+        rb.velocity = velocity;
+        rb.type = type;
+        em.addComponent(e, rb);
+        return e;
+    }
+}
+
+TEST(PhysicsManagerTest, StaticStaticPairsAreSkipped)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    // Overlapping level geometry, one with an explicit static RigidBody
+    addBox(em, {0.0f, 0.0f}, {2.0f, 2.0f});
+    addBox(em, {1.0f, 0.0f}, {2.0f, 2.0f});
+    addBody(em, {0.5f, 0.5f}, {0.0f, 0.0f}, ECS::BodyType::Static);
+
+    pm.update(0.0f);
+
+    EXPECT_TRUE(pm.getCandidatePairs().empty());
+    EXPECT_EQ(pm.getStaticTree().getProxyCount(), 3u);
+}
+
+TEST(PhysicsManagerTest, KinematicPairsAreSkipped)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Kinematic);
+    addBody(em, {1.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Kinematic);
+    addBox(em, {0.5f, 1.0f}, {4.0f, 2.0f});
+
+    pm.update(0.0f);
+
+    EXPECT_TRUE(pm.getCandidatePairs().empty());
+}
+
+TEST(PhysicsManagerTest, DynamicBodyCollidesWithStaticGeometry)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID wall = addBox(em, {0.0f, 0.0f}, {2.0f, 10.0f});
+    EntityID body = addBody(em, {1.5f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.0f);
+
+    ASSERT_EQ(pm.getCandidatePairs().size(), 1u);
+    EXPECT_EQ(pm.getCandidatePairs()[0], makeCollisionPair(wall, body));
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(wall).position.x, 0.0f);
+    EXPECT_GE(em.getComponent<ECS::Transform>(body).position.x, 1.99f);
+}
+
+TEST(PhysicsManagerTest, StaticRigidBodyIgnoresVelocity)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID e = addBody(em, {0.0f, 0.0f}, {5.0f, 0.0f}, ECS::BodyType::Static);
+    pm.update(1.0f);
+
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(e).position.x, 0.0f);
+}
+
+TEST(PhysicsManagerTest, KinematicBodyPushesDynamicBody)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID platform = addBody(em, {0.0f, 0.0f}, {1.0f, 0.0f}, ECS::BodyType::Kinematic);
+    EntityID crate = addBody(em, {2.5f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(1.0f);
+
+    // The platform follows its velocity untouched; the crate is pushed out of it
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(platform).position.x, 1.0f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(platform).velocity.x, 1.0f);
+    EXPECT_GE(em.getComponent<ECS::Transform>(crate).position.x, 2.99f);
+}
+
+TEST(PhysicsManagerTest, StaticCollidersRescannedOnlyWhenComponentsChange)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {0.0f, 0.0f}, {2.0f, 2.0f});
+    addBox(em, {10.0f, 0.0f}, {2.0f, 2.0f});
+    addBody(em, {5.0f, 0.0f}, {1.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.1f);
+    EXPECT_EQ(pm.getStaticRescanCount(), 1u);
+    EXPECT_EQ(pm.getStaticTree().getProxyCount(), 2u);
+
+    // Only the dynamic body moves
+    pm.update(0.1f);
+    pm.update(0.1f);
+    EXPECT_EQ(pm.getStaticRescanCount(), 1u);
+
+    // A new wall is picked up by one rescan
+    addBox(em, {20.0f, 0.0f}, {2.0f, 2.0f});
+    pm.update(0.1f);
+    pm.update(0.1f);
+    EXPECT_EQ(pm.getStaticRescanCount(), 2u);
+    EXPECT_EQ(pm.getStaticTree().getProxyCount(), 3u);
+}
+
+TEST(PhysicsManagerTest, DeletedStaticColliderLeavesTheStaticTree)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    std::vector<EntityID> bricks;
+    for (int i = 0; i < 5; ++i)
+        bricks.push_back(addBox(em, {i * 4.0f, 0.0f}, {2.0f, 2.0f}));
+    pm.update(0.1f);
+
+    em.deleteEntity(bricks[2]);
+    pm.update(0.1f);
+
+    EXPECT_EQ(pm.getStaticTree().getProxyCount(), 4u);
+    EXPECT_TRUE(pm.getStaticTree().validate());
+    std::vector<EntityID> found;
+    pm.queryAABB({{-1.0f, -1.0f}, {17.0f, 1.0f}}, found);
+    EXPECT_EQ(found, (std::vector<EntityID>{bricks[0], bricks[1], bricks[3], bricks[4]}));
+}
+
+TEST(PhysicsManagerTest, MarkStaticDirtyMovesOnlyThatCollider)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID wall = addBox(em, {0.0f, 0.0f}, {2.0f, 2.0f});
+    EntityID other = addBox(em, {10.0f, 0.0f}, {2.0f, 2.0f});
+    pm.update(0.1f);
+
+    // Moved by hand: the static tree is not looked at again until told
+    em.getComponent<ECS::Transform>(wall).position.y = 20.0f;
+    pm.update(0.1f);
+    std::vector<EntityID> found;
+    pm.queryAABB({{-1.0f, 19.0f}, {1.0f, 21.0f}}, found);
+    EXPECT_TRUE(found.empty());
+
+    pm.markStaticDirty(wall);
+    pm.update(0.1f);
+    pm.queryAABB({{-1.0f, 19.0f}, {1.0f, 21.0f}}, found);
+    EXPECT_EQ(found, std::vector<EntityID>{wall});
+    found.clear();
+    pm.queryAABB({{-1.0f, -1.0f}, {1.0f, 1.0f}}, found);
+    EXPECT_TRUE(found.empty());
+
+    EXPECT_EQ(pm.getStaticRescanCount(), 1u);
+    EXPECT_EQ(pm.getStaticTree().getProxyCount(), 2u);
+    found.clear();
+    pm.queryAABB({{9.0f, -1.0f}, {11.0f, 1.0f}}, found);
+    EXPECT_EQ(found, std::vector<EntityID>{other});
+}
+
+TEST(PhysicsManagerTest, MarkStaticDirtyFollowsBodyTypeChanges)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID crate = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Static);
+    pm.update(0.1f);
+    EXPECT_EQ(pm.getStaticTree().getProxyCount(), 1u);
+
+    em.getComponent<ECS::RigidBody>(crate).type = ECS::BodyType::Dynamic;
+    pm.markStaticDirty(crate);
+    pm.update(0.1f);
+    EXPECT_EQ(pm.getStaticTree().getProxyCount(), 0u);
+    EXPECT_EQ(pm.getStats().movingColliders, 1u);
+
+    em.getComponent<ECS::RigidBody>(crate).type = ECS::BodyType::Static;
+    pm.markStaticDirty(crate);
+    pm.update(0.1f);
+    EXPECT_EQ(pm.getStaticTree().getProxyCount(), 1u);
+    EXPECT_EQ(pm.getStats().movingColliders, 0u);
+}
+
+// =============================================================================
+// Sleeping and islands
+// =============================================================================
+
+TEST(PhysicsManagerTest, RestingBodyFallsAsleepAfterTimeToSleep)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.25f);
+
+    EntityID e = addBody(em, {0.0f, 0.0f}, {0.5f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.1f);
+    pm.update(0.1f);
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(e).awake);
+
+    pm.update(0.1f);
+    EXPECT_FALSE(em.getComponent<ECS::RigidBody>(e).awake);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(e).velocity.x, 0.0f);
+    EXPECT_EQ(pm.getSleepingTree().getProxyCount(), 1u);
+}
+
+TEST(PhysicsManagerTest, MovingBodyStaysAwake)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.25f);
+
+    EntityID e = addBody(em, {0.0f, 0.0f}, {5.0f, 0.0f}, ECS::BodyType::Dynamic);
+    for (int i = 0; i < 10; ++i)
+    {
+        pm.update(0.1f);
+    }
+
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(e).awake);
+    EXPECT_NEAR(em.getComponent<ECS::Transform>(e).position.x, 5.0f, 1e-4f);
+}
+
+TEST(PhysicsManagerTest, SleepingBodySkipsIntegrationUntilWoken)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.1f);
+
+    EntityID e = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+    ASSERT_FALSE(em.getComponent<ECS::RigidBody>(e).awake);
+
+    em.getComponent<ECS::RigidBody>(e).velocity = {10.0f, 0.0f};
+    pm.update(0.1f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(e).position.x, 0.0f);
+
+    pm.wakeBody(e);
+    EXPECT_EQ(pm.getSleepingTree().getProxyCount(), 0u);
+    pm.update(0.1f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(e).position.x, 1.0f);
+}
+
+TEST(PhysicsManagerTest, TouchingBodiesSleepAndWakeAsOneIsland)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.25f);
+
+    // A row of three touching crates, and a fourth crate far away on the right
+    EntityID a = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID b = addBody(em, {2.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID c = addBody(em, {4.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID far = addBody(em, {50.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        pm.update(0.1f);
+    }
+    ASSERT_FALSE(em.getComponent<ECS::RigidBody>(a).awake);
+    ASSERT_FALSE(em.getComponent<ECS::RigidBody>(c).awake);
+    ASSERT_FALSE(em.getComponent<ECS::RigidBody>(far).awake);
+
+    // A ball rolls into the left end of the row
+    EntityID ball = addBody(em, {-2.5f, 0.0f}, {10.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+    pm.update(0.1f);
+
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(a).awake);
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(b).awake);
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(c).awake);
+    EXPECT_FALSE(em.getComponent<ECS::RigidBody>(far).awake);
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(ball).awake);
+}
+
+TEST(PhysicsManagerTest, IslandStaysAwakeWhileAnyBodyMoves)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.1f);
+
+    // Two overlapping boxes pushed apart slowly stay in contact through the first ticks
+    EntityID resting = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID moving = addBody(em, {1.9f, 0.0f}, {-3.0f, 0.0f}, ECS::BodyType::Dynamic);
+    em.getComponent<ECS::RigidBody>(moving).restitution = 0.0f;
+    em.getComponent<ECS::RigidBody>(resting).restitution = 0.0f;
+
+    pm.update(0.1f);
+
+    // The resting box was touched by a moving one, so neither is allowed to sleep yet
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(resting).awake);
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(moving).awake);
+}
+
+TEST(PhysicsManagerTest, DeletedSleepingBodyLeavesSleepingTree)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.1f);
+
+    EntityID e = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+    ASSERT_EQ(pm.getSleepingTree().getProxyCount(), 1u);
+
+    em.deleteEntity(e);
+    addBody(em, {0.5f, 0.0f}, {5.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+
+    EXPECT_EQ(pm.getSleepingTree().getProxyCount(), 0u);
+    EXPECT_TRUE(pm.getCandidatePairs().empty());
+}
+
+TEST(PhysicsManagerTest, ReusedEntityIndexDoesNotInheritSleepState)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.1f);
+
+    // Touching, so both fall asleep in one island
+    EntityID sleeper = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID neighbour = addBody(em, {2.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+    ASSERT_EQ(pm.getSleepingTree().getProxyCount(), 2u);
+
+    // Recycle entities until one is given the deleted sleeper's index
+    em.deleteEntity(sleeper);
+    EntityID reused = em.createEntity();
+    while (getEntityIndex(reused) != getEntityIndex(sleeper))
+    {
+        em.deleteEntity(reused);
+        reused = em.createEntity();
+    }
+    ASSERT_NE(reused, sleeper);
+    em.addComponent(reused, ECS::Transform{{50.0f, 0.0f}});
+    em.addComponent(reused, ECS::Collider{});
+    ECS::RigidBody rb;
+    rb.velocity = {10.0f, 0.0f};
+    em.addComponent(reused, rb);
+
+    pm.update(0.1f);
+
+    // The new body neither wakes the old island nor is mistaken for the sleeping one
+    EXPECT_FALSE(em.getComponent<ECS::RigidBody>(neighbour).awake);
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(reused).awake);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(reused).position.x, 51.0f);
+    EXPECT_EQ(pm.getSleepingTree().getProxyCount(), 1u);
+
+    std::vector<EntityID> found;
+    pm.queryAABB({{-1.0f, -1.0f}, {0.5f, 1.0f}}, found);
+    EXPECT_TRUE(found.empty());
+    found.clear();
+    pm.queryAABB({{50.0f, -1.0f}, {52.0f, 1.0f}}, found);
+    EXPECT_EQ(found, std::vector<EntityID>{reused});
+}
+
+TEST(PhysicsManagerTest, SleepingBodyWithoutColliderLeavesSleepingTree)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.1f);
+
+    EntityID e = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+    ASSERT_EQ(pm.getSleepingTree().getProxyCount(), 1u);
+
+    em.getComponentPool<ECS::Collider>().remove(e);
+    addBody(em, {0.5f, 0.0f}, {5.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+
+    EXPECT_EQ(pm.getSleepingTree().getProxyCount(), 0u);
+    EXPECT_TRUE(pm.getCandidatePairs().empty());
+}
+
+TEST(PhysicsManagerTest, DisablingSleepWakesEveryBody)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.1f);
+
+    EntityID e = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+    ASSERT_FALSE(em.getComponent<ECS::RigidBody>(e).awake);
+
+    pm.setSleepParameters(false);
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(e).awake);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        pm.update(0.1f);
+    }
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(e).awake);
+}
+
+// =============================================================================
+// Multithreaded narrow-phase
+// =============================================================================
+
+namespace
+{
+    /** A dense grid of overlapping dynamic boxes: enough pairs to split the narrow-phase across threads. */
+    void addCrowd(EntityManager &em, int side)
+    {
+        for (int y = 0; y < side; ++y)
+        {
+            for (int x = 0; x < side; ++x)
+            {
+                glm::vec2 velocity{static_cast<float>((x * 7 + y * 3) % 5) - 2.0f, static_cast<float>((x * 5 + y) % 3) - 1.0f};
+                addBody(em, {x * 1.5f, y * 1.5f}, velocity, ECS::BodyType::Dynamic);
+            }
+        }
+    }
+}
+
+TEST(PhysicsManagerTest, NarrowPhaseResultDoesNotDependOnThreadCount)
+{
+    EntityManager emSingle;
+    EntityManager emThreaded;
+    PhysicsManager pmSingle(&emSingle);
+    PhysicsManager pmThreaded(&emThreaded);
+    pmSingle.setThreadCount(1);
+    pmThreaded.setThreadCount(4);
+
+    addCrowd(emSingle, 40);
+    addCrowd(emThreaded, 40);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        pmSingle.update(1.0f / 60.0f);
+        pmThreaded.update(1.0f / 60.0f);
+    }
+
+    ASSERT_GT(pmThreaded.getCandidatePairs().size(), 4 * PhysicsManager::MIN_PAIRS_PER_THREAD);
+    ASSERT_EQ(pmSingle.getContacts().size(), pmThreaded.getContacts().size());
+
+    for (EntityID e : emSingle.getComponentPool<ECS::Transform>())
+    {
+        EXPECT_EQ(emSingle.getComponent<ECS::Transform>(e).position, emThreaded.getComponent<ECS::Transform>(e).position);
+        EXPECT_EQ(emSingle.getComponent<ECS::RigidBody>(e).velocity, emThreaded.getComponent<ECS::RigidBody>(e).velocity);
+    }
+}
+
+TEST(PhysicsManagerTest, ContactsAreMergedInPairOrder)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setThreadCount(4);
+
+    addCrowd(em, 40);
+    pm.update(0.0f);
+
+    const auto &contacts = pm.getContacts();
+    ASSERT_FALSE(contacts.empty());
+    for (size_t i = 1; i < contacts.size(); ++i)
+    {
+        EXPECT_TRUE(contacts[i - 1].first < contacts[i].first);
+    }
+    for (const auto &contact : contacts)
+    {
+        EXPECT_TRUE(contact.second.isColliding);
+    }
+}
+
+TEST(PhysicsManagerTest, ThreadCountZeroUsesHardwareThreads)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    pm.setThreadCount(3);
+    EXPECT_EQ(pm.getThreadCount(), 3u);
+
+    pm.setThreadCount(0);
+    EXPECT_GE(pm.getThreadCount(), 1u);
+}
+
+// =============================================================================
+// Continuous collision detection
+// =============================================================================
+
+namespace
+{
+    /** A small box fired at 6000 units/s: it moves 100 units per 60 Hz tick. */
+    EntityID addBullet(EntityManager &em, glm::vec2 position, glm::vec2 velocity, bool continuous)
+    {
+        EntityID e = addBox(em, position, {1.0f, 1.0f});
+        ECS::RigidBody rb;
+        rb.velocity = velocity;
+        rb.restitution = 0.0f;
+        rb.continuous = continuous;
+        em.addComponent(e, rb);
+        return e;
+    }
+}
+
+TEST(PhysicsManagerTest, DiscreteBulletTunnelsThroughThinWall)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {50.0f, 0.0f}, {1.0f, 20.0f});
+    EntityID bullet = addBullet(em, {0.0f, 0.0f}, {6000.0f, 0.0f}, false);
+
+    pm.update(1.0f / 60.0f);
+
+    EXPECT_NEAR(em.getComponent<ECS::Transform>(bullet).position.x, 100.0f, 1e-3f);
+}
+
+TEST(PhysicsManagerTest, ContinuousBulletStopsAtThinWall)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {50.0f, 0.0f}, {1.0f, 20.0f});
+    EntityID bullet = addBullet(em, {0.0f, 0.0f}, {6000.0f, 0.0f}, true);
+
+    pm.update(1.0f / 60.0f);
+
+    // Wall spans [49.5, 50.5]; the bullet's right edge stops on its left face
+    EXPECT_NEAR(em.getComponent<ECS::Transform>(bullet).position.x, 49.0f, 1e-3f);
+    EXPECT_NEAR(em.getComponent<ECS::RigidBody>(bullet).velocity.x, 0.0f, 1e-3f);
+}
+
+TEST(PhysicsManagerTest, ContinuousBulletBouncesAndUsesRemainingTime)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {50.0f, 0.0f}, {1.0f, 20.0f});
+    EntityID bullet = addBullet(em, {0.0f, 0.0f}, {6000.0f, 0.0f}, true);
+    em.getComponent<ECS::RigidBody>(bullet).restitution = 1.0f;
+
+    pm.update(1.0f / 60.0f);
+
+    // 49 units to the wall, then the remaining 51 back
+    EXPECT_NEAR(em.getComponent<ECS::Transform>(bullet).position.x, -2.0f, 1e-2f);
+    EXPECT_NEAR(em.getComponent<ECS::RigidBody>(bullet).velocity.x, -6000.0f, 1e-2f);
+}
+
+TEST(PhysicsManagerTest, ContinuousBulletSubstepsBetweenWalls)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    // A corridor 10 units wide: a single tick crosses it several times
+    addBox(em, {-5.5f, 0.0f}, {1.0f, 20.0f});
+    addBox(em, {5.5f, 0.0f}, {1.0f, 20.0f});
+    EntityID bullet = addBullet(em, {0.0f, 0.0f}, {6000.0f, 0.0f}, true);
+    em.getComponent<ECS::RigidBody>(bullet).restitution = 1.0f;
+
+    pm.update(1.0f / 60.0f);
+
+    float x = em.getComponent<ECS::Transform>(bullet).position.x;
+    EXPECT_GE(x, -4.5f);
+    EXPECT_LE(x, 4.5f);
+}
+
+TEST(PhysicsManagerTest, ContinuousCircleHitsCircle)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID post = em.createEntity();
+    em.addComponent(post, ECS::Transform{{50.0f, 0.0f}});
+    ECS::Collider postCollider;
+    postCollider.type = ECS::ColliderType::Circle;
+    postCollider.radius = 1.0f;
+    em.addComponent(post, postCollider);
+
+    EntityID ball = em.createEntity();
+    em.addComponent(ball, ECS::Transform{{0.0f, 0.0f}});
+    ECS::Collider ballCollider;
+    ballCollider.type = ECS::ColliderType::Circle;
+    ballCollider.radius = 0.5f;
+    em.addComponent(ball, ballCollider);
+    ECS::RigidBody rb;
+    rb.velocity = {6000.0f, 0.0f};
+    rb.restitution = 0.0f;
+    rb.continuous = true;
+    em.addComponent(ball, rb);
+
+    pm.update(1.0f / 60.0f);
+
+    EXPECT_NEAR(em.getComponent<ECS::Transform>(ball).position.x, 48.5f, 1e-3f);
+}
+
+TEST(PhysicsManagerTest, ContinuousBulletWakesSleepingBodyItHits)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.1f);
+
+    EntityID sleeper = addBody(em, {50.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+    ASSERT_FALSE(em.getComponent<ECS::RigidBody>(sleeper).awake);
+
+    EntityID bullet = addBullet(em, {0.0f, 0.0f}, {6000.0f, 0.0f}, true);
+    pm.update(1.0f / 60.0f);
+
+    EXPECT_TRUE(em.getComponent<ECS::RigidBody>(sleeper).awake);
+    EXPECT_LT(em.getComponent<ECS::Transform>(bullet).position.x, 50.0f);
+}
+
+// =============================================================================
+// World bounds cache
+// =============================================================================
+
+TEST(PhysicsManagerTest, WorldAABBsAreBoundsTestedThisTick)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID wall = addBox(em, {0.0f, 0.0f}, {2.0f, 10.0f});
+    EntityID body = addBody(em, {0.5f, 0.0f}, {10.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.1f);
+
+    ASSERT_EQ(pm.getWorldAABBs().size(), 2u);
+    ASSERT_EQ(pm.getWorldAABBEntities().size(), 2u);
+    EXPECT_EQ(pm.getWorldAABBEntities()[0], wall);
+    EXPECT_EQ(pm.getWorldAABBEntities()[1], body);
+
+    // Integrated to x = 1.5, then pushed out of the wall by the solver: the cache keeps the bounds that were tested
+    EXPECT_FLOAT_EQ(pm.getWorldAABBs()[1].min.x, 0.5f);
+    EXPECT_GT(em.getComponent<ECS::Transform>(body).position.x, 1.5f);
+}
+
+TEST(PhysicsManagerTest, ContinuousBodyWorldAABBFollowsSweep)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {50.0f, 0.0f}, {1.0f, 20.0f});
+    addBullet(em, {0.0f, 0.0f}, {6000.0f, 0.0f}, true);
+
+    pm.update(1.0f / 60.0f);
+
+    // Stopped against the wall's left face at 49.5
+    ASSERT_EQ(pm.getWorldAABBs().size(), 2u);
+    EXPECT_NEAR(pm.getWorldAABBs()[1].max.x, 49.5f, 1e-3f);
+}
+
+// =============================================================================
+// Collision layers
+// =============================================================================
+
+namespace
+{
+    void setLayer(EntityManager &em, EntityID entity, uint32_t category, uint32_t mask)
+    {
+        auto &collider = em.getComponent<ECS::Collider>(entity);
+        collider.category = category;
+        collider.mask = mask;
+    }
+}
+
+TEST(PhysicsManagerTest, CanCollideNeedsBothDirections)
+{
+    ECS::Collider a;
+    ECS::Collider b;
+    EXPECT_TRUE(ECS::canCollide(a, b));
+
+    a.category = 0x2;
+    b.mask = ~0x2u;
+    EXPECT_FALSE(ECS::canCollide(a, b));
+    EXPECT_FALSE(ECS::canCollide(b, a));
+
+    b.mask = 0x2;
+    a.mask = 0x4; // b (category 1) is not in a's mask
+    EXPECT_FALSE(ECS::canCollide(a, b));
+
+    a.mask = 0x1;
+    EXPECT_TRUE(ECS::canCollide(a, b));
+}
+
+TEST(PhysicsManagerTest, FilteredLayersProduceNoCandidatePairs)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID player = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID bullet = addBody(em, {0.5f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID otherBullet = addBody(em, {1.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    // Bullets ignore each other and the player
+    setLayer(em, bullet, 0x2, ~0x3u);
+    setLayer(em, otherBullet, 0x2, ~0x3u);
+
+    pm.update(0.0f);
+
+    EXPECT_TRUE(pm.getCandidatePairs().empty());
+    EXPECT_EQ(pm.getLayerBucketCount(), 2u);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(player).position.x, 0.0f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(bullet).position.x, 0.5f);
+}
+
+TEST(PhysicsManagerTest, InteractingLayersPairAcrossBuckets)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID enemy = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID bullet = addBody(em, {1.5f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID otherBullet = addBody(em, {3.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    setLayer(em, enemy, 0x4, 0x2);
+    setLayer(em, bullet, 0x2, 0x4);
+    setLayer(em, otherBullet, 0x2, 0x4);
+
+    pm.update(0.0f);
+
+    // Bullet-enemy only: the bullets overlap each other but their layer ignores itself
+    ASSERT_EQ(pm.getCandidatePairs().size(), 1u);
+    EXPECT_EQ(pm.getCandidatePairs()[0], makeCollisionPair(enemy, bullet));
+}
+
+TEST(PhysicsManagerTest, FilteredLayerPassesThroughStaticGeometry)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID wall = addBox(em, {0.0f, 0.0f}, {2.0f, 10.0f});
+    EntityID ghost = addBody(em, {1.5f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    setLayer(em, wall, 0x1, 0xFFFFFFFF);
+    setLayer(em, ghost, 0x8, ~0x1u);
+
+    pm.update(0.0f);
+
+    EXPECT_TRUE(pm.getCandidatePairs().empty());
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(ghost).position.x, 1.5f);
+}
+
+TEST(PhysicsManagerTest, FilteredContinuousBodyIsNotStoppedByWall)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {50.0f, 0.0f}, {1.0f, 20.0f});
+    EntityID bullet = addBullet(em, {0.0f, 0.0f}, {6000.0f, 0.0f}, true);
+    setLayer(em, bullet, 0x2, ~0x1u);
+
+    pm.update(1.0f / 60.0f);
+
+    EXPECT_NEAR(em.getComponent<ECS::Transform>(bullet).position.x, 100.0f, 1e-3f);
+}
+
+TEST(PhysicsManagerTest, LayeredPairsMatchFilteredBruteForce)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(false);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> position(0.0f, 30.0f);
+    std::uniform_int_distribution<uint32_t> layer(0, 3);
+    const uint32_t masks[] = {0xFFFFFFFF, 0x1, 0x6, 0x9};
+
+    std::vector<EntityID> entities;
+    for (int i = 0; i < 120; ++i)
+    {
+        EntityID e = addBody(em, {position(rng), position(rng)}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+        setLayer(em, e, 1u << layer(rng), masks[layer(rng)]);
+        entities.push_back(e);
+    }
+
+    pm.update(0.0f);
+
+    std::vector<CollisionPair> expected;
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        for (size_t j = i + 1; j < entities.size(); ++j)
+        {
+            const auto &a = em.getComponent<ECS::Collider>(entities[i]);
+            const auto &b = em.getComponent<ECS::Collider>(entities[j]);
+            if (ECS::canCollide(a, b) && Math::checkAABBOverlap(pm.getWorldAABBs()[i], pm.getWorldAABBs()[j]))
+                expected.push_back(makeCollisionPair(entities[i], entities[j]));
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(pm.getCandidatePairs(), expected);
+}
+
+// =============================================================================
+// Trigger volumes
+// =============================================================================
+
+namespace
+{
+    EntityID addTrigger(EntityManager &em, glm::vec2 position, glm::vec2 size)
+    {
+        EntityID e = addBox(em, position, size);
+        em.getComponent<ECS::Collider>(e).isTrigger = true;
+        return e;
+    }
+}
+
+TEST(PhysicsManagerTest, TriggerOverlapIsNotResolved)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID zone = addTrigger(em, {0.0f, 0.0f}, {4.0f, 4.0f});
+    EntityID body = addBody(em, {0.5f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.1f);
+
+    EXPECT_TRUE(pm.getContacts().empty());
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(body).position.x, 0.5f);
+
+    ASSERT_EQ(pm.getTriggerEvents().size(), 1u);
+    EXPECT_EQ(pm.getTriggerEvents()[0].trigger, zone);
+    EXPECT_EQ(pm.getTriggerEvents()[0].other, body);
+    EXPECT_EQ(pm.getTriggerEvents()[0].type, TriggerEventType::Enter);
+}
+
+TEST(PhysicsManagerTest, TriggerReportsEnterStayExit)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(false);
+
+    // Moving 2 units per tick, the body overlaps the zone on the first three ticks and is clear of it on the fourth
+    EntityID body = addBody(em, {-4.5f, 0.0f}, {10.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID zone = addTrigger(em, {0.0f, 0.0f}, {4.0f, 4.0f});
+
+    std::vector<TriggerEventType> types;
+    for (int tick = 0; tick < 8; ++tick)
+    {
+        pm.update(0.2f);
+        for (const TriggerEvent &event : pm.drainTriggerEvents())
+        {
+            EXPECT_EQ(event.trigger, zone);
+            EXPECT_EQ(event.other, body);
+            types.push_back(event.type);
+        }
+    }
+
+    ASSERT_GE(types.size(), 3u);
+    EXPECT_EQ(types.front(), TriggerEventType::Enter);
+    EXPECT_EQ(types.back(), TriggerEventType::Exit);
+    for (size_t i = 1; i + 1 < types.size(); ++i)
+    {
+        EXPECT_EQ(types[i], TriggerEventType::Stay);
+    }
+    EXPECT_TRUE(pm.getTriggerEvents().empty());
+}
+
+TEST(PhysicsManagerTest, TriggerEventsAccumulateUntilDrained)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addTrigger(em, {0.0f, 0.0f}, {4.0f, 4.0f});
+    addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.01f);
+    pm.update(0.01f);
+    pm.update(0.01f);
+
+    std::vector<TriggerEvent> events = pm.drainTriggerEvents();
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events[0].type, TriggerEventType::Enter);
+    EXPECT_EQ(events[1].type, TriggerEventType::Stay);
+    EXPECT_EQ(events[2].type, TriggerEventType::Stay);
+    EXPECT_TRUE(pm.getTriggerEvents().empty());
+}
+
+TEST(PhysicsManagerTest, KinematicTriggerDetectsStaticColliders)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    // A hand-moved ball against a static brick, as in Breakout
+    EntityID brick = addBox(em, {0.0f, 0.0f}, {4.0f, 2.0f});
+    EntityID ball = addBody(em, {1.0f, 1.0f}, {0.0f, 0.0f}, ECS::BodyType::Kinematic);
+    em.getComponent<ECS::Collider>(ball).isTrigger = true;
+
+    pm.update(0.1f);
+
+    ASSERT_EQ(pm.getTriggerEvents().size(), 1u);
+    EXPECT_EQ(pm.getTriggerEvents()[0].trigger, ball);
+    EXPECT_EQ(pm.getTriggerEvents()[0].other, brick);
+    EXPECT_EQ(pm.getTriggerEvents()[0].type, TriggerEventType::Enter);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(brick).position.x, 0.0f);
+}
+
+TEST(PhysicsManagerTest, SolidKinematicBodyIgnoresStaticColliders)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {0.0f, 0.0f}, {4.0f, 2.0f});
+    addBody(em, {1.0f, 1.0f}, {0.0f, 0.0f}, ECS::BodyType::Kinematic);
+
+    pm.update(0.1f);
+
+    EXPECT_TRUE(pm.getCandidatePairs().empty());
+    EXPECT_TRUE(pm.getTriggerEvents().empty());
+}
+
+TEST(PhysicsManagerTest, SleepingBodyStaysInTrigger)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(true, 1.0f, 0.1f);
+
+    addTrigger(em, {0.0f, 0.0f}, {4.0f, 4.0f});
+    EntityID body = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.1f);
+    ASSERT_FALSE(em.getComponent<ECS::RigidBody>(body).awake);
+    pm.drainTriggerEvents();
+
+    pm.update(0.1f);
+    pm.update(0.1f);
+
+    std::vector<TriggerEvent> events = pm.drainTriggerEvents();
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0].type, TriggerEventType::Stay);
+    EXPECT_EQ(events[1].type, TriggerEventType::Stay);
+}
+
+TEST(PhysicsManagerTest, RemovedColliderExitsTrigger)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID zone = addTrigger(em, {0.0f, 0.0f}, {4.0f, 4.0f});
+    EntityID body = addBody(em, {0.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.01f);
+    pm.drainTriggerEvents();
+
+    em.deleteEntity(body);
+    pm.update(0.01f);
+
+    std::vector<TriggerEvent> events = pm.drainTriggerEvents();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].trigger, zone);
+    EXPECT_EQ(events[0].other, body);
+    EXPECT_EQ(events[0].type, TriggerEventType::Exit);
+}
+
+// =============================================================================
+// Contact records
+// =============================================================================
+
+TEST(PhysicsManagerTest, ContactRecordsMirrorContacts)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {0.0f, 0.0f}, {4.0f, 1.0f});
+    addBody(em, {0.0f, 0.9f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    addBody(em, {1.9f, 0.9f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    addTrigger(em, {0.0f, 0.0f}, {8.0f, 8.0f});
+
+    pm.update(0.01f);
+
+    const auto &contacts = pm.getContacts();
+    const auto &records = pm.getContactRecords();
+    ASSERT_FALSE(contacts.empty());
+    ASSERT_EQ(records.size(), contacts.size());
+    for (size_t i = 0; i < contacts.size(); ++i)
+    {
+        EXPECT_EQ(records[i].entityA, contacts[i].first.entityA);
+        EXPECT_EQ(records[i].entityB, contacts[i].first.entityB);
+        EXPECT_EQ(records[i].normalX, contacts[i].second.normal.x);
+        EXPECT_EQ(records[i].normalY, contacts[i].second.normal.y);
+        EXPECT_EQ(records[i].penetration, contacts[i].second.penetration);
+    }
+}
+
+TEST(PhysicsManagerTest, ContactRecordsAreRebuiltEachTick)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {0.0f, 0.0f}, {4.0f, 1.0f});
+    EntityID body = addBody(em, {0.0f, 0.9f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.01f);
+    ASSERT_EQ(pm.getContactRecords().size(), 1u);
+
+    em.getComponent<ECS::Transform>(body).position = {0.0f, 10.0f};
+    pm.update(0.01f);
+    EXPECT_TRUE(pm.getContactRecords().empty());
+}
+
+TEST(PhysicsManagerTest, SharedContactRecordsOutliveLaterTicks)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {0.0f, 0.0f}, {4.0f, 1.0f});
+    EntityID body = addBody(em, {0.0f, 0.9f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.01f);
+
+    std::shared_ptr<const std::vector<ContactRecord>> held = pm.shareContactRecords();
+    ASSERT_EQ(held->size(), 1u);
+    ContactRecord before = (*held)[0];
+
+    em.getComponent<ECS::Transform>(body).position = {0.0f, 10.0f};
+    pm.update(0.01f);
+    pm.update(0.01f);
+
+    // The manager moved on to a buffer of its own; the held one is untouched
+    EXPECT_TRUE(pm.getContactRecords().empty());
+    EXPECT_NE(&pm.getContactRecords(), held.get());
+    ASSERT_EQ(held->size(), 1u);
+    EXPECT_EQ((*held)[0].entityB, before.entityB);
+    EXPECT_EQ((*held)[0].penetration, before.penetration);
+}
+
+TEST(PhysicsManagerTest, UnsharedContactRecordsAreReused)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addBox(em, {0.0f, 0.0f}, {4.0f, 1.0f});
+    addBody(em, {0.0f, 0.9f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.01f);
+    const std::vector<ContactRecord> *buffer = &pm.getContactRecords();
+    {
+        // A copy dropped before the next update() does not cost a new buffer
+        auto shared = pm.shareContactRecords();
+    }
+    pm.update(0.01f);
+
+    EXPECT_EQ(&pm.getContactRecords(), buffer);
+}
+
+// =============================================================================
+// Spatial queries
+// =============================================================================
+
+namespace
+{
+    EntityID addCircle(EntityManager &em, glm::vec2 position, float radius)
+    {
+        EntityID e = em.createEntity();
+        em.addComponent(e, ECS::Transform{position});
+        ECS::Collider c;
+        c.type = ECS::ColliderType::Circle;
+        c.radius = radius;
+        em.addComponent(e, c);
+        return e;
+    }
+}
+
+TEST(PhysicsManagerTest, QueriesSeeStaticSleepingAndMovingColliders)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID wall = addBox(em, {20.0f, 0.0f}, {2.0f, 2.0f});
+    EntityID sleeper = addBody(em, {30.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    for (int i = 0; i < 10; ++i)
+    {
+        pm.update(0.1f);
+    }
+    ASSERT_FALSE(em.getComponent<ECS::RigidBody>(sleeper).awake);
+
+    EntityID mover = addBody(em, {10.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+    EXPECT_EQ(pm.getMovingTree().getProxyCount(), 1u);
+
+    std::vector<EntityID> hits;
+    pm.raycast({0.0f, 0.0f}, {40.0f, 0.0f}, hits);
+    EXPECT_EQ(hits, (std::vector<EntityID>{mover, wall, sleeper}));
+
+    std::vector<EntityID> inRegion;
+    pm.queryAABB({{0.0f, -1.0f}, {40.0f, 1.0f}}, inRegion);
+    EXPECT_EQ(inRegion.size(), 3u);
+    EXPECT_TRUE(std::is_sorted(inRegion.begin(), inRegion.end()));
+}
+
+TEST(PhysicsManagerTest, RaycastMaxHitsKeepsNearest)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    std::vector<EntityID> row;
+    for (int i = 4; i >= 0; --i)
+    {
+        row.push_back(addBox(em, {10.0f + 5.0f * i, 0.0f}, {2.0f, 2.0f}));
+    }
+    pm.update(0.01f);
+
+    std::vector<EntityID> hits;
+    pm.raycast({0.0f, 0.0f}, {50.0f, 0.0f}, hits, 2);
+    EXPECT_EQ(hits, (std::vector<EntityID>{row[4], row[3]}));
+
+    hits.clear();
+    pm.raycast({0.0f, 0.0f}, {50.0f, 0.0f}, hits, 1);
+    EXPECT_EQ(hits, (std::vector<EntityID>{row[4]}));
+}
+
+TEST(PhysicsManagerTest, QueriesTestColliderShapes)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID circle = addCircle(em, {10.0f, 0.0f}, 1.0f);
+    pm.update(0.01f);
+
+    // Inside the circle's bounds but past its rim
+    std::vector<EntityID> found;
+    pm.queryAABB({{10.8f, 0.8f}, {12.0f, 2.0f}}, found);
+    pm.queryCircle({11.5f, 1.5f}, 0.7f, found);
+    pm.raycast({0.0f, 0.99f}, {8.0f, 0.2f}, found);
+    EXPECT_TRUE(found.empty());
+
+    pm.queryAABB({{10.5f, 0.5f}, {12.0f, 2.0f}}, found);
+    pm.queryCircle({11.5f, 1.5f}, 1.2f, found);
+    pm.raycast({0.0f, 0.9f}, {20.0f, 0.0f}, found);
+    EXPECT_EQ(found, (std::vector<EntityID>{circle, circle, circle}));
+}
+
+TEST(PhysicsManagerTest, QueriesSkipDeletedAndFilteredColliders)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID kept = addBox(em, {0.0f, 0.0f}, {2.0f, 2.0f});
+    EntityID deleted = addBody(em, {3.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID filtered = addBox(em, {6.0f, 0.0f}, {2.0f, 2.0f});
+    setLayer(em, filtered, 0x0002, 0xFFFFFFFF);
+    pm.update(0.01f);
+
+    em.deleteEntity(deleted);
+
+    std::vector<EntityID> found;
+    pm.queryAABB({{-10.0f, -10.0f}, {10.0f, 10.0f}}, found, 0x0001);
+    EXPECT_EQ(found, (std::vector<EntityID>{kept}));
+
+    found.clear();
+    pm.queryNearest({3.0f, 0.0f}, 3, found);
+    EXPECT_EQ(found.size(), 2u);
+}
+
+TEST(PhysicsManagerTest, MovingTreeFollowsResolvedPositions)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID body = addBody(em, {0.0f, 0.0f}, {100.0f, 0.0f}, ECS::BodyType::Dynamic);
+    pm.update(0.1f);
+
+    std::vector<EntityID> found;
+    pm.queryCircle({0.0f, 0.0f}, 0.5f, found);
+    EXPECT_TRUE(found.empty());
+
+    pm.queryCircle({10.0f, 0.0f}, 0.5f, found);
+    EXPECT_EQ(found, (std::vector<EntityID>{body}));
+}
+
+TEST(PhysicsManagerTest, NearestMatchesBruteForce)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    std::vector<EntityID> entities;
+    for (int i = 0; i < 150; ++i)
+    {
+        glm::vec2 position{coord(rng), coord(rng)};
+        if (i % 3 == 0)
+            entities.push_back(addCircle(em, position, 1.5f));
+        else if (i % 3 == 1)
+            entities.push_back(addBox(em, position, {2.0f, 3.0f}));
+        else
+            entities.push_back(addBody(em, position, {0.0f, 0.0f}, ECS::BodyType::Kinematic));
+    }
+    pm.update(0.01f);
+
+    std::uniform_real_distribution<float> query(-60.0f, 60.0f);
+    for (int q = 0; q < 20; ++q)
+    {
+        glm::vec2 point{query(rng), query(rng)};
+        float maxDistance = q % 2 ? 15.0f : INFINITY;
+
+        std::vector<std::pair<float, EntityID>> expected;
+        for (EntityID e : entities)
+        {
+            const auto &collider = em.getComponent<ECS::Collider>(e);
+            glm::vec2 center = em.getComponent<ECS::Transform>(e).position;
+            float distance = collider.type == ECS::ColliderType::Circle
+                                 ? std::fmax(glm::distance(point, center) - collider.radius, 0.0f)
+                                 : Math::distanceToAABB(point, {center - collider.size * 0.5f, center + collider.size * 0.5f});
+            if (distance <= maxDistance)
+                expected.emplace_back(distance, e);
+        }
+        std::sort(expected.begin(), expected.end());
+        expected.resize(std::min<size_t>(expected.size(), 5));
+
+        std::vector<EntityID> found;
+        pm.queryNearest(point, 5, found, maxDistance);
+        ASSERT_EQ(found.size(), expected.size());
+        for (size_t i = 0; i < found.size(); ++i)
+        {
+            EXPECT_EQ(found[i], expected[i].second);
+        }
+    }
+}
+
+// =============================================================================
+// Oriented colliders
+// =============================================================================
+
+namespace
+{
+    /** @brief Static 2x2 box turned 45 degrees: a diamond reaching sqrt(2) along each axis. */
+    EntityID addDiamond(EntityManager &em, glm::vec2 position)
+    {
+        EntityID e = addBox(em, position, {2.0f, 2.0f});
+        em.getComponent<ECS::Transform>(e).rotation = 45.0f;
+        return e;
+    }
+}
+
+TEST(PhysicsManagerTest, RotatedBoxOnlyStopsBodiesItsShapeTouches)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSleepParameters(false);
+
+    addDiamond(em, {0.0f, 0.0f});
+    // Both bodies end the tick inside the diamond's bounds; only the lower one reaches its shape
+    EntityID low = addBody(em, {-3.0f, 0.0f}, {10.0f, 0.0f}, ECS::BodyType::Dynamic);
+    EntityID high = addBody(em, {-3.0f, 2.3f}, {10.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.1f);
+
+    EXPECT_LT(em.getComponent<ECS::Transform>(low).position.x, -2.0f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::Transform>(high).position.x, -2.0f);
+    ASSERT_EQ(pm.getContacts().size(), 1u);
+    EXPECT_EQ(pm.getContacts()[0].second.pointCount, 1); // The diamond's corner against the body's face
+}
+
+TEST(PhysicsManagerTest, PolygonColliderTurnsWithItsTransform)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    // Thin triangle pointing +x, then turned to point +y
+    EntityID spike = em.createEntity();
+    em.addComponent(spike, ECS::Transform{{0.0f, 0.0f}});
+    ECS::Collider c;
+    c.type = ECS::ColliderType::Polygon;
+    glm::vec2 points[] = {{0.0f, -0.5f}, {3.0f, 0.0f}, {0.0f, 0.5f}};
+    ECS::PolygonShape shape;
+    ASSERT_TRUE(Math::makePolygon(points, 3, shape.polygon));
+    em.addComponent(spike, shape);
+    em.addComponent(spike, c);
+    pm.update(0.01f);
+
+    std::vector<EntityID> found;
+    pm.queryCircle({2.5f, 0.0f}, 0.1f, found);
+    EXPECT_EQ(found, std::vector<EntityID>{spike});
+
+    // Static, so turning it by hand takes effect once it is marked
+    em.getComponent<ECS::Transform>(spike).rotation = 90.0f;
+    pm.markStaticDirty(spike);
+    pm.update(0.01f);
+
+    found.clear();
+    pm.queryCircle({2.5f, 0.0f}, 0.1f, found);
+    EXPECT_TRUE(found.empty());
+    pm.queryCircle({0.0f, 2.5f}, 0.1f, found);
+    EXPECT_EQ(found, std::vector<EntityID>{spike});
+
+    Math::Polygon polygon;
+    ASSERT_TRUE(pm.getWorldPolygon(spike, polygon));
+    EXPECT_NEAR(Math::polygonAABB(polygon).max.y, 3.0f, 1e-5f);
+}
+
+TEST(PhysicsManagerTest, QueriesTestTheOrientedShape)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    EntityID diamond = addDiamond(em, {0.0f, 0.0f});
+    pm.update(0.01f);
+
+    // Each query touches the diamond's bounds near a corner, then its shape
+    std::vector<EntityID> found;
+    pm.raycast({-0.5f, 2.9f}, {3.5f, -3.5f}, found);
+    EXPECT_TRUE(found.empty());
+    pm.raycast({-0.5f, 1.5f}, {3.0f, -3.0f}, found);
+    EXPECT_EQ(found, std::vector<EntityID>{diamond});
+
+    found.clear();
+    pm.queryAABB({{1.0f, 1.0f}, {2.0f, 2.0f}}, found);
+    EXPECT_TRUE(found.empty());
+    pm.queryAABB({{0.5f, 0.5f}, {2.0f, 2.0f}}, found);
+    EXPECT_EQ(found, std::vector<EntityID>{diamond});
+
+    found.clear();
+    pm.queryNearest({1.2f, 1.2f}, 1, found, 0.3f);
+    EXPECT_TRUE(found.empty()); // About 0.99 from the nearest edge
+    pm.queryNearest({1.2f, 1.2f}, 1, found);
+    EXPECT_EQ(found, std::vector<EntityID>{diamond});
+}
+
+// =============================================================================
+// Tile maps
+// =============================================================================
+
+namespace
+{
+    /** @brief Tile map entity at @p origin from rows of text, '#' solid. */
+    EntityID addTileMap(EntityManager &em, glm::vec2 origin, const std::vector<std::string> &rows, float tileSize)
+    {
+        std::vector<uint8_t> solid;
+        for (const std::string &row : rows)
+        {
+            for (char tile : row)
+                solid.push_back(tile == '#');
+        }
+
+        EntityID e = em.createEntity();
+        em.addComponent(e, ECS::Transform{origin});
+        ECS::TileMapCollider map;
+        map.tileSize = tileSize;
+        TileMap::build(map, static_cast<int>(rows[0].size()), static_cast<int>(rows.size()), solid);
+        em.addComponent(e, map);
+        return e;
+    }
+}
+
+TEST(PhysicsManagerTest, BodyRestsOnTileMapFloor)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setGravity({0.0f, 20.0f});
+
+    EntityID level = addTileMap(em, {0.0f, 0.0f}, {
+        "#........#",
+        "#........#",
+        "##########",
+    }, 2.0f);
+    EntityID body = addBody(em, {10.0f, 2.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    em.getComponent<ECS::RigidBody>(body).restitution = 0.0f;
+
+    for (int tick = 0; tick < 120; ++tick)
+        pm.update(1.0f / 60.0f);
+
+    // The floor's top is y = 4; the 2x2 body rests on it
+    EXPECT_NEAR(em.getComponent<ECS::Transform>(body).position.y, 3.0f, 0.02f);
+    EXPECT_FALSE(em.getComponent<ECS::RigidBody>(body).awake);
+    EXPECT_TRUE(pm.getContacts().empty()); // Asleep, so no longer tested
+
+    em.getComponent<ECS::RigidBody>(body).velocity = {-30.0f, 0.0f};
+    pm.wakeBody(body);
+    for (int tick = 0; tick < 30; ++tick)
+        pm.update(1.0f / 60.0f);
+
+    // Stopped by the left wall while still on the floor: one contact with each of the map's rectangles
+    EXPECT_NEAR(em.getComponent<ECS::Transform>(body).position.x, 3.0f, 0.02f);
+    ASSERT_EQ(pm.getContacts().size(), 2u);
+    for (const Contact &contact : pm.getContacts())
+    {
+        EXPECT_EQ(contact.first, makeCollisionPair(body, level));
+    }
+}
+
+TEST(PhysicsManagerTest, TileMapRespectsLayersAndSkipsKinematicBodies)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    EntityID level = addTileMap(em, {0.0f, 0.0f}, {"####"}, 2.0f);
+    em.getComponent<ECS::TileMapCollider>(level).category = 0x2;
+
+    EntityID filtered = addBody(em, {1.0f, 1.5f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    em.getComponent<ECS::Collider>(filtered).mask = 0x1;
+    addBody(em, {5.0f, 1.5f}, {0.0f, 0.0f}, ECS::BodyType::Kinematic);
+    EntityID hit = addBody(em, {3.0f, -0.5f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.01f);
+
+    ASSERT_EQ(pm.getContacts().size(), 1u);
+    EXPECT_EQ(pm.getContacts()[0].first, makeCollisionPair(hit, level));
+    EXPECT_LT(em.getComponent<ECS::Transform>(hit).position.y, -0.5f); // Pushed back up out of the tiles
+}
+
+TEST(PhysicsManagerTest, ContinuousBodyDoesNotTunnelThroughTileWall)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    addTileMap(em, {10.0f, -2.0f}, {"#", "#"}, 2.0f);
+    EntityID bullet = addBody(em, {0.0f, 0.0f}, {600.0f, 0.0f}, ECS::BodyType::Dynamic);
+    em.getComponent<ECS::RigidBody>(bullet).continuous = true;
+    em.getComponent<ECS::RigidBody>(bullet).restitution = 0.0f;
+
+    pm.update(1.0f / 60.0f);
+
+    EXPECT_NEAR(em.getComponent<ECS::Transform>(bullet).position.x, 9.0f, 1e-4f);
+    EXPECT_FLOAT_EQ(em.getComponent<ECS::RigidBody>(bullet).velocity.x, 0.0f);
+}
+
+// =============================================================================
+// Profiling counters
+// =============================================================================
+
+TEST(PhysicsManagerTest, StatsDescribeTheLastUpdate)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    pm.setSubsteps(2);
+
+    addBox(em, {0.0f, 0.0f}, {4.0f, 2.0f});
+    addBody(em, {0.0f, -1.5f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    addBody(em, {50.0f, 0.0f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.02f);
+
+    const PhysicsStats &stats = pm.getStats();
+    EXPECT_EQ(stats.tick, 0u);
+    EXPECT_FLOAT_EQ(stats.dt, 0.02f);
+    EXPECT_EQ(stats.substeps, 2);
+    EXPECT_EQ(stats.movingColliders, 2u);
+    EXPECT_EQ(stats.staticColliders, 1u);
+    EXPECT_EQ(stats.sleepingColliders, 0u);
+
+    // Summed over both substeps; the far body never pairs with anything
+    EXPECT_EQ(stats.broadPhasePairs, 2u);
+    EXPECT_EQ(stats.narrowPhaseTests, 2u);
+    EXPECT_GE(stats.contacts, 1u);
+    EXPECT_EQ(stats.triggerOverlaps, 0u);
+    const ContactSolver &solver = pm.getContactSolver();
+    EXPECT_EQ(stats.velocityIterations, 2u * solver.getVelocityIterations());
+    EXPECT_EQ(stats.positionIterations, 2u * solver.getPositionIterations());
+
+    // Stages are disjoint spans of the update
+    double stages = stats.integrateMs + stats.broadPhaseMs + stats.continuousMs + stats.narrowPhaseMs +
+                    stats.solverMs + stats.sleepMs;
+    EXPECT_GT(stats.totalMs, 0.0);
+    EXPECT_LE(stages, stats.totalMs + 1e-9);
+
+    // The next update starts from zero rather than accumulating
+    size_t pairs = stats.broadPhasePairs;
+    pm.update(0.02f);
+    EXPECT_EQ(pm.getStats().tick, 1u);
+    EXPECT_LE(pm.getStats().broadPhasePairs, pairs);
+}
+
+TEST(PhysicsManagerTest, StatsCountTileMapTests)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+
+    // The body spans both walls and the floor between them
+    addTileMap(em, {0.0f, 0.0f}, {"#..#", "####"}, 2.0f);
+    EntityID body = addBody(em, {4.0f, 2.5f}, {0.0f, 0.0f}, ECS::BodyType::Dynamic);
+    em.getComponent<ECS::Collider>(body).size = {8.0f, 2.0f};
+
+    pm.update(0.01f);
+
+    EXPECT_EQ(pm.getStats().broadPhasePairs, 0u);
+    EXPECT_EQ(pm.getStats().narrowPhaseTests, 3u);
+    EXPECT_EQ(pm.getStats().contacts, 3u);
+}
+
+TEST(PhysicsManagerTest, TraceRecordsEveryUpdateWhileEnabled)
+{
+    EntityManager em;
+    PhysicsManager pm(&em);
+    addBody(em, {0.0f, 0.0f}, {1.0f, 0.0f}, ECS::BodyType::Dynamic);
+
+    pm.update(0.01f);
+    EXPECT_FALSE(pm.isTraceEnabled());
+    EXPECT_TRUE(pm.getTrace().empty());
+
+    pm.setTraceEnabled(true);
+    for (int tick = 0; tick < 3; ++tick)
+        pm.update(0.01f);
+    pm.setTraceEnabled(false);
+    pm.update(0.01f);
+
+    ASSERT_EQ(pm.getTrace().size(), 3u);
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(pm.getTrace()[i].tick, i + 1);
+        EXPECT_EQ(pm.getTrace()[i].movingColliders, 1u);
+    }
+
+    // Restarting drops the old trace
+    pm.setTraceEnabled(true);
+    EXPECT_TRUE(pm.getTrace().empty());
+    pm.update(0.01f);
+    EXPECT_EQ(pm.getTrace().size(), 1u);
+    pm.clearTrace();
+    EXPECT_TRUE(pm.getTrace().empty());
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "engine/physics/PhysicsStats.h"
+
+namespace
+{
+    std::vector<PhysicsStats> makeTrace()
+    {
+        PhysicsStats first;
+        first.tick = 7;
+        first.dt = 0.5f;
+        first.substeps = 2;
+        first.contacts = 3;
+        first.totalMs = 1.25;
+
+        PhysicsStats second = first;
+        second.tick = 8;
+        second.contacts = 0;
+        return {first, second};
+    }
+
+    std::vector<std::string> lines(const std::string &text)
+    {
+        std::vector<std::string> result;
+        std::istringstream in(text);
+        for (std::string line; std::getline(in, line);)
+            result.push_back(line);
+        return result;
+    }
+}
+
+// =============================================================================
+// writeCSV
+// =============================================================================
+
+TEST(PhysicsTraceCSV, HeaderThenOneRowPerUpdate)
+{
+    std::ostringstream out;
+    PhysicsTrace::writeCSV(out, makeTrace());
+
+    std::vector<std::string> rows = lines(out.str());
+    ASSERT_EQ(rows.size(), 3u);
+    EXPECT_EQ(rows[0].rfind("tick,dt,substeps,moving_colliders,", 0), 0u);
+    EXPECT_EQ(rows[0].substr(rows[0].size() - 9), ",total_ms");
+    EXPECT_EQ(rows[1].rfind("7,0.5,2,0,0,0,0,0,3,", 0), 0u);
+    EXPECT_EQ(rows[2].rfind("8,0.5,2,0,0,0,0,0,0,", 0), 0u);
+    EXPECT_EQ(rows[1].substr(rows[1].size() - 5), ",1.25");
+
+    // Every row has a value for every column
+    auto columns = [](const std::string &row)
+    { return std::count(row.begin(), row.end(), ','); };
+    EXPECT_EQ(columns(rows[1]), columns(rows[0]));
+    EXPECT_EQ(columns(rows[2]), columns(rows[0]));
+}
+
+TEST(PhysicsTraceCSV, EmptyTraceIsJustTheHeader)
+{
+    std::ostringstream out;
+    PhysicsTrace::writeCSV(out, {});
+    EXPECT_EQ(lines(out.str()).size(), 1u);
+}
+
+// =============================================================================
+// writeJSON
+// =============================================================================
+
+TEST(PhysicsTraceJSON, ArrayOfObjectsKeyedLikeTheCSV)
+{
+    std::ostringstream out;
+    PhysicsTrace::writeJSON(out, makeTrace());
+
+    std::vector<std::string> rows = lines(out.str());
+    ASSERT_EQ(rows.size(), 4u);
+    EXPECT_EQ(rows[0], "[");
+    EXPECT_EQ(rows[1].rfind("  {\"tick\": 7, \"dt\": 0.5, \"substeps\": 2, ", 0), 0u);
+    EXPECT_NE(rows[1].find("\"contacts\": 3, "), std::string::npos);
+    EXPECT_EQ(rows[1].substr(rows[1].size() - 18), "\"total_ms\": 1.25},");
+    EXPECT_EQ(rows[2].back(), '}');
+    EXPECT_EQ(rows[3], "]");
+}
+
+TEST(PhysicsTraceJSON, EmptyTraceIsAnEmptyArray)
+{
+    std::ostringstream out;
+    PhysicsTrace::writeJSON(out, {});
+    EXPECT_EQ(out.str(), "[]\n");
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include "engine/physics/Polygon.h"
+
+namespace
+{
+    Math::Polygon worldBox(glm::vec2 center, glm::vec2 halfSize, float degrees = 0.0f)
+    {
+        Math::Polygon polygon;
+        Math::transformPolygon(Math::makeBox(halfSize), center, Math::makeRotation(degrees), {1.0f, 1.0f}, polygon);
+        return polygon;
+    }
+}
+
+// =============================================================================
+// makePolygon
+// =============================================================================
+
+TEST(MathMakePolygon, HullIsCounterClockwiseWithOutwardNormals)
+{
+    // Clockwise square with a point inside it
+    glm::vec2 points[] = {{0.0f, 0.0f}, {0.0f, 2.0f}, {2.0f, 2.0f}, {1.0f, 1.0f}, {2.0f, 0.0f}};
+    Math::Polygon polygon;
+    ASSERT_TRUE(Math::makePolygon(points, 5, polygon));
+    ASSERT_EQ(polygon.count, 4);
+
+    float area = 0.0f;
+    for (int i = 0; i < polygon.count; ++i)
+    {
+        const glm::vec2 &a = polygon.vertices[i];
+        const glm::vec2 &b = polygon.vertices[(i + 1) % polygon.count];
+        area += a.x * b.y - a.y * b.x;
+
+        // Every other vertex is behind each edge
+        for (int j = 0; j < polygon.count; ++j)
+        {
+            EXPECT_LE(Math::dot(polygon.normals[i], polygon.vertices[j] - a), 1e-6f);
+        }
+        EXPECT_NEAR(Math::dot(polygon.normals[i], polygon.normals[i]), 1.0f, 1e-6f);
+    }
+    EXPECT_FLOAT_EQ(area * 0.5f, 4.0f);
+}
+
+TEST(MathMakePolygon, DropsCollinearAndDuplicatePoints)
+{
+    glm::vec2 points[] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {2.0f, 0.0f}, {2.0f, 0.0f}, {1.0f, 1.0f}};
+    Math::Polygon polygon;
+    ASSERT_TRUE(Math::makePolygon(points, 5, polygon));
+    EXPECT_EQ(polygon.count, 3);
+}
+
+TEST(MathMakePolygon, RejectsDegenerateInput)
+{
+    glm::vec2 line[] = {{0.0f, 0.0f}, {1.0f, 1.0f}, {2.0f, 2.0f}};
+    glm::vec2 many[Math::MAX_POLYGON_VERTICES + 1] = {};
+    Math::Polygon polygon;
+
+    EXPECT_FALSE(Math::makePolygon(line, 2, polygon));
+    EXPECT_FALSE(Math::makePolygon(line, 3, polygon));
+    EXPECT_FALSE(Math::makePolygon(many, Math::MAX_POLYGON_VERTICES + 1, polygon));
+    EXPECT_EQ(polygon.count, 0);
+}
+
+// =============================================================================
+// transformPolygon
+// =============================================================================
+
+TEST(MathTransformPolygon, RotatesVerticesAndNormals)
+{
+    Math::Polygon box = worldBox({1.0f, 0.0f}, {2.0f, 1.0f}, 90.0f);
+    Math::AABB aabb = Math::polygonAABB(box);
+
+    EXPECT_NEAR(aabb.min.x, 0.0f, 1e-5f);
+    EXPECT_NEAR(aabb.max.x, 2.0f, 1e-5f);
+    EXPECT_NEAR(aabb.min.y, -2.0f, 1e-5f);
+    EXPECT_NEAR(aabb.max.y, 2.0f, 1e-5f);
+    EXPECT_NEAR(box.normals[1].x, 0.0f, 1e-6f); // Local +x face now faces +y
+    EXPECT_NEAR(box.normals[1].y, 1.0f, 1e-6f);
+}
+
+TEST(MathTransformPolygon, MirroredScaleKeepsCounterClockwiseWinding)
+{
+    glm::vec2 points[] = {{0.0f, 0.0f}, {2.0f, 0.0f}, {0.0f, 1.0f}};
+    Math::Polygon local;
+    ASSERT_TRUE(Math::makePolygon(points, 3, local));
+
+    Math::Polygon world;
+    Math::transformPolygon(local, {0.0f, 0.0f}, Math::Rotation{}, {-1.0f, 2.0f}, world);
+
+    for (int i = 0; i < world.count; ++i)
+    {
+        for (int j = 0; j < world.count; ++j)
+        {
+            EXPECT_LE(Math::dot(world.normals[i], world.vertices[j] - world.vertices[i]), 1e-6f);
+        }
+    }
+}
+
+// =============================================================================
+// collidePolygons
+// =============================================================================
+
+TEST(MathCollidePolygons, RotatedBoxCornerHitsOnlyInsideItsBounds)
+{
+    // A square turned 45 degrees reaches sqrt(2) along x, but only at its corner
+    Math::Polygon diamond = worldBox({0.0f, 0.0f}, {1.0f, 1.0f}, 45.0f);
+
+    EXPECT_TRUE(Math::collidePolygons(diamond, worldBox({2.0f, 0.0f}, {0.7f, 0.7f})).isColliding);
+    EXPECT_FALSE(Math::collidePolygons(diamond, worldBox({2.0f, 1.1f}, {0.7f, 0.7f})).isColliding); // Bounds overlap, shapes do not
+}
+
+TEST(MathCollidePolygons, FaceContactGivesTwoPointsAndPushesAAway)
+{
+    Math::Polygon a = worldBox({0.0f, 0.0f}, {1.0f, 1.0f});
+    Math::Polygon b = worldBox({1.5f, 0.0f}, {1.0f, 0.5f});
+
+    auto result = Math::collidePolygons(a, b);
+    ASSERT_TRUE(result.isColliding);
+    EXPECT_NEAR(result.normal.x, -1.0f, 1e-6f);
+    EXPECT_NEAR(result.normal.y, 0.0f, 1e-6f);
+    EXPECT_NEAR(result.penetration, 0.5f, 1e-6f);
+    ASSERT_EQ(result.pointCount, 2);
+    for (int i = 0; i < result.pointCount; ++i)
+    {
+        EXPECT_NEAR(std::fabs(result.points[i].y), 0.5f, 1e-6f);
+    }
+
+    auto reversed = Math::collidePolygons(b, a);
+    ASSERT_TRUE(reversed.isColliding);
+    EXPECT_NEAR(reversed.normal.x, 1.0f, 1e-6f);
+}
+
+TEST(MathCollidePolygons, TouchingDoesNotCollide)
+{
+    EXPECT_FALSE(Math::collidePolygons(worldBox({0.0f, 0.0f}, {1.0f, 1.0f}), worldBox({2.0f, 0.0f}, {1.0f, 1.0f})).isColliding);
+    EXPECT_TRUE(Math::checkPolygonOverlap(worldBox({0.0f, 0.0f}, {1.0f, 1.0f}), worldBox({2.0f, 0.0f}, {1.0f, 1.0f})));
+}
+
+// =============================================================================
+// collidePolygonCircle
+// =============================================================================
+
+TEST(MathCollidePolygonCircle, FaceAndVertexRegions)
+{
+    Math::Polygon box = worldBox({0.0f, 0.0f}, {1.0f, 1.0f});
+
+    auto face = Math::collidePolygonCircle(box, {1.5f, 0.0f}, 1.0f);
+    ASSERT_TRUE(face.isColliding);
+    EXPECT_NEAR(face.normal.x, 1.0f, 1e-6f);
+    EXPECT_NEAR(face.penetration, 0.5f, 1e-6f);
+    EXPECT_NEAR(face.points[0].x, 1.0f, 1e-6f);
+
+    // Near the corner the circle is tested against the vertex, not the extended faces
+    EXPECT_FALSE(Math::collidePolygonCircle(box, {1.8f, 1.8f}, 1.0f).isColliding);
+    auto corner = Math::collidePolygonCircle(box, {1.5f, 1.5f}, 1.0f);
+    ASSERT_TRUE(corner.isColliding);
+    EXPECT_NEAR(corner.normal.x, corner.normal.y, 1e-6f);
+    EXPECT_NEAR(corner.points[0].x, 1.0f, 1e-6f);
+}
+
+TEST(MathCollidePolygonCircle, CentreInsidePolygon)
+{
+    auto result = Math::collidePolygonCircle(worldBox({0.0f, 0.0f}, {2.0f, 1.0f}), {0.0f, 0.6f}, 0.5f);
+    ASSERT_TRUE(result.isColliding);
+    EXPECT_NEAR(result.normal.y, 1.0f, 1e-6f);
+    EXPECT_NEAR(result.penetration, 0.9f, 1e-6f);
+}
+
+// =============================================================================
+// raycastPolygon / distanceToPolygon
+// =============================================================================
+
+TEST(MathRaycastPolygon, HitsTheRotatedShape)
+{
+    Math::Polygon diamond = worldBox({0.0f, 0.0f}, {1.0f, 1.0f}, 45.0f);
+    float fraction = 0.0f;
+
+    ASSERT_TRUE(Math::raycastPolygon({-4.0f, 0.0f}, {8.0f, 0.0f}, diamond, 1.0f, fraction));
+    EXPECT_NEAR(fraction, (4.0f - std::sqrt(2.0f)) / 8.0f, 1e-6f);
+
+    // Crosses the corner of the diamond's bounds, beside the diamond itself
+    EXPECT_FALSE(Math::raycastPolygon({-0.5f, 2.9f}, {3.5f, -3.5f}, diamond, 1.0f, fraction));
+    EXPECT_TRUE(Math::raycastPolygon({-0.5f, 1.5f}, {3.0f, -3.0f}, diamond, 1.0f, fraction));
+    EXPECT_FALSE(Math::raycastPolygon({-4.0f, 0.0f}, {8.0f, 0.0f}, diamond, 0.25f, fraction));
+}
+
+TEST(MathDistanceToPolygon, OutsideEdgeVertexAndInside)
+{
+    Math::Polygon box = worldBox({0.0f, 0.0f}, {1.0f, 1.0f});
+
+    EXPECT_FLOAT_EQ(Math::distanceToPolygon({3.0f, 0.0f}, box), 2.0f);
+    EXPECT_FLOAT_EQ(Math::distanceToPolygon({4.0f, 5.0f}, box), 5.0f);
+    EXPECT_FLOAT_EQ(Math::distanceToPolygon({0.5f, -0.5f}, box), 0.0f);
+}
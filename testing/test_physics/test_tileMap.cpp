@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "engine/physics/TileMap.h"
+
+namespace
+{
+    /** @brief Map from rows of text, '#' solid. */
+    ECS::TileMapCollider makeMap(const std::vector<std::string> &rows, float tileSize = 1.0f)
+    {
+        std::vector<uint8_t> solid;
+        for (const std::string &row : rows)
+        {
+            for (char tile : row)
+                solid.push_back(tile == '#');
+        }
+
+        ECS::TileMapCollider map;
+        map.tileSize = tileSize;
+        TileMap::build(map, static_cast<int>(rows[0].size()), static_cast<int>(rows.size()), solid);
+        return map;
+    }
+
+    std::vector<Math::AABB> rectsIn(const ECS::TileMapCollider &map, const Math::AABB &region, glm::vec2 origin = {0.0f, 0.0f})
+    {
+        std::vector<Math::AABB> found;
+        TileMap::forEachRect(map, origin, region, [&](const Math::AABB &rect)
+                             { found.push_back(rect); });
+        return found;
+    }
+}
+
+// =============================================================================
+// build
+// =============================================================================
+
+TEST(TileMapBuild, MergesRowsThenColumns)
+{
+    ECS::TileMapCollider map = makeMap({
+        "#......#",
+        "#......#",
+        "########",
+    });
+
+    // Both walls down to the floor row, then the floor between them
+    ASSERT_EQ(map.rects.size(), 3u);
+    EXPECT_EQ(map.rects[0].x, 0);
+    EXPECT_EQ(map.rects[0].height, 3);
+    EXPECT_EQ(map.rects[1].x, 7);
+    EXPECT_EQ(map.rects[1].height, 3);
+    EXPECT_EQ(map.rects[2].x, 1);
+    EXPECT_EQ(map.rects[2].width, 6);
+    EXPECT_EQ(map.rects[2].height, 1);
+}
+
+TEST(TileMapBuild, EverySolidTileIsCoveredOnce)
+{
+    std::vector<std::string> rows = {
+        "##.#..##",
+        ".####.#.",
+        "#.##.###",
+        "##....##",
+    };
+    ECS::TileMapCollider map = makeMap(rows);
+
+    std::vector<int> covered(map.tileRect.size(), 0);
+    for (const ECS::TileRect &rect : map.rects)
+    {
+        for (int y = rect.y; y < rect.y + rect.height; ++y)
+        {
+            for (int x = rect.x; x < rect.x + rect.width; ++x)
+                ++covered[y * map.columns + x];
+        }
+    }
+
+    for (int y = 0; y < map.rows; ++y)
+    {
+        for (int x = 0; x < map.columns; ++x)
+        {
+            size_t tile = static_cast<size_t>(y) * map.columns + x;
+            bool solid = rows[y][x] == '#';
+            EXPECT_EQ(covered[tile], solid ? 1 : 0) << x << "," << y;
+            EXPECT_EQ(map.tileRect[tile] != ECS::TileMapCollider::NO_RECT, solid);
+        }
+    }
+}
+
+TEST(TileMapBuild, EmptyAndShortInput)
+{
+    ECS::TileMapCollider map;
+    TileMap::build(map, 4, 4, {1, 1}); // Only the first two tiles given
+    ASSERT_EQ(map.rects.size(), 1u);
+    EXPECT_EQ(map.rects[0].width, 2);
+    EXPECT_TRUE(rectsIn(map, {{2.5f, 0.0f}, {10.0f, 10.0f}}).empty());
+
+    TileMap::build(map, 0, 0, {});
+    EXPECT_TRUE(map.rects.empty());
+    EXPECT_TRUE(rectsIn(map, {{-1.0f, -1.0f}, {1.0f, 1.0f}}).empty());
+}
+
+// =============================================================================
+// forEachRect
+// =============================================================================
+
+TEST(TileMapForEachRect, VisitsEachRectOnceInWorldSpace)
+{
+    ECS::TileMapCollider map = makeMap({
+        "#......#",
+        "#......#",
+        "########",
+    }, 16.0f);
+
+    // A region over the bottom-left corner touches the left wall and the floor
+    auto found = rectsIn(map, {{110.0f, 120.0f}, {130.0f, 140.0f}}, {100.0f, 100.0f});
+    ASSERT_EQ(found.size(), 2u);
+    EXPECT_FLOAT_EQ(found[0].min.x, 100.0f);
+    EXPECT_FLOAT_EQ(found[0].max.y, 148.0f);
+    EXPECT_FLOAT_EQ(found[1].min.x, 116.0f);
+    EXPECT_FLOAT_EQ(found[1].max.x, 212.0f);
+    EXPECT_FLOAT_EQ(found[1].min.y, 132.0f);
+
+    EXPECT_TRUE(rectsIn(map, {{120.0f, 100.0f}, {200.0f, 125.0f}}, {100.0f, 100.0f}).empty()); // The open room
+    EXPECT_TRUE(rectsIn(map, {{-1e9f, -1e9f}, {50.0f, 50.0f}}, {100.0f, 100.0f}).empty());    // Far outside
+    EXPECT_EQ(rectsIn(map, {{-1e9f, -1e9f}, {1e9f, 1e9f}}, {100.0f, 100.0f}).size(), 3u);
+}
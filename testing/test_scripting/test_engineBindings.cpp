@@ -5,7 +5,10 @@
 #include "engine/core/ecs/components/Transform.h"
 #include "engine/core/ecs/components/RigidBody.h"
 #include "engine/core/ecs/components/Collider.h"
+#include "engine/core/ecs/components/PolygonShape.h"
+#include "engine/core/ecs/components/TileMapCollider.h"
 #include "engine/core/InputManager.h"
+#include "engine/physics/PhysicsManager.h"
 
 class EngineBindingsTest : public ::testing::Test
 {
@@ -137,6 +140,279 @@ TEST_F(EngineBindingsTest, SetAndGetPhysicsManager)
     EXPECT_EQ(EngineBindings::getPhysicsManager(), nullptr);
 }
 
+TEST_F(EngineBindingsTest, SetBroadPhaseRejectsBadSizes)
+{
+    PhysicsManager pm(&em);
+    EngineBindings::setPhysicsManager(&pm);
+    se.execute("import engine");
+
+    EXPECT_THROW(se.execute("engine.set_broad_phase('spatial_hash', 0.0)"), py::error_already_set);
+    EXPECT_THROW(se.execute("engine.set_broad_phase('spatial_hash', -32.0)"), py::error_already_set);
+    EXPECT_THROW(se.execute("engine.set_broad_phase('aabb_tree', margin=-1.0)"), py::error_already_set);
+
+    // Sizes only matter to the broad-phase that uses them
+    EXPECT_NO_THROW(se.execute("engine.set_broad_phase('brute_force', 0.0)"));
+    EXPECT_NO_THROW(se.execute("engine.set_broad_phase('aabb_tree', margin=0.0)"));
+    EXPECT_NO_THROW(se.execute("engine.set_broad_phase('spatial_hash', 32.0)"));
+}
+
+// ===========================================================================
+// Physics stats and trace
+// ===========================================================================
+
+namespace
+{
+    // A dynamic box resting in a static one, so every update reports a pair and a contact
+    const char *OVERLAPPING_BOXES = R"(
+import engine
+mover = engine.create_entity()
+engine.add_transform(mover, 0.0, 0.0)
+engine.add_rigidbody(mover, 0.0, 0.0, 1.0)
+engine.add_collider_box(mover, 16.0, 16.0)
+wall = engine.create_entity()
+engine.add_transform(wall, 10.0, 0.0)
+engine.add_collider_box(wall, 16.0, 16.0)
+)";
+}
+
+TEST_F(EngineBindingsTest, PhysicsStatsAfterUpdate)
+{
+    PhysicsManager pm(&em);
+    EngineBindings::setPhysicsManager(&pm);
+    se.execute(OVERLAPPING_BOXES);
+    se.execute("engine.set_physics_substeps(2)");
+    se.execute("engine.physics_update(1.0 / 60.0)");
+
+    py::dict stats = se.execute("engine.physics_stats()").cast<py::dict>();
+    for (const char *key : {"tick", "dt", "substeps", "moving_colliders", "static_colliders", "sleeping_colliders",
+                            "broad_phase_pairs", "narrow_phase_tests", "contacts", "trigger_overlaps",
+                            "velocity_iterations", "position_iterations", "integrate_ms", "broad_phase_ms",
+                            "continuous_ms", "narrow_phase_ms", "solver_ms", "sleep_ms", "total_ms"})
+    {
+        EXPECT_TRUE(stats.contains(key)) << key;
+    }
+    EXPECT_EQ(stats.size(), 19u);
+
+    EXPECT_EQ(stats["tick"].cast<int>(), 0);
+    EXPECT_FLOAT_EQ(stats["dt"].cast<float>(), 1.0f / 60.0f);
+    EXPECT_EQ(stats["substeps"].cast<int>(), 2);
+    EXPECT_EQ(stats["moving_colliders"].cast<int>(), 1);
+    EXPECT_EQ(stats["static_colliders"].cast<int>(), 1);
+    EXPECT_EQ(stats["trigger_overlaps"].cast<int>(), 0);
+    // Summed over both substeps
+    EXPECT_EQ(stats["broad_phase_pairs"].cast<int>(), 2);
+    EXPECT_EQ(stats["contacts"].cast<int>(), 2);
+    EXPECT_GE(stats["total_ms"].cast<double>(), 0.0);
+
+    se.execute("engine.physics_update(1.0 / 60.0)");
+    EXPECT_EQ(se.execute("engine.physics_stats()['tick']").cast<int>(), 1);
+}
+
+TEST_F(EngineBindingsTest, SavePhysicsTraceWritesCSV)
+{
+    PhysicsManager pm(&em);
+    EngineBindings::setPhysicsManager(&pm);
+    se.execute(OVERLAPPING_BOXES);
+    se.execute("engine.physics_update(1.0 / 60.0)"); // Before the trace starts, so not recorded
+    se.execute("engine.physics_trace()");
+    se.execute("for _ in range(3): engine.physics_update(1.0 / 60.0)");
+    se.execute("engine.physics_trace(False)");
+    se.execute("engine.physics_update(1.0 / 60.0)"); // After it stops
+
+    se.execute(R"(
+import csv, os, tempfile
+trace_dir = tempfile.mkdtemp()
+trace_path = os.path.join(trace_dir, 'trace.csv')
+engine.save_physics_trace(trace_path)
+with open(trace_path, newline='') as f:
+    rows = list(csv.DictReader(f))
+)");
+
+    EXPECT_EQ(se.execute("len(rows)").cast<int>(), 3);
+    EXPECT_TRUE(se.execute("list(rows[0].keys()) == list(engine.physics_stats().keys())").cast<bool>());
+    EXPECT_TRUE(se.execute("[int(row['tick']) for row in rows] == [1, 2, 3]").cast<bool>());
+    EXPECT_TRUE(se.execute("all(int(row['contacts']) == 1 for row in rows)").cast<bool>());
+
+    // Saving clears the trace, so saving again writes the header alone
+    se.execute(R"(
+engine.save_physics_trace(trace_path)
+with open(trace_path) as f:
+    lines = f.read().splitlines()
+)");
+    EXPECT_EQ(se.execute("len(lines)").cast<int>(), 1);
+    EXPECT_TRUE(se.execute("lines[0].startswith('tick,dt,substeps,')").cast<bool>());
+    se.execute("os.remove(trace_path); os.rmdir(trace_dir)");
+}
+
+TEST_F(EngineBindingsTest, SavePhysicsTraceWritesJSON)
+{
+    PhysicsManager pm(&em);
+    EngineBindings::setPhysicsManager(&pm);
+    se.execute(OVERLAPPING_BOXES);
+    se.execute("engine.physics_trace(True)");
+    se.execute("for _ in range(2): engine.physics_update(1.0 / 30.0)");
+
+    se.execute(R"(
+import json, os, tempfile
+trace_dir = tempfile.mkdtemp()
+trace_path = os.path.join(trace_dir, 'trace.json')
+engine.save_physics_trace(trace_path)
+with open(trace_path) as f:
+    entries = json.load(f)
+os.remove(trace_path)
+os.rmdir(trace_dir)
+)");
+
+    EXPECT_EQ(se.execute("len(entries)").cast<int>(), 2);
+    EXPECT_TRUE(se.execute("set(entries[0]) == set(engine.physics_stats())").cast<bool>());
+    EXPECT_EQ(se.execute("entries[1]['tick']").cast<int>(), 1);
+    EXPECT_NEAR(se.execute("entries[0]['dt']").cast<float>(), 1.0f / 30.0f, 1e-6f); // Written with 6 significant digits
+    EXPECT_EQ(se.execute("entries[0]['static_colliders']").cast<int>(), 1);
+}
+
+TEST_F(EngineBindingsTest, SavePhysicsTraceToUnwritablePathThrows)
+{
+    PhysicsManager pm(&em);
+    EngineBindings::setPhysicsManager(&pm);
+    se.execute(OVERLAPPING_BOXES);
+    se.execute("engine.physics_trace()");
+    se.execute("engine.physics_update(1.0 / 60.0)");
+
+    EXPECT_THROW(se.execute("engine.save_physics_trace('/nonexistent-directory/trace.csv')"), py::error_already_set);
+    // A failed save keeps what was recorded
+    EXPECT_EQ(pm.getTrace().size(), 1u);
+}
+
+// ===========================================================================
+// Contacts, trigger events and queries
+// ===========================================================================
+
+TEST_F(EngineBindingsTest, GetContactsUnpacksWithStruct)
+{
+    PhysicsManager pm(&em);
+    EngineBindings::setPhysicsManager(&pm);
+    se.execute(OVERLAPPING_BOXES);
+    EXPECT_EQ(se.execute("len(engine.get_contacts())").cast<int>(), 0);
+
+    se.execute("engine.physics_update(1.0 / 60.0)");
+    se.execute(R"(
+import struct
+view = engine.get_contacts()
+records = list(struct.iter_unpack('QQfff4x', view.cast('B')))
+)");
+
+    EXPECT_EQ(se.execute("view.itemsize").cast<int>(), 32);
+    EXPECT_TRUE(se.execute("view.readonly").cast<bool>());
+    ASSERT_EQ(se.execute("len(records)").cast<int>(), 1);
+
+    auto record = se.execute("records[0]").cast<py::tuple>();
+    EXPECT_EQ(record[0].cast<EntityID>(), 0u);
+    EXPECT_EQ(record[1].cast<EntityID>(), 1u);
+    // The mover is left of the wall, so the normal pushes it towards -x
+    EXPECT_FLOAT_EQ(record[2].cast<float>(), -1.0f);
+    EXPECT_FLOAT_EQ(record[3].cast<float>(), 0.0f);
+    EXPECT_FLOAT_EQ(record[4].cast<float>(), 6.0f);
+}
+
+TEST_F(EngineBindingsTest, HeldContactsViewSurvivesLaterUpdates)
+{
+    PhysicsManager pm(&em);
+    EngineBindings::setPhysicsManager(&pm);
+    se.execute(OVERLAPPING_BOXES);
+    se.execute("engine.physics_update(1.0 / 60.0)");
+    se.execute("import struct");
+    se.execute("held = engine.get_contacts()");
+    se.execute("first = bytes(held)");
+
+    // Move the mover clear of the wall: the next updates find no contacts
+    se.execute("engine.set_position(mover, -100.0, 0.0)");
+    se.execute("engine.physics_update(1.0 / 60.0)");
+    se.execute("engine.physics_update(1.0 / 60.0)");
+
+    EXPECT_EQ(se.execute("len(engine.get_contacts())").cast<int>(), 0);
+    EXPECT_EQ(se.execute("len(held)").cast<int>(), 1);
+    EXPECT_TRUE(se.execute("bytes(held) == first").cast<bool>());
+    EXPECT_TRUE(se.execute("struct.unpack('QQfff4x', held.cast('B'))[:2] == (mover, wall)").cast<bool>());
+    se.execute("held.release()");
+}
+
+TEST_F(EngineBindingsTest, DrainTriggerEventsFromPython)
+{
+    PhysicsManager pm(&em);
+    EngineBindings::setPhysicsManager(&pm);
+    se.execute(R"(
+import engine
+zone = engine.create_entity()
+engine.add_transform(zone, 0.0, 0.0)
+engine.add_collider_box(zone, 32.0, 32.0, is_trigger=True)
+body = engine.create_entity()
+engine.add_transform(body, 0.0, 0.0)
+engine.add_rigidbody(body, 0.0, 0.0, 1.0)
+engine.add_collider_box(body, 8.0, 8.0)
+)");
+
+    se.execute("engine.physics_update(1.0 / 60.0)");
+    EXPECT_TRUE(se.execute("engine.drain_trigger_events() == [(zone, body, engine.TRIGGER_ENTER)]").cast<bool>());
+    // Triggers never push anything
+    EXPECT_EQ(pm.getContactRecords().size(), 0u);
+    EXPECT_TRUE(se.execute("engine.drain_trigger_events() == []").cast<bool>());
+
+    se.execute("engine.physics_update(1.0 / 60.0)");
+    EXPECT_TRUE(se.execute("engine.drain_trigger_events() == [(zone, body, engine.TRIGGER_STAY)]").cast<bool>());
+
+    se.execute("engine.delete_entity(body)");
+    se.execute("engine.physics_update(1.0 / 60.0)");
+    EXPECT_TRUE(se.execute("engine.drain_trigger_events() == [(zone, body, engine.TRIGGER_EXIT)]").cast<bool>());
+}
+
+TEST_F(EngineBindingsTest, RaycastAndRegionQueriesFromPython)
+{
+    PhysicsManager pm(&em);
+    EngineBindings::setPhysicsManager(&pm);
+    // Static boxes 0, 1 and 2 along the x axis; box 1 is on layer 2
+    se.execute(R"(
+import engine
+for i in range(3):
+    e = engine.create_entity()
+    engine.add_transform(e, i * 20.0, 0.0)
+    engine.add_collider_box(e, 8.0, 8.0, category=2 if i == 1 else 1)
+engine.physics_update(0.0)
+)");
+
+    EXPECT_TRUE(se.execute("engine.raycast(-10.0, 0.0, 60.0, 0.0) == [0, 1, 2]").cast<bool>());
+    EXPECT_TRUE(se.execute("engine.raycast(-10.0, 0.0, 60.0, 0.0, max_hits=1) == [0]").cast<bool>());
+    EXPECT_TRUE(se.execute("engine.raycast(-10.0, 0.0, 60.0, 0.0, mask=1) == [0, 2]").cast<bool>());
+    EXPECT_TRUE(se.execute("engine.raycast(-10.0, 20.0, 60.0, 0.0) == []").cast<bool>());
+
+    EXPECT_TRUE(se.execute("engine.query_aabb(15.0, -1.0, 45.0, 1.0) == [1, 2]").cast<bool>());
+    EXPECT_TRUE(se.execute("engine.query_aabb(15.0, -1.0, 45.0, 1.0, mask=2) == [1]").cast<bool>());
+    EXPECT_TRUE(se.execute("engine.query_circle(0.0, 0.0, 5.0) == [0]").cast<bool>());
+    EXPECT_TRUE(se.execute("engine.nearest_k(18.0, 0.0, 2) == [1, 0]").cast<bool>());
+    EXPECT_TRUE(se.execute("engine.nearest_k(18.0, 0.0, 5, max_distance=5.0) == [1]").cast<bool>());
+
+    EXPECT_THROW(se.execute("engine.raycast(0.0, 0.0, 1.0, 0.0, max_hits=-1)"), py::error_already_set);
+    EXPECT_THROW(se.execute("engine.nearest_k(0.0, 0.0, -1)"), py::error_already_set);
+}
+
+TEST_F(EngineBindingsTest, SetPositionMovesStaticCollider)
+{
+    PhysicsManager pm(&em);
+    EngineBindings::setPhysicsManager(&pm);
+    se.execute(R"(
+import engine
+wall = engine.create_entity()
+engine.add_transform(wall, 0.0, 0.0)
+engine.add_collider_box(wall, 8.0, 8.0)
+engine.physics_update(0.0)
+engine.set_position(wall, 50.0, 0.0)
+engine.physics_update(0.0)
+)");
+
+    EXPECT_TRUE(se.execute("engine.query_aabb(45.0, -1.0, 55.0, 1.0) == [wall]").cast<bool>());
+    EXPECT_TRUE(se.execute("engine.query_aabb(-1.0, -1.0, 1.0, 1.0) == []").cast<bool>());
+    EXPECT_EQ(pm.getStaticRescanCount(), 1u);
+}
+
 // ===========================================================================
 // Multiple bindings coexist
 // ===========================================================================
@@ -273,6 +549,52 @@ TEST_F(EngineBindingsTest, AddColliderCircleWithOffset)
     EXPECT_FLOAT_EQ(c.offset.y, 2.0f);
 }
 
+TEST_F(EngineBindingsTest, AddColliderPolygonFromPython)
+{
+    se.execute("import engine");
+    se.execute("e = engine.create_entity()");
+    se.execute("engine.add_transform(e, 0.0, 0.0)");
+    se.execute("engine.add_collider_polygon(e, [(0.0, 0.0), (10.0, 0.0), (0.0, 10.0), (2.0, 2.0)], 1.0, 0.0)");
+
+    // The hull drops the inner point and lives in its own component, out of the Collider
+    ASSERT_TRUE(em.hasComponent<ECS::PolygonShape>(0));
+    EXPECT_EQ(em.getComponent<ECS::PolygonShape>(0).polygon.count, 3);
+    auto &c = em.getComponent<ECS::Collider>(0);
+    EXPECT_EQ(c.type, ECS::ColliderType::Polygon);
+    EXPECT_FLOAT_EQ(c.offset.x, 1.0f);
+}
+
+TEST_F(EngineBindingsTest, AddColliderPolygonRejectsBadPoints)
+{
+    se.execute("import engine");
+    se.execute("e = engine.create_entity()");
+    se.execute("engine.add_transform(e, 0.0, 0.0)");
+
+    EXPECT_THROW(se.execute("engine.add_collider_polygon(e, [(0.0, 0.0), (1.0, 1.0), (2.0, 2.0)])"), py::error_already_set);
+    EXPECT_THROW(se.execute("engine.add_collider_polygon(e, [(float(i), float(i * i)) for i in range(9)])"), py::error_already_set);
+    EXPECT_FALSE(em.hasComponent<ECS::Collider>(0));
+    EXPECT_FALSE(em.hasComponent<ECS::PolygonShape>(0));
+}
+
+TEST_F(EngineBindingsTest, AddTilemapColliderFromPython)
+{
+    se.execute("import engine");
+    se.execute("e = engine.create_entity()");
+    se.execute("engine.add_transform(e, 0.0, 32.0)");
+    se.execute("engine.add_tilemap_collider(e, ['##..', '####'], 8.0, category=4)");
+
+    ASSERT_TRUE(em.hasComponent<ECS::TileMapCollider>(0));
+    auto &map = em.getComponent<ECS::TileMapCollider>(0);
+    EXPECT_EQ(map.columns, 4);
+    EXPECT_EQ(map.rows, 2);
+    EXPECT_FLOAT_EQ(map.tileSize, 8.0f);
+    EXPECT_EQ(map.category, 4u);
+    EXPECT_EQ(map.rects.size(), 2u);
+    EXPECT_EQ(map.tileRect[2], ECS::TileMapCollider::NO_RECT);
+
+    EXPECT_THROW(se.execute("engine.add_tilemap_collider(e, ['##', '###'], 8.0)"), py::error_already_set);
+}
+
 // ===========================================================================
 // RigidBody restitution default
 // ===========================================================================
@@ -286,4 +608,51 @@ TEST_F(EngineBindingsTest, RigidBodyHasDefaultRestitution)
 
     auto &rb = em.getComponent<ECS::RigidBody>(0);
     EXPECT_FLOAT_EQ(rb.restitution, 0.5f);
-}
\ No newline at end of file
+}
+
+TEST_F(EngineBindingsTest, SetBodyTypeWithoutRigidBodyThrows)
+{
+    se.execute("import engine");
+    se.execute("e = engine.create_entity()");
+    se.execute("engine.add_transform(e, 0.0, 0.0)");
+
+    EXPECT_THROW(se.execute("engine.set_body_type(e, 'static')"), py::error_already_set);
+    EXPECT_FALSE(em.hasComponent<ECS::RigidBody>(0));
+}
+
+TEST_F(EngineBindingsTest, SetContinuousWithoutRigidBodyThrows)
+{
+    se.execute("import engine");
+    se.execute("e = engine.create_entity()");
+    se.execute("engine.add_transform(e, 0.0, 0.0)");
+
+    EXPECT_THROW(se.execute("engine.set_continuous(e)"), py::error_already_set);
+    EXPECT_FALSE(em.hasComponent<ECS::RigidBody>(0));
+}
+
+TEST_F(EngineBindingsTest, IsAwakeWithoutRigidBodyThrows)
+{
+    se.execute("import engine");
+    se.execute("e = engine.create_entity()");
+    se.execute("engine.add_transform(e, 0.0, 0.0)");
+
+    EXPECT_THROW(se.execute("engine.is_awake(e)"), py::error_already_set);
+}
+
+// ===========================================================================
+// Entity lifetime
+// ===========================================================================
+
+TEST_F(EngineBindingsTest, DeleteEntityAndIsAliveFromPython)
+{
+    se.execute("import engine");
+    se.execute("e = engine.create_entity()");
+    se.execute("engine.add_transform(e, 0.0, 0.0)");
+    EXPECT_TRUE(se.execute("engine.is_alive(e)").cast<bool>());
+
+    EXPECT_TRUE(se.execute("engine.delete_entity(e)").cast<bool>());
+    EXPECT_FALSE(se.execute("engine.is_alive(e)").cast<bool>());
+    EXPECT_FALSE(se.execute("engine.delete_entity(e)").cast<bool>());
+    EXPECT_FALSE(em.hasComponent<ECS::Transform>(0));
+    EXPECT_EQ(em.getEntityCount(), 0u);
+}
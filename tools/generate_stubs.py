@@ -25,6 +25,8 @@ CPP_TO_PYTHON: Dict[str, str] = {
     "EntityID": "int",
     "py::tuple": "Tuple[float, float]",
     "pybind11::tuple": "Tuple[float, float]",
+    "py::list": "list[Tuple[float, float]]",
+    "std::vector<std::string>": "list[str]",
     "std::string": "str",
     "py::str": "str",
 }
@@ -40,9 +42,19 @@ ATTR_TYPE_MAP: Dict[str, str] = {
 # Return type overrides for lambdas with `return` but no explicit `-> type`
 RETURN_TYPE_OVERRIDES: Dict[str, str] = {
     "create_entity": "int",
+    "delete_entity": "bool",
+    "is_alive": "bool",
     "is_key_down": "bool",
     "is_key_pressed": "bool",
     "is_key_released": "bool",
+    "drain_trigger_events": "list[Tuple[int, int, int]]",
+    "get_contacts": "memoryview",
+    "physics_checksum": "int",
+    "physics_stats": "dict[str, float]",
+    "raycast": "list[int]",
+    "query_aabb": "list[int]",
+    "query_circle": "list[int]",
+    "nearest_k": "list[int]",
 }
 
 